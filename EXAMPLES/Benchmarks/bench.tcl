@@ -0,0 +1,50 @@
+# bench.tcl - runs one benchmark model and appends a JSON record of its
+# per-phase timings to a file, one record per line:
+#
+#   OpenSees bench.tcl model? size? outFile?
+#
+# model is the name of one of the scripts in this directory, which define
+# the procedures buildModel and runAnalysis, and size scales the model.
+
+if {$argc < 3} {
+    puts "usage: OpenSees bench.tcl model? size? outFile?"
+    exit 1
+}
+
+set model [lindex $argv 0]
+set size [lindex $argv 1]
+set outFile [lindex $argv 2]
+set benchDir [file dirname [file normalize [info script]]]
+
+set revision unknown
+catch {set revision [exec git -C $benchDir rev-parse --short HEAD]}
+
+wipe
+profile on
+
+set ok -1
+set error ""
+set tStart [clock microseconds]
+set tBuild 0.0
+if {[catch {
+    source [file join $benchDir $model.tcl]
+    buildModel $size
+    set tBuild [expr ([clock microseconds] - $tStart)/1.0e6]
+    set ok [runAnalysis $size]
+} message]} {
+    puts "bench.tcl - $model failed: $message"
+    set error [string map {\" ' \\ / \n " "} $message]
+}
+
+set profile [profile report]
+profile off
+
+set status [expr {$ok == 0 ? "true" : "false"}]
+set record "{\"model\": \"$model\", \"size\": $size, \"revision\": \"$revision\", \"ok\": $status, \"error\": \"$error\", \"build\": $tBuild, \"profile\": $profile}"
+
+set fileId [open $outFile a]
+puts $fileId $record
+close $fileId
+
+puts $record
+wipe
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+#
+# compare.py - compares two benchmark record files written by bench.tcl
+#
+#   python3 compare.py baseline.jsonl current.jsonl [threshold]
+#
+# The last record of every (model, size) pair in each file is compared
+# phase by phase. A phase, or the total, that is slower than the baseline
+# by more than threshold (default 0.10, i.e. 10%) is reported as a
+# regression and the script exits with status 1.
+
+import json
+import sys
+
+
+def load(fileName):
+    records = {}
+    with open(fileName) as f:
+        for line in f:
+            line = line.strip()
+            if line:
+                record = json.loads(line)
+                records[(record['model'], record['size'])] = record
+    return records
+
+
+def main():
+    if len(sys.argv) < 3:
+        print('usage: compare.py baseline.jsonl current.jsonl [threshold]')
+        return 2
+
+    baseline = load(sys.argv[1])
+    current = load(sys.argv[2])
+    threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 0.10
+
+    # ignore phases shorter than this, their timings are mostly noise
+    minTime = 0.05
+
+    regressions = 0
+    for key in sorted(current):
+        if key not in baseline:
+            continue
+        old, new = baseline[key], current[key]
+        if not old['ok'] or not new['ok']:
+            print('%s size %s: skipped, a run failed' % key)
+            continue
+
+        pairs = [('total', old['profile']['total'], new['profile']['total'])]
+        for phase, data in new['profile']['phases'].items():
+            pairs.append((phase, old['profile']['phases'][phase]['time'], data['time']))
+
+        print('%s size %s (%s -> %s)' % (key[0], key[1], old['revision'], new['revision']))
+        for name, t0, t1 in pairs:
+            if max(t0, t1) < minTime:
+                continue
+            change = (t1 - t0) / t0 if t0 > 0.0 else 0.0
+            flag = ''
+            if change > threshold:
+                flag = '  <-- regression'
+                regressions += 1
+            print('  %-20s %10.3f %10.3f %+8.1f%%%s' % (name, t0, t1, 100.0 * change, flag))
+
+        rss0 = old['profile']['peakRSS_kB']
+        rss1 = new['profile']['peakRSS_kB']
+        print('  %-20s %10d %10d' % ('peakRSS_kB', rss0, rss1))
+        print('  %-20s %10d %10d' % ('iterations', old['profile']['iterations'],
+                                     new['profile']['iterations']))
+
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,79 @@
+# damBreak.tcl - PFEM dam break: a water column collapsing in a tank, with
+# the fluid remeshed every step. The mesh size is 0.01/size.
+# Units: N, m, sec. Needs an interpreter with the mesh and remesh commands.
+
+proc buildModel {size} {
+    global wallMeshes
+
+    if {[info commands remesh] == ""} {
+	error "the mesh and remesh commands are not available"
+    }
+
+    set L 0.146
+    set H [expr 2*$L]
+    set H2 0.3
+    set h [expr 0.01/$size]
+
+    set rho 1000.0
+    set mu 0.0001
+    set b1 0.0
+    set b2 -9.81
+    set thk 0.012
+    set kappa -1.0
+
+    set wallId 1
+    set waterBoundId -1
+    set waterBodyId -2
+
+    model BasicBuilder -ndm 2 -ndf 2
+
+    node 1 0.0 0.0
+    node 2 $L 0.0
+    node 3 $L $H
+    node 4 0.0 $H
+    node 5 [expr 4*$L] 0.0
+    node 6 [expr 4*$L] $H2
+    node 7 0.0 $H2
+
+    # tank walls and the water column boundary
+    mesh line 1 2 1 2 $wallId 2 $h
+    mesh line 2 3 2 3 4 $waterBoundId 2 $h
+    mesh line 3 2 4 1 $wallId 2 $h
+    mesh line 4 2 4 7 $wallId 2 $h
+    mesh line 5 3 2 5 6 $wallId 2 $h
+    set wallMeshes {1 3 4 5}
+
+    # water column
+    mesh tri 6 3 1 2 3 $waterBodyId 2 $h PFEMElementBubble $rho $mu $b1 $b2 $thk $kappa
+
+    foreach tag $wallMeshes {
+	foreach nd [getNodeTags -mesh $tag] {
+	    set fixed($nd) 1
+	}
+    }
+    foreach nd [array names fixed] {
+	fix $nd 1 1
+    }
+}
+
+proc runAnalysis {size} {
+    set totalTime 0.1
+    set alpha 1.2
+
+    constraints Plain
+    numberer Plain
+    system PFEM
+    test PFEM 1.0e-5 1.0e-5 1.0e-5 1.0e-5 1.0e-15 1.0e-15 20 3 0 2
+    algorithm Newton
+    integrator PFEM
+    analysis PFEM 1.0e-3 1.0e-6 -9.81
+
+    while {[getTime] < $totalTime} {
+	set ok [analyze]
+	if {$ok < 0} {
+	    return $ok
+	}
+	remesh $alpha
+    }
+    return 0
+}
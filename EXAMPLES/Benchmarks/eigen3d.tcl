@@ -0,0 +1,56 @@
+# eigen3d.tcl - the first 20 modes of a linear elastic block of 8*size by
+# 8*size by 8*size bricks fixed at its base. Units: kN, m, sec.
+
+proc buildModel {size} {
+    set n [expr 8*$size]
+    set h [expr 10.0/$n]
+
+    model BasicBuilder -ndm 3 -ndf 3
+
+    set numNodeLayer [expr ($n+1)*($n+1)]
+    for {set k 0} {$k <= $n} {incr k} {
+	for {set j 0} {$j <= $n} {incr j} {
+	    for {set i 0} {$i <= $n} {incr i} {
+		set tag [expr $k*$numNodeLayer + $j*($n+1) + $i + 1]
+		node $tag [expr $i*$h] [expr $j*$h] [expr $k*$h]
+		if {$k == 0} {
+		    fix $tag 1 1 1
+		}
+	    }
+	}
+    }
+
+    nDMaterial ElasticIsotropic 1 3.0e7 0.2 2.4
+
+    set eleTag 1
+    for {set k 0} {$k < $n} {incr k} {
+	for {set j 0} {$j < $n} {incr j} {
+	    for {set i 0} {$i < $n} {incr i} {
+		set n1 [expr $k*$numNodeLayer + $j*($n+1) + $i + 1]
+		set n2 [expr $n1 + 1]
+		set n3 [expr $n2 + $n + 1]
+		set n4 [expr $n1 + $n + 1]
+		element stdBrick $eleTag $n1 $n2 $n3 $n4 \
+		    [expr $n1+$numNodeLayer] [expr $n2+$numNodeLayer] \
+		    [expr $n3+$numNodeLayer] [expr $n4+$numNodeLayer] 1
+		incr eleTag
+	    }
+	}
+    }
+}
+
+proc runAnalysis {size} {
+    constraints Plain
+    numberer RCM
+    system UmfPack
+    test NormDispIncr 1.0e-8 10
+    algorithm Linear
+    integrator LoadControl 1.0
+    analysis Static
+
+    set lambda [eigen 20]
+    if {[llength $lambda] != 20} {
+	return -1
+    }
+    return 0
+}
@@ -0,0 +1,104 @@
+# frame2d.tcl - 2d reinforced concrete moment frame with force-based fiber
+# beam-columns, gravity loads followed by a ground motion. The frame has
+# 3*size bays and 3*size stories. Units: kip, in, sec.
+
+proc buildModel {size} {
+    global beamTags roofNode
+
+    set numBay [expr 3*$size]
+    set numStory [expr 3*$size]
+    set bayWidth 288.0
+    set storyHeight 144.0
+    set mass 0.5
+
+    model BasicBuilder -ndm 2 -ndf 3
+
+    for {set j 0} {$j <= $numStory} {incr j} {
+	for {set i 0} {$i <= $numBay} {incr i} {
+	    set tag [expr $j*($numBay+1) + $i + 1]
+	    if {$j == 0} {
+		node $tag [expr $i*$bayWidth] 0.0
+		fix $tag 1 1 1
+	    } else {
+		node $tag [expr $i*$bayWidth] [expr $j*$storyHeight] -mass $mass $mass 0.0
+	    }
+	}
+    }
+
+    uniaxialMaterial Concrete02 1 -5.0 -0.002 -1.0 -0.006 0.1 0.5 250.0
+    uniaxialMaterial Steel02 2 60.0 29000.0 0.01 18.0 0.925 0.15
+
+    # columns 24x24, beams 30x18
+    section Fiber 1 {
+	patch rect 1 12 1 -12.0 -12.0 12.0 12.0
+	layer straight 2 4 1.0 10.0 10.0 10.0 -10.0
+	layer straight 2 4 1.0 -10.0 10.0 -10.0 -10.0
+    }
+    section Fiber 2 {
+	patch rect 1 15 1 -15.0 -9.0 15.0 9.0
+	layer straight 2 3 1.0 13.0 7.0 13.0 -7.0
+	layer straight 2 3 1.0 -13.0 7.0 -13.0 -7.0
+    }
+
+    geomTransf PDelta 1
+    geomTransf Linear 2
+
+    set eleTag 1
+    set beamTags {}
+    for {set j 1} {$j <= $numStory} {incr j} {
+	for {set i 0} {$i <= $numBay} {incr i} {
+	    set iNode [expr ($j-1)*($numBay+1) + $i + 1]
+	    set jNode [expr $j*($numBay+1) + $i + 1]
+	    element forceBeamColumn $eleTag $iNode $jNode 1 Lobatto 1 5
+	    incr eleTag
+	}
+	for {set i 0} {$i < $numBay} {incr i} {
+	    set iNode [expr $j*($numBay+1) + $i + 1]
+	    element forceBeamColumn $eleTag $iNode [expr $iNode+1] 2 Lobatto 2 5
+	    lappend beamTags $eleTag
+	    incr eleTag
+	}
+    }
+    set roofNode [expr ($numStory+1)*($numBay+1)]
+}
+
+proc runAnalysis {size} {
+    global beamTags roofNode
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	foreach tag $beamTags {
+	    eleLoad -ele $tag -type -beamUniform -0.1
+	}
+    }
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-8 20
+    algorithm Newton
+    integrator LoadControl 0.1
+    analysis Static
+    set ok [analyze 10]
+    if {$ok != 0} {
+	return $ok
+    }
+    loadConst -time 0.0
+
+    recorder Node -file frame2d_disp.out -time -node $roofNode -dof 1 disp
+
+    rayleigh 0.0 0.0 0.0 0.002
+    timeSeries Sine 2 0.0 2.0 0.5 -factor 150.0
+    pattern UniformExcitation 2 1 -accel 2
+
+    wipeAnalysis
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-8 20
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+
+    return [analyze 200 0.01]
+}
@@ -0,0 +1,116 @@
+# frame3d.tcl - 3d reinforced concrete moment frame with displacement-based
+# fiber beam-columns, gravity loads followed by a bidirectional ground
+# motion. The frame has 2*size by 2*size bays and 3*size stories.
+# Units: kip, in, sec.
+
+proc buildModel {size} {
+    global numNodeFloor numFloorNode roofNode
+
+    set numBay [expr 2*$size]
+    set numStory [expr 3*$size]
+    set bayWidth 240.0
+    set storyHeight 144.0
+    set mass 0.4
+
+    model BasicBuilder -ndm 3 -ndf 6
+
+    set numNodeFloor [expr ($numBay+1)*($numBay+1)]
+    for {set k 0} {$k <= $numStory} {incr k} {
+	for {set j 0} {$j <= $numBay} {incr j} {
+	    for {set i 0} {$i <= $numBay} {incr i} {
+		set tag [expr $k*$numNodeFloor + $j*($numBay+1) + $i + 1]
+		set x [expr $i*$bayWidth]
+		set y [expr $j*$bayWidth]
+		set z [expr $k*$storyHeight]
+		if {$k == 0} {
+		    node $tag $x $y $z
+		    fix $tag 1 1 1 1 1 1
+		} else {
+		    node $tag $x $y $z -mass $mass $mass 0.0 0.0 0.0 0.0
+		}
+	    }
+	}
+    }
+
+    uniaxialMaterial Concrete02 1 -5.0 -0.002 -1.0 -0.006 0.1 0.5 250.0
+    uniaxialMaterial Steel02 2 60.0 29000.0 0.01 18.0 0.925 0.15
+
+    # columns 24x24, beams 30x18
+    section Fiber 1 -GJ 1.0e8 {
+	patch rect 1 8 8 -12.0 -12.0 12.0 12.0
+	layer straight 2 4 1.0 10.0 10.0 10.0 -10.0
+	layer straight 2 4 1.0 -10.0 10.0 -10.0 -10.0
+    }
+    section Fiber 2 -GJ 1.0e8 {
+	patch rect 1 10 6 -15.0 -9.0 15.0 9.0
+	layer straight 2 3 1.0 13.0 7.0 13.0 -7.0
+	layer straight 2 3 1.0 -13.0 7.0 -13.0 -7.0
+    }
+
+    geomTransf PDelta 1 1.0 0.0 0.0
+    geomTransf Linear 2 0.0 0.0 1.0
+
+    set eleTag 1
+    for {set k 1} {$k <= $numStory} {incr k} {
+	for {set j 0} {$j <= $numBay} {incr j} {
+	    for {set i 0} {$i <= $numBay} {incr i} {
+		set jNode [expr $k*$numNodeFloor + $j*($numBay+1) + $i + 1]
+		element dispBeamColumn $eleTag [expr $jNode-$numNodeFloor] $jNode 1 Legendre 1 4
+		incr eleTag
+		if {$i < $numBay} {
+		    element dispBeamColumn $eleTag $jNode [expr $jNode+1] 2 Legendre 2 4
+		    incr eleTag
+		}
+		if {$j < $numBay} {
+		    element dispBeamColumn $eleTag $jNode [expr $jNode+$numBay+1] 2 Legendre 2 4
+		    incr eleTag
+		}
+	    }
+	}
+    }
+    set numFloorNode [expr $numStory*$numNodeFloor]
+    set roofNode [expr ($numStory+1)*$numNodeFloor]
+}
+
+proc runAnalysis {size} {
+    global numNodeFloor numFloorNode roofNode
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	for {set tag [expr $numNodeFloor+1]} {$tag <= $roofNode} {incr tag} {
+	    load $tag 0.0 0.0 -20.0 0.0 0.0 0.0
+	}
+    }
+
+    constraints Plain
+    numberer RCM
+    system UmfPack
+    test NormDispIncr 1.0e-8 20
+    algorithm Newton
+    integrator LoadControl 0.1
+    analysis Static
+    set ok [analyze 10]
+    if {$ok != 0} {
+	return $ok
+    }
+    loadConst -time 0.0
+
+    recorder Node -file frame3d_disp.out -time -node $roofNode -dof 1 2 disp
+
+    rayleigh 0.0 0.0 0.0 0.002
+    timeSeries Sine 2 0.0 2.0 0.5 -factor 150.0
+    timeSeries Sine 3 0.0 2.0 0.7 -factor 100.0
+    pattern UniformExcitation 2 1 -accel 2
+    pattern UniformExcitation 3 2 -accel 3
+
+    wipeAnalysis
+    constraints Plain
+    numberer RCM
+    system UmfPack
+    test NormDispIncr 1.0e-8 20
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+
+    return [analyze 100 0.01]
+}
@@ -0,0 +1,107 @@
+# shellBuilding.tcl - linear elastic building of ShellMITC4 walls and floor
+# slabs: gravity, the first 10 modes and a short ground motion. The plan is
+# meshed with 4*size by 4*size shells per floor and the building has
+# 4*size stories. Units: N, m, sec.
+
+proc buildModel {size} {
+    global numNodeFloor roofNode
+
+    set nx [expr 4*$size]
+    set numStory [expr 4*$size]
+    set width 24.0
+    set storyHeight 3.0
+    set h [expr $width/$nx]
+
+    model BasicBuilder -ndm 3 -ndf 6
+
+    set numNodeFloor [expr ($nx+1)*($nx+1)]
+    for {set k 0} {$k <= $numStory} {incr k} {
+	for {set j 0} {$j <= $nx} {incr j} {
+	    for {set i 0} {$i <= $nx} {incr i} {
+		set tag [expr $k*$numNodeFloor + $j*($nx+1) + $i + 1]
+		node $tag [expr $i*$h] [expr $j*$h] [expr $k*$storyHeight]
+		if {$k == 0} {
+		    fix $tag 1 1 1 1 1 1
+		}
+	    }
+	}
+    }
+
+    section ElasticMembranePlateSection 1 3.0e10 0.2 0.25 2400.0
+    section ElasticMembranePlateSection 2 3.0e10 0.2 0.20 2400.0
+
+    set eleTag 1
+    for {set k 1} {$k <= $numStory} {incr k} {
+	set base [expr $k*$numNodeFloor]
+
+	# floor slab
+	for {set j 0} {$j < $nx} {incr j} {
+	    for {set i 0} {$i < $nx} {incr i} {
+		set n1 [expr $base + $j*($nx+1) + $i + 1]
+		set n2 [expr $n1 + 1]
+		set n3 [expr $n2 + $nx + 1]
+		set n4 [expr $n1 + $nx + 1]
+		element ShellMITC4 $eleTag $n1 $n2 $n3 $n4 2
+		incr eleTag
+	    }
+	}
+
+	# perimeter walls, one shell per story and plan division
+	for {set i 0} {$i < $nx} {incr i} {
+	    foreach {a b} [list \
+		    [expr $i + 1] [expr $i + 2] \
+		    [expr $nx*($nx+1) + $i + 1] [expr $nx*($nx+1) + $i + 2] \
+		    [expr $i*($nx+1) + 1] [expr ($i+1)*($nx+1) + 1] \
+		    [expr $i*($nx+1) + $nx + 1] [expr ($i+1)*($nx+1) + $nx + 1]] {
+		set n1 [expr $base - $numNodeFloor + $a]
+		set n2 [expr $base - $numNodeFloor + $b]
+		element ShellMITC4 $eleTag $n1 $n2 [expr $n2+$numNodeFloor] [expr $n1+$numNodeFloor] 1
+		incr eleTag
+	    }
+	}
+    }
+    set roofNode [expr ($numStory+1)*$numNodeFloor]
+}
+
+proc runAnalysis {size} {
+    global numNodeFloor roofNode
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	for {set tag [expr $numNodeFloor+1]} {$tag <= $roofNode} {incr tag} {
+	    load $tag 0.0 0.0 -5000.0 0.0 0.0 0.0
+	}
+    }
+
+    constraints Plain
+    numberer RCM
+    system UmfPack
+    test NormDispIncr 1.0e-8 10
+    algorithm Linear
+    integrator LoadControl 1.0
+    analysis Static
+    set ok [analyze 1]
+    if {$ok != 0} {
+	return $ok
+    }
+    loadConst -time 0.0
+
+    eigen 10
+
+    recorder Node -file shellBuilding_disp.out -time -node $roofNode -dof 1 disp
+
+    rayleigh 0.0 0.0 0.0 0.002
+    timeSeries Sine 2 0.0 1.0 0.25 -factor 3.0
+    pattern UniformExcitation 2 1 -accel 2
+
+    wipeAnalysis
+    constraints Plain
+    numberer RCM
+    system UmfPack
+    test NormDispIncr 1.0e-8 10
+    algorithm Linear
+    integrator Newmark 0.5 0.25
+    analysis Transient
+
+    return [analyze 100 0.01]
+}
@@ -0,0 +1,84 @@
+# soilBlock.tcl - plane strain soil deposit of PM4Sand under a ground
+# motion: elastic gravity, switch to plastic, then shaking. The deposit is
+# meshed with 20*size by 5*size quads, the nodes at the lateral boundaries
+# are tied together. PM4Sand is a 2d (plane strain) model only, so the
+# deposit is a 2d block. Units: kN, m, sec.
+
+proc buildModel {size} {
+    global nx ny surfaceNode
+
+    set nx [expr 20*$size]
+    set ny [expr 5*$size]
+    set h [expr 20.0/$ny]
+    set rho 1.7
+
+    model BasicBuilder -ndm 2 -ndf 2
+
+    for {set j 0} {$j <= $ny} {incr j} {
+	for {set i 0} {$i <= $nx} {incr i} {
+	    node [expr $j*($nx+1) + $i + 1] [expr $i*$h] [expr $j*$h]
+	}
+    }
+    for {set i 0} {$i <= $nx} {incr i} {
+	fix [expr $i + 1] 1 1
+    }
+    for {set j 1} {$j <= $ny} {incr j} {
+	equalDOF [expr $j*($nx+1) + 1] [expr ($j+1)*($nx+1)] 1 2
+    }
+
+    # Dr G0 hpo rho
+    nDMaterial PM4Sand 1 0.55 476.0 0.53 $rho
+
+    for {set j 0} {$j < $ny} {incr j} {
+	for {set i 0} {$i < $nx} {incr i} {
+	    set n1 [expr $j*($nx+1) + $i + 1]
+	    set n2 [expr $n1 + 1]
+	    set n3 [expr $n2 + $nx + 1]
+	    set n4 [expr $n1 + $nx + 1]
+	    element quad [expr $j*$nx + $i + 1] $n1 $n2 $n3 $n4 1.0 PlaneStrain 1 0.0 $rho 0.0 -9.81
+	}
+    }
+    set surfaceNode [expr ($ny+1)*($nx+1) - $nx/2]
+}
+
+proc runAnalysis {size} {
+    global nx ny surfaceNode
+
+    constraints Transformation
+    numberer RCM
+    system UmfPack
+    test NormDispIncr 1.0e-6 30
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+
+    # elastic gravity
+    updateMaterialStage -material 1 -stage 0
+    set ok [analyze 10 500.0]
+    if {$ok != 0} {
+	return $ok
+    }
+    updateMaterialStage -material 1 -stage 1
+    set ok [analyze 10 500.0]
+    if {$ok != 0} {
+	return $ok
+    }
+    setTime 0.0
+    wipeAnalysis
+
+    recorder Node -file soilBlock_disp.out -time -node $surfaceNode -dof 1 disp
+
+    rayleigh 0.0 0.0 0.0 0.005
+    timeSeries Sine 1 0.0 2.0 0.5 -factor 2.0
+    pattern UniformExcitation 1 1 -accel 1
+
+    constraints Transformation
+    numberer RCM
+    system UmfPack
+    test NormDispIncr 1.0e-5 30
+    algorithm KrylovNewton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+
+    return [analyze 200 0.01]
+}
@@ -0,0 +1,59 @@
+# wave2d.tcl - explicit wave propagation in a plane strain elastic half
+# space loaded by a surface pulse, with lumped masses and a diagonal
+# system of equations. The domain is meshed with 40*size by 20*size quads.
+# Units: kN, m, sec.
+
+proc buildModel {size} {
+    global sourceNode receiverNode
+
+    set nx [expr 40*$size]
+    set ny [expr 20*$size]
+    set h [expr 100.0/$nx]
+
+    model BasicBuilder -ndm 2 -ndf 2
+
+    for {set j 0} {$j <= $ny} {incr j} {
+	for {set i 0} {$i <= $nx} {incr i} {
+	    node [expr $j*($nx+1) + $i + 1] [expr $i*$h] [expr $j*$h]
+	}
+    }
+    for {set i 0} {$i <= $nx} {incr i} {
+	fix [expr $i + 1] 1 1
+    }
+
+    nDMaterial ElasticIsotropic 1 2.0e5 0.25 2.0
+
+    for {set j 0} {$j < $ny} {incr j} {
+	for {set i 0} {$i < $nx} {incr i} {
+	    set n1 [expr $j*($nx+1) + $i + 1]
+	    set n2 [expr $n1 + 1]
+	    set n3 [expr $n2 + $nx + 1]
+	    set n4 [expr $n1 + $nx + 1]
+	    element quad [expr $j*$nx + $i + 1] $n1 $n2 $n3 $n4 1.0 PlaneStrain 1 0.0 2.0
+	}
+    }
+    set sourceNode [expr $ny*($nx+1) + $nx/2 + 1]
+    set receiverNode [expr $ny*($nx+1) + 3*$nx/4 + 1]
+}
+
+proc runAnalysis {size} {
+    global sourceNode receiverNode
+
+    timeSeries Sine 1 0.0 0.05 0.1 -factor 1000.0
+    pattern Plain 1 1 {
+	load $sourceNode 0.0 -1.0
+    }
+
+    recorder Node -file wave2d_vel.out -time -node $receiverNode -dof 2 vel
+
+    constraints Plain
+    numberer Plain
+    system Diagonal
+    algorithm Linear
+    integrator ExplicitDifference
+    analysis Transient
+
+    # about a seventh of the critical time step of the mesh
+    set dt [expr 1.0e-3/$size]
+    return [analyze [expr 500*$size] $dt]
+}
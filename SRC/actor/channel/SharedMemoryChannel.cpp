@@ -0,0 +1,483 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file contains the implementation of the methods needed
+// to define the SharedMemoryChannel class interface.
+
+#include "SharedMemoryChannel.h"
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <MovableObject.h>
+
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <limits.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+#define SHM_CHANNEL_MAGIC      0x4f505343
+#define SHM_DEFAULT_BUFFER     (1 << 20)
+#define SHM_MIN_BUFFER         4096
+#define SHM_SPIN_COUNT         2000
+#define SHM_CONNECT_TIMEOUT    30
+
+// one direction of the channel; head and tail count the bytes written and
+// read (modulo 2^32) and are kept on separate cache lines
+struct SharedMemoryRing {
+    unsigned int head;
+    unsigned int headWaiters;
+    char pad1[56];
+    unsigned int tail;
+    unsigned int tailWaiters;
+    char pad2[56];
+};
+
+// start of the segment; the data of ring[0] (creator to attacher) and
+// ring[1] (attacher to creator) follows it
+struct SharedMemoryHeader {
+    unsigned int magic;
+    unsigned int capacity;
+    unsigned int connected;
+    unsigned int closed;
+    char pad[48];
+    SharedMemoryRing ring[2];
+};
+
+
+static void
+shmWait(unsigned int *addr, unsigned int value)
+{
+#ifdef __linux__
+    // time out now and then to notice a closed channel
+    struct timespec timeout = {0, 100000000};
+    syscall(SYS_futex, addr, FUTEX_WAIT, value, &timeout, 0, 0);
+#else
+    sched_yield();
+#endif
+}
+
+
+static void
+shmWake(unsigned int *addr)
+{
+#ifdef __linux__
+    syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, 0, 0, 0);
+#endif
+}
+
+
+// wait until *addr no longer equals value; returns -1 if the other
+// process closes the channel in the meantime
+static int
+waitForChange(SharedMemoryHeader *header, unsigned int *addr,
+    unsigned int value, unsigned int *waiters)
+{
+    // spin briefly, the other process is usually about to respond
+    for (int i=0; i<SHM_SPIN_COUNT; i++)
+        if (__atomic_load_n(addr, __ATOMIC_ACQUIRE) != value)
+            return 0;
+
+    __atomic_fetch_add(waiters, 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(addr, __ATOMIC_SEQ_CST) == value) {
+        if (__atomic_load_n(&header->closed, __ATOMIC_ACQUIRE) != 0) {
+            __atomic_fetch_sub(waiters, 1, __ATOMIC_SEQ_CST);
+            return -1;
+        }
+        shmWait(addr, value);
+    }
+    __atomic_fetch_sub(waiters, 1, __ATOMIC_SEQ_CST);
+
+    return 0;
+}
+
+
+static void
+notifyChange(unsigned int *addr, unsigned int *waiters)
+{
+    if (__atomic_load_n(waiters, __ATOMIC_SEQ_CST) != 0)
+        shmWake(addr);
+}
+
+
+// SharedMemoryChannel(unsigned int port):
+//	constructor to create the shared memory segment for the port number
+//	port, setUpConnection() then waits for the other process to attach.
+SharedMemoryChannel::SharedMemoryChannel(unsigned int port, int bufferSize)
+    : shmFd(-1), shmBase(0), shmSize(0), capacity(SHM_MIN_BUFFER),
+    header(0), sendRing(0), recvRing(0), sendData(0), recvData(0),
+    myPort(port), connectType(0), unlinked(false)
+{
+    snprintf(shmName, 32, "/OpenSees.%u", port);
+
+    // ring capacity is a power of 2
+    if (bufferSize <= 0)
+        bufferSize = SHM_DEFAULT_BUFFER;
+    while (capacity < (unsigned int)bufferSize && capacity < (1u << 30))
+        capacity <<= 1;
+    shmSize = sizeof(SharedMemoryHeader) + 2*(size_t)capacity;
+
+    // like a bind() on a port in use, fail if the segment exists: it may
+    // belong to another run (one left by a crashed process must be removed
+    // by hand, e.g. from /dev/shm)
+    shmFd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (shmFd < 0) {
+        opserr << "SharedMemoryChannel::SharedMemoryChannel() - could not create ";
+        opserr << "shared memory " << shmName;
+        if (errno == EEXIST)
+            opserr << ", it is in use by another process";
+        opserr << endln;
+        unlinked = true;  // not ours, leave it alone
+        return;
+    }
+    if (ftruncate(shmFd, (off_t)shmSize) != 0) {
+        opserr << "SharedMemoryChannel::SharedMemoryChannel() - could not size ";
+        opserr << "shared memory " << shmName << endln;
+        return;
+    }
+    if (this->mapSegment() != 0)
+        return;
+
+    memset(shmBase, 0, sizeof(SharedMemoryHeader));
+    header->capacity = capacity;
+    __atomic_store_n(&header->magic, SHM_CHANNEL_MAGIC, __ATOMIC_RELEASE);
+}
+
+
+// SharedMemoryChannel(unsigned int other_Port, char *other_InetAddr):
+//	constructor to attach, in setUpConnection(), to the segment created
+//	by the SharedMemoryChannel with port number other_Port. The other
+//	process must run on this host.
+SharedMemoryChannel::SharedMemoryChannel(unsigned int other_Port,
+    const char *other_InetAddr, int bufferSize)
+    : shmFd(-1), shmBase(0), shmSize(0), capacity(0),
+    header(0), sendRing(0), recvRing(0), sendData(0), recvData(0),
+    myPort(other_Port), connectType(1), unlinked(true)
+{
+    snprintf(shmName, 32, "/OpenSees.%u", other_Port);
+
+    if (other_InetAddr != 0 && strcmp(other_InetAddr, "127.0.0.1") != 0
+        && strcmp(other_InetAddr, "localhost") != 0) {
+        opserr << "SharedMemoryChannel::SharedMemoryChannel() - WARNING address ";
+        opserr << other_InetAddr << " ignored, the other process must be on this host\n";
+    }
+}
+
+
+// ~SharedMemoryChannel():
+//	destructor
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+    if (header != 0) {
+        __atomic_store_n(&header->closed, 1, __ATOMIC_SEQ_CST);
+        for (int i=0; i<2; i++) {
+            shmWake(&header->ring[i].head);
+            shmWake(&header->ring[i].tail);
+        }
+        shmWake(&header->connected);
+    }
+
+    this->unmapSegment();
+
+    if (!unlinked)
+        shm_unlink(shmName);
+}
+
+
+int
+SharedMemoryChannel::mapSegment()
+{
+    shmBase = mmap(0, shmSize, PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+    if (shmBase == MAP_FAILED) {
+        shmBase = 0;
+        opserr << "SharedMemoryChannel::mapSegment() - could not map ";
+        opserr << "shared memory " << shmName << endln;
+        return -1;
+    }
+
+    header = (SharedMemoryHeader *)shmBase;
+    char *ringData = (char *)shmBase + sizeof(SharedMemoryHeader);
+    int me = connectType;
+    sendRing = &header->ring[me];
+    recvRing = &header->ring[1-me];
+    sendData = ringData + me*(size_t)capacity;
+    recvData = ringData + (1-me)*(size_t)capacity;
+
+    return 0;
+}
+
+
+void
+SharedMemoryChannel::unmapSegment()
+{
+    if (shmBase != 0)
+        munmap(shmBase, shmSize);
+    if (shmFd >= 0)
+        close(shmFd);
+
+    shmBase = 0;
+    shmFd = -1;
+    header = 0;
+}
+
+
+int 
+SharedMemoryChannel::setUpConnection()
+{
+    if (connectType == 1) {
+
+        // attach to the segment, waiting for the other process to create it
+        struct stat theStat;
+        time_t start = time(0);
+        while (true) {
+            if (shmFd < 0)
+                shmFd = shm_open(shmName, O_RDWR, 0600);
+            if (shmFd >= 0 && fstat(shmFd, &theStat) == 0
+                && theStat.st_size > (off_t)sizeof(SharedMemoryHeader))
+                break;
+            if (time(0) - start > SHM_CONNECT_TIMEOUT) {
+                opserr << "SharedMemoryChannel::setUpConnection() - could not attach ";
+                opserr << "to shared memory " << shmName << endln;
+                return -1;
+            }
+            usleep(10000);
+        }
+
+        shmSize = (size_t)theStat.st_size;
+        capacity = (unsigned int)((shmSize - sizeof(SharedMemoryHeader))/2);
+        if (this->mapSegment() != 0)
+            return -1;
+
+        while (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != SHM_CHANNEL_MAGIC)
+            usleep(1000);
+        if (header->capacity != capacity) {
+            opserr << "SharedMemoryChannel::setUpConnection() - shared memory ";
+            opserr << shmName << " has an invalid size\n";
+            this->unmapSegment();
+            return -1;
+        }
+
+        __atomic_store_n(&header->connected, 1, __ATOMIC_SEQ_CST);
+        shmWake(&header->connected);
+
+    } else {
+
+        if (header == 0) {
+            opserr << "SharedMemoryChannel::setUpConnection() - no shared memory\n";
+            return -1;
+        }
+
+        // wait for other process to attach
+        while (__atomic_load_n(&header->connected, __ATOMIC_SEQ_CST) == 0)
+            shmWait(&header->connected, 0);
+
+        // both processes hold a mapping, the name is no longer needed
+        shm_unlink(shmName);
+        unlinked = true;
+    }
+
+    return 0;
+}
+
+
+int
+SharedMemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+    opserr << "SharedMemoryChannel::setNextAddress() - a SharedMemoryChannel ";
+    opserr << "can only communicate with one other SharedMemoryChannel\n"; 
+
+    return -1;
+}
+
+
+int
+SharedMemoryChannel::writeBytes(const char *data, size_t nbytes)
+{
+    if (header == 0)
+        return -1;
+
+    while (nbytes > 0) {
+        unsigned int head = sendRing->head;
+        unsigned int tail = __atomic_load_n(&sendRing->tail, __ATOMIC_ACQUIRE);
+        unsigned int space = capacity - (head - tail);
+        if (space == 0) {
+            if (waitForChange(header, &sendRing->tail, tail, &sendRing->tailWaiters) < 0) {
+                opserr << "SharedMemoryChannel::writeBytes() - channel closed\n";
+                return -1;
+            }
+            continue;
+        }
+
+        unsigned int offset = head & (capacity-1);
+        size_t count = capacity - offset;
+        if (count > space)
+            count = space;
+        if (count > nbytes)
+            count = nbytes;
+
+        memcpy(sendData + offset, data, count);
+        __atomic_store_n(&sendRing->head, head + (unsigned int)count, __ATOMIC_SEQ_CST);
+        notifyChange(&sendRing->head, &sendRing->headWaiters);
+
+        data += count;
+        nbytes -= count;
+    }
+
+    return 0;
+}
+
+
+int
+SharedMemoryChannel::readBytes(char *data, size_t nbytes)
+{
+    if (header == 0)
+        return -1;
+
+    while (nbytes > 0) {
+        unsigned int tail = recvRing->tail;
+        unsigned int head = __atomic_load_n(&recvRing->head, __ATOMIC_ACQUIRE);
+        unsigned int avail = head - tail;
+        if (avail == 0) {
+            if (waitForChange(header, &recvRing->head, head, &recvRing->headWaiters) < 0) {
+                opserr << "SharedMemoryChannel::readBytes() - channel closed\n";
+                return -1;
+            }
+            continue;
+        }
+
+        unsigned int offset = tail & (capacity-1);
+        size_t count = capacity - offset;
+        if (count > avail)
+            count = avail;
+        if (count > nbytes)
+            count = nbytes;
+
+        memcpy(data, recvData + offset, count);
+        __atomic_store_n(&recvRing->tail, tail + (unsigned int)count, __ATOMIC_SEQ_CST);
+        notifyChange(&recvRing->tail, &recvRing->tailWaiters);
+
+        data += count;
+        nbytes -= count;
+    }
+
+    return 0;
+}
+
+
+int 
+SharedMemoryChannel::sendObj(int commitTag,
+    MovableObject &theObject, ChannelAddress *theAddress) 
+{
+    return theObject.sendSelf(commitTag, *this);
+}
+
+
+int 
+SharedMemoryChannel::recvObj(int commitTag,
+    MovableObject &theObject, FEM_ObjectBroker &theBroker, 
+    ChannelAddress *theAddress)
+{
+    return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int 
+SharedMemoryChannel::recvMsg(int dbTag, int commitTag,
+    Message &msg, ChannelAddress *theAddress)
+{	
+    return this->readBytes(msg.data, msg.length);
+}
+
+
+int 
+SharedMemoryChannel::sendMsg(int dbTag, int commitTag,
+    const Message &msg, ChannelAddress *theAddress)
+{	
+    return this->writeBytes(msg.data, msg.length);
+}
+
+
+int 
+SharedMemoryChannel::recvMatrix(int dbTag, int commitTag,
+    Matrix &theMatrix, ChannelAddress *theAddress)
+{	
+    return this->readBytes((char *)theMatrix.data, theMatrix.dataSize * sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::sendMatrix(int dbTag, int commitTag,
+    const Matrix &theMatrix, ChannelAddress *theAddress)
+{	
+    return this->writeBytes((const char *)theMatrix.data, theMatrix.dataSize * sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::recvVector(int dbTag, int commitTag,
+    Vector &theVector, ChannelAddress *theAddress)
+{	
+    return this->readBytes((char *)theVector.theData, theVector.sz * sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::sendVector(int dbTag, int commitTag,
+    const Vector &theVector, ChannelAddress *theAddress)
+{	
+    return this->writeBytes((const char *)theVector.theData, theVector.sz * sizeof(double));
+}
+
+
+int 
+SharedMemoryChannel::recvID(int dbTag, int commitTag,
+    ID &theID, ChannelAddress *theAddress)
+{	
+    return this->readBytes((char *)theID.data, theID.sz * sizeof(int));
+}
+
+
+int 
+SharedMemoryChannel::sendID(int dbTag, int commitTag,
+    const ID &theID, ChannelAddress *theAddress)
+{	
+    return this->writeBytes((const char *)theID.data, theID.sz * sizeof(int));
+}
+
+
+char *
+SharedMemoryChannel::addToProgram()
+{
+    char *newStuff =(char *)malloc(30*sizeof(char));
+    snprintf(newStuff, 30, " 4 %u ", myPort);
+
+    return newStuff;
+}
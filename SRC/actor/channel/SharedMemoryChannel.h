@@ -0,0 +1,115 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Purpose: This file contains the class definition for SharedMemoryChannel.
+// SharedMemoryChannel is a sub-class of channel for two processes on the
+// same host. The processes share a POSIX shared memory segment holding a
+// ring buffer for each direction; a waiting process sleeps on a futex
+// (Linux) or yields (other POSIX systems). Like a TCP_Socket it connects
+// exactly one pair of processes: the one constructed with a port only
+// creates the segment and waits, the one constructed with a port and an
+// address attaches to it. The data of a Vector, Matrix, ID or Message is
+// copied directly between the object and the ring, without any
+// intermediate buffer or system call.
+
+#ifndef SharedMemoryChannel_h
+#define SharedMemoryChannel_h
+
+#include <Channel.h>
+#include <stddef.h>
+
+struct SharedMemoryHeader;
+struct SharedMemoryRing;
+
+class SharedMemoryChannel : public Channel
+{
+  public:
+    SharedMemoryChannel(unsigned int port, int bufferSize = 0);
+    SharedMemoryChannel(unsigned int other_Port, const char *other_InetAddr,
+        int bufferSize = 0);
+    ~SharedMemoryChannel();
+
+    char *addToProgram();
+    
+    virtual int setUpConnection();
+
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    virtual ChannelAddress *getLastSendersAddress(){ return 0;};
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+		
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag, 
+	       const ID &theID, 
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, 
+	       ID &theID, 
+	       ChannelAddress *theAddress =0);    
+    
+  private:
+    int mapSegment(void);
+    void unmapSegment(void);
+    int writeBytes(const char *data, size_t nbytes);
+    int readBytes(char *data, size_t nbytes);
+
+    char shmName[32];
+    int shmFd;
+    void *shmBase;
+    size_t shmSize;
+    unsigned int capacity;
+
+    SharedMemoryHeader *header;
+    SharedMemoryRing *sendRing;
+    SharedMemoryRing *recvRing;
+    char *sendData;
+    char *recvData;
+
+    unsigned int myPort;
+    int connectType;
+    bool unlinked;
+};
+
+#endif
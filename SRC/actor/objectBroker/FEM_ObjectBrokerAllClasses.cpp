@@ -552,6 +552,8 @@
 #include "EnvelopeNodeRecorder.h"
 #include "EnvelopeElementRecorder.h"
 #include "DriftRecorder.h"
+#include "ElementRecorderRainflow.h"
+#include "StatisticsRecorder.h"
 #ifdef _HDF5
 #include "MPCORecorder.h"
 #endif // _HDF5
@@ -2710,6 +2712,12 @@ FEM_ObjectBrokerAllClasses::getPtrNewRecorder(int classTag)
 
         case RECORDER_TAGS_GmshRecorder:
            return new GmshRecorder();
+
+	case RECORDER_TAGS_ElementRecorderRainflow:
+	     return new ElementRecorderRainflow();
+
+	case RECORDER_TAGS_StatisticsRecorder:
+	     return new StatisticsRecorder();
 #ifdef _HDF5
 	case RECORDER_TAGS_MPCORecorder:
 	  return new MPCORecorder();
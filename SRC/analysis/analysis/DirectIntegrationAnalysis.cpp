@@ -55,6 +55,8 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <SolutionStrategy.h>
+#include <PhaseTimer.h>
 
 // Constructor
 //    sets theModel and theSysOFEqn to 0 and the Algorithm to the one supplied
@@ -80,7 +82,8 @@ DirectIntegrationAnalysis::DirectIntegrationAnalysis(Domain &the_Domain,
  theTest(theConvergenceTest),
  domainStamp(0),
  numSubLevels(num_SubLevels),
- numSubSteps(num_SubSteps)
+ numSubSteps(num_SubSteps),
+ theStrategy(0)
 {
   // first we set up the links needed by the elements in the 
   // aggregation
@@ -103,6 +106,9 @@ DirectIntegrationAnalysis::~DirectIntegrationAnalysis()
   // we don't invoke the destructors in case user switching
   // from a static to a direct integration analysis 
   // clearAll() must be invoked if user wishes to invoke destructor
+  // the strategy belongs to this analysis only
+  if (theStrategy != 0)
+    delete theStrategy;
 }    
 
 void
@@ -125,7 +131,8 @@ DirectIntegrationAnalysis::clearAll(void)
     delete theEigenSOE;
   if (theTest != 0)
     delete theTest;
-
+  if (theStrategy != 0)
+    delete theStrategy;
 
     theAnalysisModel =0;
     theConstraintHandler =0;
@@ -135,6 +142,7 @@ DirectIntegrationAnalysis::clearAll(void)
     theSOE =0;
     theEigenSOE =0;
     theTest =0;
+    theStrategy =0;
 }    
 
 #include <NodeIter.h>
@@ -169,7 +177,17 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT, bool flush)
 {
   int result = 0;
 
+  if (theStrategy != 0)
+    theStrategy->startAnalysis();
+
   for (int i=0; i<numSteps; i++) {
+    if (theStrategy != 0) {
+      // the strategy replaces the sub-levels
+      result = this->analyzeStrategyStep(dT);
+      if (result < 0)
+	return result;
+      continue;
+    }
     result = this->analyzeStep(dT);
     if (result < 0) {
       if (numSubLevels != 0)
@@ -281,6 +299,66 @@ DirectIntegrationAnalysis::analyzeSubLevel(int level, double dT) {
   return result;
 }
 
+int
+DirectIntegrationAnalysis::analyzeStrategyStep(double dT)
+{
+  // the analysis' own algorithm and test are rung 0
+  EquiSolnAlgo *analysisAlgorithm = theAlgorithm;
+  ConvergenceTest *analysisTest = theTest;
+  Domain *the_Domain = this->getDomainPtr();
+
+  // time of the step not yet done, a rung divides it into its substeps
+  double remaining = dT;
+
+  int result = -3;
+  int rung = theStrategy->getStartRung();
+  int numRungs = theStrategy->getNumRungs();
+  for ( ; rung < numRungs; rung++) {
+    this->useRung(rung, analysisAlgorithm, analysisTest);
+
+    int numSub = theStrategy->getNumSubSteps(rung);
+    double stepDT = remaining/numSub;
+    for (int i=0; i<numSub; i++) {
+      result = this->analyzeStep(stepDT);
+      if (result < 0)
+	break;
+      remaining -= stepDT;
+    }
+    if (result >= 0 || result == -1)
+      break;
+  }
+
+  this->useRung(0, analysisAlgorithm, analysisTest);
+
+  if (result < 0)
+    theStrategy->stepFailed(the_Domain->getCurrentTime());
+  else
+    theStrategy->stepDone(rung, the_Domain->getCurrentTime());
+
+  return result;
+}
+
+void
+DirectIntegrationAnalysis::useRung(int rung, EquiSolnAlgo *analysisAlgorithm, ConvergenceTest *analysisTest)
+{
+  theAlgorithm = theStrategy->getAlgorithm(rung);
+  if (theAlgorithm == 0)
+    theAlgorithm = analysisAlgorithm;
+  theTest = theStrategy->getConvergenceTest(rung);
+  if (theTest == 0)
+    theTest = analysisTest;
+
+  // relinking does not touch the AnalysisModel or the LinearSOE
+  theIntegrator->setLinks(*theAnalysisModel, *theSOE, theTest);
+  theAlgorithm->setLinks(*theAnalysisModel, *theIntegrator, *theSOE, theTest);
+
+  // an algorithm that was idle when the domain changed is brought up to date
+  if (domainStamp != 0 && !theStrategy->isUpToDate(theAlgorithm, domainStamp)) {
+    theAlgorithm->domainChanged();
+    theStrategy->setUpToDate(theAlgorithm, domainStamp);
+  }
+}
+
 int 
 DirectIntegrationAnalysis::eigen(int numMode, bool generalized, bool findSmallest)
 {
@@ -311,6 +389,7 @@ DirectIntegrationAnalysis::eigen(int numMode, bool generalized, bool findSmalles
     //
     // zero A and M
     //
+    PhaseTimer theAssemblyTimer(PhaseTimer::Assembly);
     theEigenSOE->zeroA();
     theEigenSOE->zeroM();
 
@@ -366,7 +445,11 @@ DirectIntegrationAnalysis::eigen(int numMode, bool generalized, bool findSmalles
     // solve for the eigen values & vectors
     //
 
-    if (theEigenSOE->solve(numMode, generalized, findSmallest) < 0) {
+    {
+      PhaseTimer theSolveTimer(PhaseTimer::Factorization);
+      result = theEigenSOE->solve(numMode, generalized, findSmallest);
+    }
+    if (result < 0) {
 	opserr << "WARNING DirectIntegrationAnalysis::eigen() - EigenSOE failed in solve()\n";
 	return -4;
     }
@@ -391,6 +474,7 @@ DirectIntegrationAnalysis::eigen(int numMode, bool generalized, bool findSmalles
 int
 DirectIntegrationAnalysis::domainChanged(void)
 {
+    PhaseTimer theSetupTimer(PhaseTimer::Setup);
     Domain *the_Domain = this->getDomainPtr();
     int stamp = the_Domain->hasDomainChanged();
     domainStamp = stamp;
@@ -406,7 +490,10 @@ DirectIntegrationAnalysis::domainChanged(void)
     // we now invoke number() on the numberer which causes
     // equation numbers to be assigned to all the DOFs in the
     // AnalysisModel.
-    theDOF_Numberer->numberDOF();
+    {
+      PhaseTimer theNumberingTimer(PhaseTimer::Numbering);
+      theDOF_Numberer->numberDOF();
+    }
 
     theConstraintHandler->doneNumberingDOF();
 
@@ -435,6 +522,8 @@ DirectIntegrationAnalysis::domainChanged(void)
     // we invoke domainChange() on the integrator and algorithm
     theIntegrator->domainChanged();
     theAlgorithm->domainChanged();
+    if (theStrategy != 0)
+      theStrategy->setUpToDate(theAlgorithm, domainStamp);
 
     return 0;
 }    
@@ -471,8 +560,11 @@ DirectIntegrationAnalysis::setAlgorithm(EquiSolnAlgo &theNewAlgorithm)
     theAlgorithm->setLinks(*theAnalysisModel, *theIntegrator, *theSOE, theTest);
   // invoke domainChanged() either indirectly or directly
   // domainStamp = 0;
-  if (domainStamp != 0)
+  if (domainStamp != 0) {
     theAlgorithm->domainChanged();
+    if (theStrategy != 0)
+      theStrategy->setUpToDate(theAlgorithm, domainStamp);
+  }
 
   return 0;
 }
@@ -613,6 +705,25 @@ DirectIntegrationAnalysis::getConvergenceTest(void)
   return theTest;
 }
 
+int
+DirectIntegrationAnalysis::setSolutionStrategy(SolutionStrategy *theNewStrategy)
+{
+  if (theStrategy != 0)
+    delete theStrategy;
+
+  theStrategy = theNewStrategy;
+  if (theStrategy != 0 && domainStamp != 0 && theAlgorithm != 0)
+    theStrategy->setUpToDate(theAlgorithm, domainStamp);
+
+  return 0;
+}
+
+SolutionStrategy *
+DirectIntegrationAnalysis::getSolutionStrategy(void)
+{
+  return theStrategy;
+}
+
 
 
 
@@ -47,6 +47,7 @@ class LinearSOE;
 class EquiSolnAlgo;
 class ConvergenceTest;
 class EigenSOE;
+class SolutionStrategy;
 
 class DirectIntegrationAnalysis: public TransientAnalysis
 {
@@ -80,6 +81,7 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     int setLinearSOE(LinearSOE &theSOE); 
     int setConvergenceTest(ConvergenceTest &theTest);
     int setEigenSOE(EigenSOE &theSOE);
+    int setSolutionStrategy(SolutionStrategy *theStrategy);
     
     int checkDomainChange(void);
 
@@ -87,10 +89,14 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     TransientIntegrator *getIntegrator(void);
     ConvergenceTest     *getConvergenceTest(void); 
     AnalysisModel       *getModel(void) ;
+    SolutionStrategy    *getSolutionStrategy(void);
 
   protected:
     
   private:
+    int analyzeStrategyStep(double dT);
+    void useRung(int rung, EquiSolnAlgo *analysisAlgorithm, ConvergenceTest *analysisTest);
+
     ConstraintHandler 	*theConstraintHandler;    
     DOF_Numberer 	*theDOF_Numberer;
     AnalysisModel 	*theAnalysisModel;
@@ -103,6 +109,7 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     int domainStamp;
     int numSubLevels;
     int numSubSteps;
+    SolutionStrategy    *theStrategy;
 
 
 };
@@ -0,0 +1,518 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of HarmonicAnalysis.
+//
+// What: "@(#) HarmonicAnalysis.cpp, revA"
+
+#include <HarmonicAnalysis.h>
+#include <AnalysisModel.h>
+#include <ConstraintHandler.h>
+#include <DOF_Numberer.h>
+#include <Domain.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <elementAPI.h>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cmath>
+#include <cstring>
+
+extern "C" {
+#include <cs.h>
+}
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+
+	struct Triplet {
+		int row;
+		int col;
+		double k, m, c;
+		bool operator < (const Triplet& other) const {
+			return col < other.col || (col == other.col && row < other.row);
+		}
+	};
+
+	void scatter(std::vector<Triplet>& triplets, const ID& id, const Matrix& A, int which) {
+		int n = id.Size();
+		for (int j = 0; j < n; ++j) {
+			int col = id(j);
+			if (col < 0) continue;
+			for (int i = 0; i < n; ++i) {
+				int row = id(i);
+				if (row < 0) continue;
+				double value = A(i, j);
+				if (value == 0.0) continue;
+				Triplet t = { row, col, 0.0, 0.0, 0.0 };
+				if (which == 0) t.k = value;
+				else if (which == 1) t.m = value;
+				else t.c = value;
+				triplets.push_back(t);
+			}
+		}
+	}
+
+}
+
+int
+OPS_HarmonicAnalysis(void)
+{
+	// harmonicAnalysis -freq $f1 $f2 ... | -freqRange $fmin $fmax $n <-log>
+	//                  <-structuralDamping $eta>
+	//                  <-output complex|real|imag|amplitude|phase>
+
+	AnalysisModel** theModel = OPS_GetAnalysisModel();
+	ConstraintHandler** theHandler = OPS_GetHandler();
+	DOF_Numberer** theNumberer = OPS_GetNumberer();
+	if (theModel == nullptr || *theModel == nullptr ||
+		theHandler == nullptr || *theHandler == nullptr ||
+		theNumberer == nullptr || *theNumberer == nullptr) {
+		opserr << "HarmonicAnalysis Error: define an analysis first, its constraint handler and numberer are used.\n";
+		return -1;
+	}
+	if ((*theModel)->getDomainPtr() == nullptr) {
+		opserr << "HarmonicAnalysis Error: no Domain available.\n";
+		return -1;
+	}
+
+	std::vector<double> freqs;
+	double eta = 0.0;
+	HarmonicAnalysis::OutputType output = HarmonicAnalysis::Complex;
+	int numData = 1;
+
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+		const char* value = OPS_GetString();
+		if (strcmp(value, "-freq") == 0) {
+			while (OPS_GetNumRemainingInputArgs() > 0) {
+				double item;
+				if (OPS_GetDoubleInput(&numData, &item) < 0) {
+					OPS_ResetCurrentInputArg(-1);
+					break;
+				}
+				freqs.push_back(item);
+			}
+		}
+		else if (strcmp(value, "-freqRange") == 0) {
+			double range[2];
+			int n = 0;
+			int two = 2;
+			if (OPS_GetNumRemainingInputArgs() < 3 ||
+				OPS_GetDoubleInput(&two, range) < 0 ||
+				OPS_GetIntInput(&numData, &n) < 0 || n < 1) {
+				opserr << "HarmonicAnalysis Error: -freqRange $fmin $fmax $n expected.\n";
+				return -1;
+			}
+			bool logSpacing = false;
+			if (OPS_GetNumRemainingInputArgs() > 0) {
+				if (strcmp(OPS_GetString(), "-log") == 0)
+					logSpacing = true;
+				else
+					OPS_ResetCurrentInputArg(-1);
+			}
+			if (logSpacing && (range[0] <= 0.0 || range[1] <= 0.0)) {
+				opserr << "HarmonicAnalysis Error: -log needs positive frequencies.\n";
+				return -1;
+			}
+			for (int i = 0; i < n; ++i) {
+				double r = (n > 1) ? double(i) / double(n - 1) : 0.0;
+				if (logSpacing)
+					freqs.push_back(range[0] * std::pow(range[1] / range[0], r));
+				else
+					freqs.push_back(range[0] + r * (range[1] - range[0]));
+			}
+		}
+		else if (strcmp(value, "-structuralDamping") == 0) {
+			if (OPS_GetDoubleInput(&numData, &eta) < 0) {
+				opserr << "HarmonicAnalysis Error: Failed to get the structural damping ratio.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-output") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1) {
+				opserr << "HarmonicAnalysis Error: -output requested but not provided.\n";
+				return -1;
+			}
+			const char* type = OPS_GetString();
+			if (strcmp(type, "complex") == 0) output = HarmonicAnalysis::Complex;
+			else if (strcmp(type, "real") == 0) output = HarmonicAnalysis::Real;
+			else if (strcmp(type, "imag") == 0) output = HarmonicAnalysis::Imaginary;
+			else if (strcmp(type, "amplitude") == 0) output = HarmonicAnalysis::Amplitude;
+			else if (strcmp(type, "phase") == 0) output = HarmonicAnalysis::Phase;
+			else {
+				opserr << "HarmonicAnalysis Error: unknown output type " << type << ".\n";
+				return -1;
+			}
+		}
+		else {
+			opserr << "HarmonicAnalysis Error: unknown option " << value << ".\n";
+			return -1;
+		}
+	}
+
+	if (freqs.size() == 0) {
+		opserr << "HarmonicAnalysis Error: no frequencies given, use -freq or -freqRange.\n";
+		return -1;
+	}
+	for (double f : freqs) {
+		if (f < 0.0) {
+			opserr << "HarmonicAnalysis Error: frequencies must be positive (found " << f << ").\n";
+			return -1;
+		}
+	}
+
+	// like the response spectrum analysis, no need to store it
+	HarmonicAnalysis theAnalysis(*theModel, *theHandler, *theNumberer, freqs, eta, output);
+	return theAnalysis.analyze();
+}
+
+HarmonicAnalysis::HarmonicAnalysis(
+	AnalysisModel* theModel,
+	ConstraintHandler* theHandler,
+	DOF_Numberer* theNumberer,
+	const std::vector<double>& frequencies,
+	double structuralDamping,
+	OutputType output
+)
+	: m_model(theModel)
+	, m_handler(theHandler)
+	, m_numberer(theNumberer)
+	, m_frequencies(frequencies)
+	, m_eta(structuralDamping)
+	, m_output(output)
+	, m_neq(0)
+{
+
+}
+
+HarmonicAnalysis::~HarmonicAnalysis()
+{
+}
+
+int HarmonicAnalysis::analyze()
+{
+	// number the model, as any analysis does when the domain changes
+	m_model->clearAll();
+	m_handler->clearAll();
+	if (m_handler->handle() < 0) {
+		opserr << "HarmonicAnalysis::analyze() - ConstraintHandler::handle() failed\n";
+		return -1;
+	}
+	if (m_numberer->numberDOF() < 0) {
+		opserr << "HarmonicAnalysis::analyze() - DOF_Numberer::numberDOF() failed\n";
+		return -1;
+	}
+	if (m_handler->doneNumberingDOF() < 0) {
+		opserr << "HarmonicAnalysis::analyze() - ConstraintHandler::doneNumberingDOF() failed\n";
+		return -1;
+	}
+
+	m_neq = m_model->getNumEqn();
+	if (m_neq < 1) {
+		opserr << "HarmonicAnalysis::analyze() - no equations\n";
+		return -1;
+	}
+
+	int error_code = formMatrices();
+	if (error_code < 0) return error_code;
+
+	Vector F(m_neq);
+	error_code = formLoad(F);
+	if (error_code < 0) return error_code;
+
+	// real 2x2 block form of the complex matrix on the union pattern:
+	// [ Kr -Ki ] [ Ur ]   [ F ]
+	// [ Ki  Kr ] [ Ui ] = [ 0 ]
+	// with Kr = K - w^2 M and Ki = eta K + w C
+	int n = m_neq;
+	int nnz = m_colPtr[n];
+	cs* A = cs_spalloc(2 * n, 2 * n, 4 * nnz, 1, 0);
+	if (A == nullptr) {
+		opserr << "HarmonicAnalysis::analyze() - out of memory\n";
+		return -1;
+	}
+	for (int j = 0; j < n; ++j) {
+		int len = m_colPtr[j + 1] - m_colPtr[j];
+		A->p[j] = 2 * m_colPtr[j];
+		A->p[n + j] = 2 * nnz + 2 * m_colPtr[j];
+		for (int k = 0; k < len; ++k) {
+			int row = m_rowInd[m_colPtr[j] + k];
+			A->i[A->p[j] + k] = row;
+			A->i[A->p[j] + len + k] = row + n;
+			A->i[A->p[n + j] + k] = row;
+			A->i[A->p[n + j] + len + k] = row + n;
+		}
+	}
+	A->p[2 * n] = 4 * nnz;
+
+	// ordering and symbolic analysis, shared by all frequencies
+	css* S = cs_sqr(1, A, 0);
+	if (S == nullptr) {
+		opserr << "HarmonicAnalysis::analyze() - symbolic analysis failed\n";
+		cs_spfree(A);
+		return -1;
+	}
+
+	Vector b(2 * n), x(2 * n);
+	Vector Ur(n), Ui(n), U(n), V(n), Acc(n);
+	for (std::size_t ifreq = 0; ifreq < m_frequencies.size() && error_code == 0; ++ifreq) {
+		double freq = m_frequencies[ifreq];
+		double w = 2.0 * M_PI * freq;
+
+		// numeric values for this frequency
+		for (int j = 0; j < n; ++j) {
+			int len = m_colPtr[j + 1] - m_colPtr[j];
+			for (int k = 0; k < len; ++k) {
+				int pos = m_colPtr[j] + k;
+				double kr = m_K[pos] - w * w * m_M[pos];
+				double ki = m_eta * m_K[pos] + w * m_C[pos];
+				A->x[A->p[j] + k] = kr;
+				A->x[A->p[j] + len + k] = ki;
+				A->x[A->p[n + j] + k] = -ki;
+				A->x[A->p[n + j] + len + k] = kr;
+			}
+		}
+
+		csn* N = cs_lu(A, S, 1.0);
+		if (N == nullptr) {
+			opserr << "HarmonicAnalysis::analyze() - singular system at frequency " << freq << "\n";
+			error_code = -1;
+			break;
+		}
+
+		b.Zero();
+		for (int i = 0; i < n; ++i)
+			b(i) = F(i);
+		double* b_ptr = &b(0);
+		double* x_ptr = &x(0);
+		cs_ipvec(N->pinv, b_ptr, x_ptr, 2 * n);
+		cs_lsolve(N->L, x_ptr);
+		cs_usolve(N->U, x_ptr);
+		cs_ipvec(S->q, x_ptr, b_ptr, 2 * n);
+		cs_nfree(N);
+
+		for (int i = 0; i < n; ++i) {
+			Ur(i) = b(i);
+			Ui(i) = b(n + i);
+		}
+
+		// U, V = i w U and A = -w^2 U, reduced to what is recorded
+		int numParts = (m_output == Complex) ? 2 : 1;
+		for (int part = 0; part < numParts && error_code == 0; ++part) {
+			for (int i = 0; i < n; ++i) {
+				double ur = Ur(i), ui = Ui(i);
+				double vr = -w * ui, vi = w * ur;
+				double ar = -w * w * ur, ai = -w * w * ui;
+				switch (m_output) {
+				case Complex:
+					U(i) = part == 0 ? ur : ui;
+					V(i) = part == 0 ? vr : vi;
+					Acc(i) = part == 0 ? ar : ai;
+					break;
+				case Real:
+					U(i) = ur; V(i) = vr; Acc(i) = ar;
+					break;
+				case Imaginary:
+					U(i) = ui; V(i) = vi; Acc(i) = ai;
+					break;
+				case Amplitude:
+					U(i) = std::sqrt(ur * ur + ui * ui);
+					V(i) = std::sqrt(vr * vr + vi * vi);
+					Acc(i) = std::sqrt(ar * ar + ai * ai);
+					break;
+				case Phase:
+					U(i) = std::atan2(ui, ur);
+					V(i) = std::atan2(vi, vr);
+					Acc(i) = std::atan2(ai, ar);
+					break;
+				}
+			}
+			error_code = recordStep(freq, U, V, Acc);
+		}
+	}
+
+	cs_sfree(S);
+	cs_spfree(A);
+
+	// the responses are only recorded, never committed: the domain goes
+	// back to its committed state (e.g. after gravity) and time
+	if (m_model->getDomainPtr()->revertToLastCommit() < 0) {
+		opserr << "HarmonicAnalysis::analyze() - the domain failed in revertToLastCommit\n";
+		if (error_code == 0)
+			error_code = -1;
+	}
+
+	return error_code;
+}
+
+int HarmonicAnalysis::formMatrices()
+{
+	std::vector<Triplet> triplets;
+
+	// elements
+	FE_EleIter& theEles = m_model->getFEs();
+	FE_Element* elePtr;
+	while ((elePtr = theEles()) != 0) {
+		const ID& id = elePtr->getID();
+		elePtr->zeroTangent();
+		elePtr->addKtToTang(1.0);
+		scatter(triplets, id, elePtr->getTangent(0), 0);
+		// the penalty and Lagrange FEs of the constraints ignore the add*
+		// calls and always return their constraint matrix, it goes in K only
+		if (elePtr->getElement() == 0)
+			continue;
+		elePtr->zeroTangent();
+		elePtr->addMtoTang(1.0);
+		scatter(triplets, id, elePtr->getTangent(0), 1);
+		elePtr->zeroTangent();
+		elePtr->addCtoTang(1.0);
+		scatter(triplets, id, elePtr->getTangent(0), 2);
+	}
+
+	// nodal mass and damping
+	DOF_GrpIter& theDofs = m_model->getDOFs();
+	DOF_Group* dofPtr;
+	while ((dofPtr = theDofs()) != 0) {
+		const ID& id = dofPtr->getID();
+		dofPtr->zeroTangent();
+		dofPtr->addMtoTang(1.0);
+		scatter(triplets, id, dofPtr->getTangent(0), 1);
+		dofPtr->zeroTangent();
+		dofPtr->addCtoTang(1.0);
+		scatter(triplets, id, dofPtr->getTangent(0), 2);
+	}
+
+	// sort by column then row and sum duplicates into the union pattern
+	std::sort(triplets.begin(), triplets.end());
+
+	int n = m_neq;
+	m_colPtr.assign(n + 1, 0);
+	m_rowInd.clear();
+	m_K.clear();
+	m_M.clear();
+	m_C.clear();
+	m_rowInd.reserve(triplets.size());
+	m_K.reserve(triplets.size());
+	m_M.reserve(triplets.size());
+	m_C.reserve(triplets.size());
+
+	// keep the diagonal in the pattern even if empty
+	std::vector<Triplet> diagonal(n);
+	for (int i = 0; i < n; ++i) {
+		Triplet t = { i, i, 0.0, 0.0, 0.0 };
+		diagonal[i] = t;
+	}
+	std::vector<Triplet> all;
+	all.reserve(triplets.size() + n);
+	std::merge(triplets.begin(), triplets.end(), diagonal.begin(), diagonal.end(), std::back_inserter(all));
+
+	int lastRow = -1, lastCol = -1;
+	for (const Triplet& t : all) {
+		if (t.row == lastRow && t.col == lastCol) {
+			m_K.back() += t.k;
+			m_M.back() += t.m;
+			m_C.back() += t.c;
+			continue;
+		}
+		m_rowInd.push_back(t.row);
+		m_K.push_back(t.k);
+		m_M.push_back(t.m);
+		m_C.push_back(t.c);
+		m_colPtr[t.col + 1]++;
+		lastRow = t.row;
+		lastCol = t.col;
+	}
+	for (int j = 0; j < n; ++j)
+		m_colPtr[j + 1] += m_colPtr[j];
+
+	return 0;
+}
+
+int HarmonicAnalysis::formLoad(Vector& F)
+{
+	// the load amplitude is the unbalanced load of the current state, so a
+	// harmonic pattern added after a converged static analysis is all that
+	// is applied
+	m_model->applyLoadDomain(m_model->getCurrentDomainTime());
+
+	F.Zero();
+
+	FE_EleIter& theEles = m_model->getFEs();
+	FE_Element* elePtr;
+	while ((elePtr = theEles()) != 0) {
+		elePtr->zeroResidual();
+		elePtr->addRtoResidual(1.0);
+		if (F.Assemble(elePtr->getResidual(0), elePtr->getID()) < 0) {
+			opserr << "HarmonicAnalysis::formLoad() - failed to assemble the element loads\n";
+			return -1;
+		}
+	}
+
+	DOF_GrpIter& theDofs = m_model->getDOFs();
+	DOF_Group* dofPtr;
+	while ((dofPtr = theDofs()) != 0) {
+		dofPtr->zeroUnbalance();
+		dofPtr->addPtoUnbalance(1.0);
+		if (F.Assemble(dofPtr->getUnbalance(0), dofPtr->getID()) < 0) {
+			opserr << "HarmonicAnalysis::formLoad() - failed to assemble the nodal loads\n";
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int HarmonicAnalysis::recordStep(double freq, const Vector& U, const Vector& V, const Vector& A)
+{
+	m_model->setCurrentDomainTime(freq);
+
+	if (m_model->analysisStep() < 0) {
+		opserr << "HarmonicAnalysis::analyze() - the AnalysisModel failed"
+			" at frequency " << freq << "\n";
+		return -1;
+	}
+
+	// the elements see the response as a trial state so that their
+	// recorders can use it, it is not committed
+	m_model->setResponse(U, V, A);
+
+	if (m_model->updateDomain() < 0) {
+		opserr << "HarmonicAnalysis::analyze() - the AnalysisModel failed in updateDomain"
+			" at frequency " << freq << "\n";
+		return -1;
+	}
+
+	if (m_model->getDomainPtr()->record() < 0) {
+		opserr << "HarmonicAnalysis::analyze() - the recorders failed"
+			" at frequency " << freq << "\n";
+		return -1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,97 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for HarmonicAnalysis.
+// HarmonicAnalysis computes the steady-state response of the linearized
+// model to harmonic loading, directly in the frequency domain:
+//
+//   (K (1 + i eta) - w^2 M + i w C) U = F
+//
+// K, M and C are assembled once from the FE_Elements and DOF_Groups of the
+// AnalysisModel; the matrices of the constraint FEs of the penalty and
+// Lagrange handlers go into K only. F is the unbalanced load of the
+// current state. The complex system is solved in its real 2x2 block
+// form with a sparse LU (CSparse); the symbolic analysis (ordering and
+// pattern) is computed once and reused by every frequency of the sweep.
+// Each frequency is one (or two, for complex output) recorded step, with
+// the domain time set to the frequency, so that the response is recorded
+// by the usual recorders. The response is set as the trial state of the
+// domain but never committed; after the sweep the domain reverts to its
+// last committed state and time.
+//
+// What: "@(#) HarmonicAnalysis.h, revA"
+
+#ifndef HarmonicAnalysis_h
+#define HarmonicAnalysis_h
+
+#include <vector>
+
+class AnalysisModel;
+class ConstraintHandler;
+class DOF_Numberer;
+class Vector;
+
+class HarmonicAnalysis
+{
+public:
+	enum OutputType {
+		Complex = 0, // real part, then imaginary part
+		Real,
+		Imaginary,
+		Amplitude,
+		Phase
+	};
+
+	HarmonicAnalysis(
+		AnalysisModel* theModel,
+		ConstraintHandler* theHandler,
+		DOF_Numberer* theNumberer,
+		const std::vector<double>& frequencies,
+		double structuralDamping,
+		OutputType output
+	);
+	~HarmonicAnalysis();
+
+	int analyze();
+
+private:
+	int formMatrices();
+	int formLoad(Vector& F);
+	int recordStep(double freq, const Vector& U, const Vector& V, const Vector& A);
+
+private:
+	AnalysisModel* m_model;
+	ConstraintHandler* m_handler;
+	DOF_Numberer* m_numberer;
+	std::vector<double> m_frequencies;
+	double m_eta;
+	OutputType m_output;
+
+	// union pattern of K, M and C in compressed column form,
+	// with the three value arrays aligned to it
+	int m_neq;
+	std::vector<int> m_colPtr;
+	std::vector<int> m_rowInd;
+	std::vector<double> m_K;
+	std::vector<double> m_M;
+	std::vector<double> m_C;
+};
+
+#endif
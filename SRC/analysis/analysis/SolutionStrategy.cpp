@@ -0,0 +1,507 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of SolutionStrategy
+// and of the solutionStrategy command.
+
+#include <SolutionStrategy.h>
+#include <StaticAnalysis.h>
+#include <DirectIntegrationAnalysis.h>
+#include <IncrementalIntegrator.h>
+#include <EquiSolnAlgo.h>
+#include <Linear.h>
+#include <NewtonRaphson.h>
+#include <ModifiedNewton.h>
+#include <KrylovNewton.h>
+#include <BFGS.h>
+#include <Broyden.h>
+#include <NewtonLineSearch.h>
+#include <InitialInterpolatedLineSearch.h>
+#include <BisectionLineSearch.h>
+#include <SecantLineSearch.h>
+#include <RegulaFalsiLineSearch.h>
+#include <ConvergenceTest.h>
+#include <CTestNormDispIncr.h>
+#include <CTestNormUnbalance.h>
+#include <CTestEnergyIncr.h>
+#include <CTestRelativeNormDispIncr.h>
+#include <CTestRelativeNormUnbalance.h>
+#include <CTestRelativeEnergyIncr.h>
+#include <OPS_Globals.h>
+#include <elementAPI.h>
+#include <string.h>
+
+SolutionStrategy::SolutionStrategy(int numStay, bool printFlag)
+  :numStaySteps(numStay), verbose(printFlag), currentRung(0), stayLeft(0)
+{
+  // rung 0: the components of the analysis
+  theAlgorithms.push_back(0);
+  theTests.push_back(0);
+  numSubSteps.push_back(1);
+}
+
+SolutionStrategy::~SolutionStrategy()
+{
+  for (int i = 1; i < (int)theAlgorithms.size(); i++) {
+    if (theAlgorithms[i] != 0)
+      delete theAlgorithms[i];
+    if (theTests[i] != 0)
+      delete theTests[i];
+  }
+}
+
+int
+SolutionStrategy::addRung(EquiSolnAlgo *theAlgorithm, ConvergenceTest *theTest, int numSub)
+{
+  if (numSub < 1)
+    numSub = 1;
+
+  theAlgorithms.push_back(theAlgorithm);
+  theTests.push_back(theTest);
+  numSubSteps.push_back(numSub);
+
+  return (int)theAlgorithms.size() - 1;
+}
+
+void
+SolutionStrategy::setOptions(int numStay, bool printFlag)
+{
+  numStaySteps = numStay;
+  verbose = printFlag;
+}
+
+int
+SolutionStrategy::getNumRungs(void) const
+{
+  return (int)theAlgorithms.size();
+}
+
+EquiSolnAlgo *
+SolutionStrategy::getAlgorithm(int rung)
+{
+  if (rung < 0 || rung >= (int)theAlgorithms.size())
+    return 0;
+  return theAlgorithms[rung];
+}
+
+ConvergenceTest *
+SolutionStrategy::getConvergenceTest(int rung)
+{
+  if (rung < 0 || rung >= (int)theTests.size())
+    return 0;
+  return theTests[rung];
+}
+
+int
+SolutionStrategy::getNumSubSteps(int rung) const
+{
+  if (rung < 0 || rung >= (int)numSubSteps.size())
+    return 1;
+  return numSubSteps[rung];
+}
+
+void
+SolutionStrategy::startAnalysis(void)
+{
+  stepRungs.clear();
+}
+
+int
+SolutionStrategy::getStartRung(void) const
+{
+  return currentRung;
+}
+
+void
+SolutionStrategy::stepDone(int rung, double time)
+{
+  stepRungs.push_back(rung);
+
+  if (rung > currentRung) {
+    if (verbose)
+      opserr << "SolutionStrategy - step to time " << time << " converged on rung " << rung << endln;
+    stayLeft = numStaySteps;
+    currentRung = (stayLeft > 0) ? rung : 0;
+  } else if (stayLeft > 0) {
+    stayLeft--;
+    if (stayLeft == 0)
+      currentRung = 0;
+  }
+}
+
+void
+SolutionStrategy::stepFailed(double time)
+{
+  stepRungs.push_back(-1);
+
+  if (verbose)
+    opserr << "SolutionStrategy - step to time " << time << " failed on all rungs\n";
+
+  currentRung = 0;
+  stayLeft = 0;
+}
+
+const std::vector<int> &
+SolutionStrategy::getStepRungs(void) const
+{
+  return stepRungs;
+}
+
+bool
+SolutionStrategy::isUpToDate(EquiSolnAlgo *theAlgorithm, int domainStamp)
+{
+  std::map<EquiSolnAlgo *, int>::iterator it = algorithmStamps.find(theAlgorithm);
+  return it != algorithmStamps.end() && it->second == domainStamp;
+}
+
+void
+SolutionStrategy::setUpToDate(EquiSolnAlgo *theAlgorithm, int domainStamp)
+{
+  algorithmStamps[theAlgorithm] = domainStamp;
+}
+
+void
+SolutionStrategy::Print(OPS_Stream &s, int flag)
+{
+  s << "SolutionStrategy: " << (int)theAlgorithms.size()-1 << " fallback rung(s)";
+  s << ", stay " << numStaySteps << " step(s)\n";
+  for (int i = 1; i < (int)theAlgorithms.size(); i++) {
+    s << "  rung " << i << ": ";
+    if (theAlgorithms[i] != 0)
+      theAlgorithms[i]->Print(s, flag);
+    else
+      s << "analysis algorithm ";
+    s << " subSteps " << numSubSteps[i] << endln;
+  }
+}
+
+
+// Parsers of the algorithm and test of a rung. Unlike the algorithm and
+// test commands these only read the options that belong to them, so that
+// the rungs can follow each other on one command line.
+
+static bool
+nextIsFlag(const char *flag)
+{
+  if (OPS_GetNumRemainingInputArgs() < 1)
+    return false;
+  const char *next = OPS_GetString();
+  if (next != 0 && strcmp(next, flag) == 0)
+    return true;
+  OPS_ResetCurrentInputArg(-1);
+  return false;
+}
+
+static bool
+nextIsNumber(void)
+{
+  if (OPS_GetNumRemainingInputArgs() < 1)
+    return false;
+  // a number given to the python interpreter is not a string
+  const char *next = OPS_GetString();
+  OPS_ResetCurrentInputArg(-1);
+  return next == 0 || next[0] != '-' || (next[1] >= '0' && next[1] <= '9') || next[1] == '.';
+}
+
+static EquiSolnAlgo *
+parseRungAlgorithm(ConvergenceTest *theTest)
+{
+  if (OPS_GetNumRemainingInputArgs() < 1) {
+    opserr << "WARNING solutionStrategy -algorithm: type is missing\n";
+    return 0;
+  }
+  const char *type = OPS_GetString();
+  int numdata = 1;
+
+  if (strcmp(type, "Linear") == 0) {
+    int tangent = CURRENT_TANGENT;
+    int factorOnce = 0;
+    while (true) {
+      if (nextIsFlag("-initial"))
+	tangent = INITIAL_TANGENT;
+      else if (nextIsFlag("-factorOnce"))
+	factorOnce = 1;
+      else
+	break;
+    }
+    return new Linear(tangent, factorOnce);
+
+  } else if (strcmp(type, "Newton") == 0) {
+    int tangent = CURRENT_TANGENT;
+    while (true) {
+      if (nextIsFlag("-initial"))
+	tangent = INITIAL_TANGENT;
+      else if (nextIsFlag("-initialThenCurrent"))
+	tangent = INITIAL_THEN_CURRENT_TANGENT;
+      else
+	break;
+    }
+    return new NewtonRaphson(tangent);
+
+  } else if (strcmp(type, "ModifiedNewton") == 0) {
+    int tangent = CURRENT_TANGENT;
+    if (nextIsFlag("-initial"))
+      tangent = INITIAL_TANGENT;
+    return new ModifiedNewton(tangent);
+
+  } else if (strcmp(type, "KrylovNewton") == 0) {
+    int tangent = CURRENT_TANGENT;
+    int maxDim = 3;
+    while (true) {
+      if (nextIsFlag("-initial"))
+	tangent = INITIAL_TANGENT;
+      else if (nextIsFlag("-maxDim")) {
+	if (OPS_GetIntInput(&numdata, &maxDim) < 0) {
+	  opserr << "WARNING solutionStrategy KrylovNewton: invalid maxDim\n";
+	  return 0;
+	}
+      } else
+	break;
+    }
+    return new KrylovNewton(tangent, maxDim);
+
+  } else if (strcmp(type, "BFGS") == 0 || strcmp(type, "Broyden") == 0) {
+    int tangent = CURRENT_TANGENT;
+    int count = 10;
+    while (true) {
+      if (nextIsFlag("-initial"))
+	tangent = INITIAL_TANGENT;
+      else if (nextIsFlag("-count")) {
+	if (OPS_GetIntInput(&numdata, &count) < 0) {
+	  opserr << "WARNING solutionStrategy " << type << ": invalid count\n";
+	  return 0;
+	}
+      } else
+	break;
+    }
+    if (strcmp(type, "BFGS") == 0)
+      return new BFGS(tangent, count);
+    return new Broyden(tangent, count);
+
+  } else if (strcmp(type, "NewtonLineSearch") == 0) {
+    double tol = 0.8;
+    int typeSearch = 0;
+    while (true) {
+      if (nextIsFlag("-tol")) {
+	if (OPS_GetDoubleInput(&numdata, &tol) < 0) {
+	  opserr << "WARNING solutionStrategy NewtonLineSearch: invalid tol\n";
+	  return 0;
+	}
+      } else if (nextIsFlag("-type")) {
+	const char *searchType = OPS_GetString();
+	if (strcmp(searchType, "Bisection") == 0)
+	  typeSearch = 1;
+	else if (strcmp(searchType, "Secant") == 0)
+	  typeSearch = 2;
+	else if (strcmp(searchType, "RegulaFalsi") == 0 || strcmp(searchType, "LinearInterpolated") == 0)
+	  typeSearch = 3;
+	else
+	  typeSearch = 0;
+      } else
+	break;
+    }
+    if (theTest == 0) {
+      opserr << "WARNING solutionStrategy NewtonLineSearch: no ConvergenceTest\n";
+      return 0;
+    }
+    LineSearch *theLineSearch = 0;
+    if (typeSearch == 1)
+      theLineSearch = new BisectionLineSearch(tol);
+    else if (typeSearch == 2)
+      theLineSearch = new SecantLineSearch(tol);
+    else if (typeSearch == 3)
+      theLineSearch = new RegulaFalsiLineSearch(tol);
+    else
+      theLineSearch = new InitialInterpolatedLineSearch(tol);
+    return new NewtonLineSearch(*theTest, theLineSearch);
+  }
+
+  opserr << "WARNING solutionStrategy -algorithm: unknown or unsupported type " << type << endln;
+  return 0;
+}
+
+static ConvergenceTest *
+parseRungTest(void)
+{
+  if (OPS_GetNumRemainingInputArgs() < 3) {
+    opserr << "WARNING solutionStrategy -test type tol maxIter <printFlag> <normType>\n";
+    return 0;
+  }
+  const char *type = OPS_GetString();
+
+  int numdata = 1;
+  double tol;
+  int maxIter;
+  if (OPS_GetDoubleInput(&numdata, &tol) < 0 || OPS_GetIntInput(&numdata, &maxIter) < 0) {
+    opserr << "WARNING solutionStrategy -test " << type << ": invalid tol or maxIter\n";
+    return 0;
+  }
+  int printFlag = 0;
+  int normType = 2;
+  if (nextIsNumber()) {
+    if (OPS_GetIntInput(&numdata, &printFlag) < 0)
+      return 0;
+    if (nextIsNumber())
+      if (OPS_GetIntInput(&numdata, &normType) < 0)
+	return 0;
+  }
+
+  if (strcmp(type, "NormDispIncr") == 0)
+    return new CTestNormDispIncr(tol, maxIter, printFlag, normType);
+  else if (strcmp(type, "NormUnbalance") == 0)
+    return new CTestNormUnbalance(tol, maxIter, printFlag, normType);
+  else if (strcmp(type, "EnergyIncr") == 0)
+    return new CTestEnergyIncr(tol, maxIter, printFlag, normType);
+  else if (strcmp(type, "RelativeNormDispIncr") == 0)
+    return new CTestRelativeNormDispIncr(tol, maxIter, printFlag, normType);
+  else if (strcmp(type, "RelativeNormUnbalance") == 0)
+    return new CTestRelativeNormUnbalance(tol, maxIter, printFlag, normType);
+  else if (strcmp(type, "RelativeEnergyIncr") == 0)
+    return new CTestRelativeEnergyIncr(tol, maxIter, printFlag, normType);
+
+  opserr << "WARNING solutionStrategy -test: unknown or unsupported type " << type << endln;
+  return 0;
+}
+
+// solutionStrategy -rung <-algorithm type <opts>> <-test type tol maxIter <pFlag> <nType>> <-subSteps n>
+//                  <-rung ...> <-stay numSteps> <-verbose>
+// solutionStrategy -report
+// solutionStrategy -clear
+int OPS_SolutionStrategy()
+{
+  StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();
+  DirectIntegrationAnalysis **theTransientAnalysis = OPS_GetTransientAnalysis();
+  bool isStatic = (theStaticAnalysis != 0 && *theStaticAnalysis != 0);
+  bool isTransient = (theTransientAnalysis != 0 && *theTransientAnalysis != 0);
+  if (!isStatic && !isTransient) {
+    opserr << "WARNING solutionStrategy - define the analysis first\n";
+    return -1;
+  }
+
+  if (OPS_GetNumRemainingInputArgs() < 1) {
+    opserr << "WARNING insufficient args: solutionStrategy -rung ... | -report | -clear\n";
+    return -1;
+  }
+
+  const char *opt = OPS_GetString();
+  if (opt == 0) {
+    opserr << "WARNING solutionStrategy: option expected\n";
+    return -1;
+  }
+  if (strcmp(opt, "-clear") == 0) {
+    if (isStatic)
+      (*theStaticAnalysis)->setSolutionStrategy(0);
+    else
+      (*theTransientAnalysis)->setSolutionStrategy(0);
+    return 0;
+  }
+
+  if (strcmp(opt, "-report") == 0) {
+    SolutionStrategy *theStrategy = isStatic ? (*theStaticAnalysis)->getSolutionStrategy() :
+      (*theTransientAnalysis)->getSolutionStrategy();
+    std::vector<int> rungs;
+    if (theStrategy != 0)
+      rungs = theStrategy->getStepRungs();
+    int numdata = (int)rungs.size();
+    int dummy = 0;
+    if (OPS_SetIntOutput(&numdata, numdata > 0 ? &rungs[0] : &dummy, false) < 0) {
+      opserr << "WARNING solutionStrategy -report: failed to set output\n";
+      return -1;
+    }
+    return 0;
+  }
+  OPS_ResetCurrentInputArg(-1);
+
+  // the analysis' test, for algorithms that need one when constructed
+  ConvergenceTest *analysisTest = isStatic ? (*theStaticAnalysis)->getConvergenceTest() :
+    (*theTransientAnalysis)->getConvergenceTest();
+
+  int numStay = 0;
+  bool verbose = false;
+  SolutionStrategy *theStrategy = new SolutionStrategy();
+  std::vector<EquiSolnAlgo *> algos;
+  std::vector<ConvergenceTest *> tests;
+  std::vector<int> subSteps;
+  int numdata = 1;
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    opt = OPS_GetString();
+    if (opt == 0)
+      opt = "";
+
+    if (strcmp(opt, "-rung") == 0) {
+      EquiSolnAlgo *theAlgo = 0;
+      ConvergenceTest *theTest = 0;
+      int numSub = 1;
+      bool ok = true;
+      while (ok && OPS_GetNumRemainingInputArgs() > 0) {
+	if (nextIsFlag("-algorithm")) {
+	  // the test given to a NewtonLineSearch here is only used for its
+	  // construction, the rung's test is set when the rung is linked
+	  theAlgo = parseRungAlgorithm(theTest != 0 ? theTest : analysisTest);
+	  ok = (theAlgo != 0);
+	} else if (nextIsFlag("-test")) {
+	  theTest = parseRungTest();
+	  ok = (theTest != 0);
+	} else if (nextIsFlag("-subSteps")) {
+	  if (OPS_GetIntInput(&numdata, &numSub) < 0 || numSub < 1) {
+	    opserr << "WARNING solutionStrategy -subSteps: invalid number\n";
+	    ok = false;
+	  }
+	} else
+	  break;
+      }
+      if (!ok) {
+	if (theAlgo != 0) delete theAlgo;
+	if (theTest != 0) delete theTest;
+	delete theStrategy;
+	return -1;
+      }
+      if (isStatic && numSub > 1)
+	opserr << "WARNING solutionStrategy -subSteps is ignored by a static analysis\n";
+      theStrategy->addRung(theAlgo, theTest, numSub);
+
+    } else if (strcmp(opt, "-stay") == 0) {
+      if (OPS_GetIntInput(&numdata, &numStay) < 0 || numStay < 0) {
+	opserr << "WARNING solutionStrategy -stay: invalid number of steps\n";
+	delete theStrategy;
+	return -1;
+      }
+    } else if (strcmp(opt, "-verbose") == 0) {
+      verbose = true;
+    } else {
+      opserr << "WARNING solutionStrategy: unknown option " << opt << endln;
+      delete theStrategy;
+      return -1;
+    }
+  }
+
+  theStrategy->setOptions(numStay, verbose);
+
+  if (theStrategy->getNumRungs() < 2)
+    opserr << "WARNING solutionStrategy: no -rung given, only the analysis' own components will be used\n";
+
+  if (isStatic)
+    (*theStaticAnalysis)->setSolutionStrategy(theStrategy);
+  else
+    (*theTransientAnalysis)->setSolutionStrategy(theStrategy);
+
+  return 0;
+}
@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef SolutionStrategy_h
+#define SolutionStrategy_h
+
+// Description: This file contains the class definition for
+// SolutionStrategy. A SolutionStrategy is an ordered list of fallbacks
+// (rungs) that a StaticAnalysis or DirectIntegrationAnalysis tries, in
+// order, when a step fails:
+//   rung 0     - the algorithm and test of the analysis itself
+//   rung 1..n  - an algorithm and/or a test (0 keeps the one of the
+//                analysis) and a number of substeps the remainder of the
+//                time step is divided into (transient analysis only)
+// The rungs' components are owned by the SolutionStrategy and are linked
+// to the same AnalysisModel, integrator and LinearSOE as the analysis,
+// so switching rungs does not renumber the DOFs or rebuild the system.
+// After a step succeeds on a fallback rung, the following numStaySteps
+// steps start on that rung before going back to rung 0.
+
+#include <vector>
+#include <map>
+
+class EquiSolnAlgo;
+class ConvergenceTest;
+class OPS_Stream;
+
+class SolutionStrategy
+{
+  public:
+    SolutionStrategy(int numStaySteps = 0, bool verbose = false);
+    ~SolutionStrategy();
+
+    int addRung(EquiSolnAlgo *theAlgorithm, ConvergenceTest *theTest, int numSubSteps = 1);
+    void setOptions(int numStaySteps, bool verbose);
+
+    // number of rungs including rung 0
+    int getNumRungs(void) const;
+    EquiSolnAlgo *getAlgorithm(int rung);
+    ConvergenceTest *getConvergenceTest(int rung);
+    int getNumSubSteps(int rung) const;
+
+    // step bookkeeping, invoked by the analysis
+    void startAnalysis(void);
+    int getStartRung(void) const;
+    void stepDone(int rung, double time);
+    void stepFailed(double time);
+    const std::vector<int> &getStepRungs(void) const;
+
+    // an algorithm needs domainChanged() when it is (re)linked after
+    // the domain has changed while it was not in use
+    bool isUpToDate(EquiSolnAlgo *theAlgorithm, int domainStamp);
+    void setUpToDate(EquiSolnAlgo *theAlgorithm, int domainStamp);
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+  private:
+    std::vector<EquiSolnAlgo *> theAlgorithms;
+    std::vector<ConvergenceTest *> theTests;
+    std::vector<int> numSubSteps;
+
+    int numStaySteps;
+    bool verbose;
+
+    int currentRung;
+    int stayLeft;
+    std::vector<int> stepRungs;
+
+    std::map<EquiSolnAlgo *, int> algorithmStamps;
+};
+
+#endif
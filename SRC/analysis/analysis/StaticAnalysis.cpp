@@ -46,6 +46,8 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <SolutionStrategy.h>
+#include <PhaseTimer.h>
 //#include <Timer.h>
 #include <Integrator.h>//Abbas
 
@@ -66,7 +68,7 @@ StaticAnalysis::StaticAnalysis(Domain &the_Domain,
  theDOF_Numberer(&theNumberer), theAnalysisModel(&theModel), 
  theAlgorithm(&theSolnAlgo), theSOE(&theLinSOE), theEigenSOE(0),
  theIntegrator(&theStaticIntegrator), theTest(theConvergenceTest),
- domainStamp(0)
+ domainStamp(0), theStrategy(0)
 {
     // first we set up the links needed by the elements in the 
     // aggregation
@@ -89,6 +91,9 @@ StaticAnalysis::~StaticAnalysis()
   // we don't invoke the destructors in case user switching
   // from a static to a direct integration analysis 
   // clearAll() must be invoked if user wishes to invoke destructor
+  // the strategy belongs to this analysis only
+  if (theStrategy != 0)
+    delete theStrategy;
 }    
 
 void
@@ -111,6 +116,8 @@ StaticAnalysis::clearAll(void)
     delete theTest;
   if (theEigenSOE != 0)
     delete theEigenSOE;
+  if (theStrategy != 0)
+    delete theStrategy;
   
   theAnalysisModel =0;
   theConstraintHandler =0;
@@ -120,6 +127,7 @@ StaticAnalysis::clearAll(void)
   theSOE =0;
   theEigenSOE =0;
   theTest = 0;
+  theStrategy = 0;
 }    
 
 
@@ -129,8 +137,33 @@ StaticAnalysis::analyze(int numSteps, bool flush)
     int result = 0;
     Domain *the_Domain = this->getDomainPtr();
 
+    if (theStrategy != 0)
+      theStrategy->startAnalysis();
+
     for (int i=0; i<numSteps; i++) {
 
+	if (theStrategy != 0)
+	  result = this->analyzeStrategyStep(i, numSteps);
+	else
+	  result = this->analyzeStep(i, numSteps);
+
+	if (result < 0)
+	  return result;
+    }
+
+  if (the_Domain != 0 && flush) {
+    the_Domain->flushRecorders();
+  }
+    
+    return 0;
+}
+
+int 
+StaticAnalysis::analyzeStep(int i, int numSteps)
+{
+	int result = 0;
+	Domain *the_Domain = this->getDomainPtr();
+
 	result = theAnalysisModel->analysisStep();
 
 	if (result < 0) {
@@ -172,7 +205,7 @@ StaticAnalysis::analyze(int numSteps, bool flush)
 	    return -2;
 	}
 
-           result = theAlgorithm->solveCurrentStep();
+	result = theAlgorithm->solveCurrentStep();
 	if (result < 0) {
 	    opserr << "StaticAnalysis::analyze() - the Algorithm failed";
 	    opserr << " at step: " << i << " with domain at load factor ";
@@ -215,13 +248,57 @@ StaticAnalysis::analyze(int numSteps, bool flush)
 
 	    return -4;
 	}    	
+
+	return 0;
+}
+
+int
+StaticAnalysis::analyzeStrategyStep(int i, int numSteps)
+{
+    // the analysis' own algorithm and test are rung 0
+    EquiSolnAlgo *analysisAlgorithm = theAlgorithm;
+    ConvergenceTest *analysisTest = theTest;
+    Domain *the_Domain = this->getDomainPtr();
+
+    int result = -3;
+    int rung = theStrategy->getStartRung();
+    int numRungs = theStrategy->getNumRungs();
+    for ( ; rung < numRungs; rung++) {
+      this->useRung(rung, analysisAlgorithm, analysisTest);
+      result = this->analyzeStep(i, numSteps);
+      if (result >= 0 || result == -1)
+	break;
     }
 
-  if (the_Domain != 0 && flush) {
-    the_Domain->flushRecorders();
-  }
-    
-    return 0;
+    this->useRung(0, analysisAlgorithm, analysisTest);
+
+    if (result < 0)
+      theStrategy->stepFailed(the_Domain->getCurrentTime());
+    else
+      theStrategy->stepDone(rung, the_Domain->getCurrentTime());
+
+    return result;
+}
+
+void
+StaticAnalysis::useRung(int rung, EquiSolnAlgo *analysisAlgorithm, ConvergenceTest *analysisTest)
+{
+    theAlgorithm = theStrategy->getAlgorithm(rung);
+    if (theAlgorithm == 0)
+      theAlgorithm = analysisAlgorithm;
+    theTest = theStrategy->getConvergenceTest(rung);
+    if (theTest == 0)
+      theTest = analysisTest;
+
+    // relinking does not touch the AnalysisModel or the LinearSOE
+    theIntegrator->setLinks(*theAnalysisModel, *theSOE, theTest);
+    theAlgorithm->setLinks(*theAnalysisModel, *theIntegrator, *theSOE, theTest);
+
+    // an algorithm that was idle when the domain changed is brought up to date
+    if (domainStamp != 0 && !theStrategy->isUpToDate(theAlgorithm, domainStamp)) {
+      theAlgorithm->domainChanged();
+      theStrategy->setUpToDate(theAlgorithm, domainStamp);
+    }
 }
 
 
@@ -257,6 +334,7 @@ StaticAnalysis::eigen(int numMode, bool generalized, bool findSmallest)
     // zero A and M
     //
 
+    PhaseTimer theAssemblyTimer(PhaseTimer::Assembly);
     theEigenSOE->zeroA();
     theEigenSOE->zeroM();
 
@@ -312,7 +390,11 @@ StaticAnalysis::eigen(int numMode, bool generalized, bool findSmallest)
     // solve for the eigen values & vectors
     //
 
-    if (theEigenSOE->solve(numMode, generalized, findSmallest) < 0) {
+    {
+      PhaseTimer theSolveTimer(PhaseTimer::Factorization);
+      result = theEigenSOE->solve(numMode, generalized, findSmallest);
+    }
+    if (result < 0) {
 	opserr << "WARNING StaticAnalysis::eigen() - EigenSOE failed in solve()\n";
 	return -4;
     }
@@ -359,6 +441,7 @@ StaticAnalysis::initialize(void)
 int
 StaticAnalysis::domainChanged(void)
 {
+    PhaseTimer theSetupTimer(PhaseTimer::Setup);
     int result = 0;
 
     Domain *the_Domain = this->getDomainPtr();
@@ -391,7 +474,10 @@ StaticAnalysis::domainChanged(void)
     // equation numbers to be assigned to all the DOFs in the
     // AnalysisModel.
 
-    result = theDOF_Numberer->numberDOF();
+    {
+      PhaseTimer theNumberingTimer(PhaseTimer::Numbering);
+      result = theDOF_Numberer->numberDOF();
+    }
     if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
 	opserr << "DOF_Numberer::numberDOF() failed";
@@ -444,6 +530,8 @@ StaticAnalysis::domainChanged(void)
 	opserr << "Algorithm::domainChanged() failed";
 	return -5;
     }	        
+    if (theStrategy != 0)
+      theStrategy->setUpToDate(theAlgorithm, domainStamp);
 
     // if get here successful
     return 0;
@@ -485,8 +573,11 @@ StaticAnalysis::setAlgorithm(EquiSolnAlgo &theNewAlgorithm)
     
     // invoke domainChanged() either indirectly or directly
     //    domainStamp = 0;
-    if (domainStamp != 0)
+    if (domainStamp != 0) {
       theAlgorithm->domainChanged();
+      if (theStrategy != 0)
+	theStrategy->setUpToDate(theAlgorithm, domainStamp);
+    }
 
     return 0;
 }
@@ -606,6 +697,25 @@ StaticAnalysis::getConvergenceTest(void)
   return theTest;
 }
 
+int
+StaticAnalysis::setSolutionStrategy(SolutionStrategy *theNewStrategy)
+{
+  if (theStrategy != 0)
+    delete theStrategy;
+
+  theStrategy = theNewStrategy;
+  if (theStrategy != 0 && domainStamp != 0 && theAlgorithm != 0)
+    theStrategy->setUpToDate(theAlgorithm, domainStamp);
+
+  return 0;
+}
+
+SolutionStrategy *
+StaticAnalysis::getSolutionStrategy(void)
+{
+  return theStrategy;
+}
+
 
 
 
@@ -46,6 +46,7 @@ class LinearSOE;
 class EquiSolnAlgo;
 class ConvergenceTest;
 class EigenSOE;
+class SolutionStrategy;
 
 class StaticAnalysis: public Analysis
 {
@@ -74,14 +75,20 @@ class StaticAnalysis: public Analysis
     int setLinearSOE(LinearSOE &theSOE);
     int setConvergenceTest(ConvergenceTest &theTest);
     int setEigenSOE(EigenSOE &theSOE);
+    int setSolutionStrategy(SolutionStrategy *theStrategy);
 
     EquiSolnAlgo     *getAlgorithm(void);
     StaticIntegrator *getIntegrator(void);
     ConvergenceTest  *getConvergenceTest(void);
+    SolutionStrategy *getSolutionStrategy(void);
 
   protected: 
     
   private:
+    int analyzeStep(int step, int numSteps);
+    int analyzeStrategyStep(int step, int numSteps);
+    void useRung(int rung, EquiSolnAlgo *analysisAlgorithm, ConvergenceTest *analysisTest);
+
     ConstraintHandler 	*theConstraintHandler;    
     DOF_Numberer 	*theDOF_Numberer;
     AnalysisModel 	*theAnalysisModel;
@@ -91,6 +98,7 @@ class StaticAnalysis: public Analysis
     StaticIntegrator    *theIntegrator;
     ConvergenceTest     *theTest;
     int domainStamp;
+    SolutionStrategy    *theStrategy;
 
 };
 
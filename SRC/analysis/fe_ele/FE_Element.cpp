@@ -1128,7 +1128,8 @@ void FE_Element::deactivate()
 
 bool FE_Element::isActive()
 { 
-	if (myEle->isActive())
+	// FE_Elements of constraints have no element and are always active
+	if (myEle == 0 || myEle->isActive())
 	{
 		// opserr << "Element # " << myEle->getTag() << " is ACTIVE." << endln;
 		return true;
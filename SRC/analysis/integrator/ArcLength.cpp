@@ -60,10 +60,13 @@
 #include<DOF_GrpIter.h>
 #include<TaggedObjectStorage.h>
 #include<EquiSolnAlgo.h>
+#include <string.h>
+#include <ctype.h>
+
 void* OPS_ArcLength()
 {
     double arcLength;
-    if (OPS_GetNumRemainingInputArgs() < 2) {
+    if (OPS_GetNumRemainingInputArgs() < 1) {
 	opserr << "WARNING integrator ArcLength arcLength alpha \n";
 	return 0;
     }
@@ -73,16 +76,61 @@ void* OPS_ArcLength()
 	opserr << "WARNING integrator ArcLength failed to read arc length\n";
 	return 0;
     }
+    double alpha = 1.0;
     if (OPS_GetNumRemainingInputArgs() > 0) {
-      double alpha;
-      if (OPS_GetDoubleInput(&numdata, &alpha) < 0) {
-	opserr << "WARNING integrator ArcLength failed to read alpha\n";
+      const char *next = OPS_GetString();
+      OPS_ResetCurrentInputArg(-1);
+      if (next == 0 || next[0] != '-' || isdigit(next[1]) || next[1] == '.') {
+	if (OPS_GetDoubleInput(&numdata, &alpha) < 0) {
+	  opserr << "WARNING integrator ArcLength failed to read alpha\n";
+	  return 0;
+	}
+      }
+    }
+
+    // <-numIter Jd> <-minArc min> <-maxArc max> <-exponent e> <-predictor type>
+    int numIter = 0;
+    double minArc = 0.0, maxArc = 0.0, exponent = 0.5;
+    int predictor = 0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+      const char *flag = OPS_GetString();
+      if (flag == 0) {
+	opserr << "WARNING integrator ArcLength failed to read an option\n";
+	return 0;
+      }
+      if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING integrator ArcLength missing value after " << flag << endln;
+	return 0;
+      }
+      int res = 0;
+      if (strcmp(flag, "-numIter") == 0)
+	res = OPS_GetIntInput(&numdata, &numIter);
+      else if (strcmp(flag, "-minArc") == 0)
+	res = OPS_GetDoubleInput(&numdata, &minArc);
+      else if (strcmp(flag, "-maxArc") == 0)
+	res = OPS_GetDoubleInput(&numdata, &maxArc);
+      else if (strcmp(flag, "-exponent") == 0)
+	res = OPS_GetDoubleInput(&numdata, &exponent);
+      else if (strcmp(flag, "-predictor") == 0) {
+	predictor = StaticIntegrator::getPredictorType(OPS_GetString());
+	if (predictor < 0)
+	  res = -1;
+      } else {
+	opserr << "WARNING integrator ArcLength unknown option " << flag << endln;
+	return 0;
+      }
+      if (res < 0) {
+	opserr << "WARNING integrator ArcLength invalid value after " << flag << endln;
 	return 0;
       }
-      return new ArcLength(arcLength,alpha);
-    } else {
-      return new ArcLength(arcLength);
     }
+
+    ArcLength *theIntegrator = new ArcLength(arcLength,alpha);
+    if (numIter > 0)
+      theIntegrator->setStepAdaptation(numIter, minArc, maxArc, exponent);
+    theIntegrator->setPredictor(predictor);
+
+    return theIntegrator;
 }
 
 ArcLength::ArcLength(double arcLength, double alpha)
@@ -90,11 +138,23 @@ ArcLength::ArcLength(double arcLength, double alpha)
  arcLength2(arcLength*arcLength), alpha2(alpha*alpha),
  deltaUhat(0), deltaUbar(0), deltaU(0), deltaUstep(0),deltaUstep2(0),dDeltaUstepdh(0), 
  phat(0), deltaLambdaStep(0.0),dDeltaLambdaStepdh(0.0), currentLambda(0.0), dLAMBDA(0.0),dLAMBDA2(0.0),dlambda1dh(0.0),dLAMBDAdh(0),Residual(0),sensU(0),sensitivityFlag(0),
- signLastDeltaLambdaStep(1), dUhatdh(0),dphatdh(0),dUIJdh(0),dlambdaJdh(0.0),gradNumber(0), a(0.0),b(0.0),c(0.0),b24ac(0.0)
+ signLastDeltaLambdaStep(1), dUhatdh(0),dphatdh(0),dUIJdh(0),dlambdaJdh(0.0),gradNumber(0), a(0.0),b(0.0),c(0.0),b24ac(0.0),
+ specNumIncrStep(0), numIncrLastStep(0), arcLengthMin(0.0), arcLengthMax(0.0), adaptExponent(0.5)
 {
 
 }
 
+int
+ArcLength::setStepAdaptation(int numIter, double minArcLength, double maxArcLength, double exponent)
+{
+  specNumIncrStep = numIter;
+  numIncrLastStep = numIter;
+  arcLengthMin = minArcLength;
+  arcLengthMax = maxArcLength;
+  adaptExponent = exponent;
+  return 0;
+}
+
 ArcLength::~ArcLength()
 {
     // delete any vector object created
@@ -148,6 +208,41 @@ ArcLength::newStep(void)
     else
 	signLastDeltaLambdaStep = +1;
 
+    // adapt the arc length to the number of iterations of the last step
+    if (specNumIncrStep > 0 && numIncrLastStep > 0) {
+      double arcLength = sqrt(arcLength2)*this->getStepFactor(specNumIncrStep, numIncrLastStep, adaptExponent);
+      if (arcLength < arcLengthMin)
+	arcLength = arcLengthMin;
+      else if (arcLengthMax > 0.0 && arcLength > arcLengthMax)
+	arcLength = arcLengthMax;
+      arcLength2 = arcLength*arcLength;
+    }
+    numIncrLastStep = 0;
+
+    // extrapolated predictor, scaled to the arc length
+    const Vector *dUpredicted = 0;
+    double dLambdaPredicted = 0.0;
+    double predictedLength2 = 0.0;
+    double dLambdaLast;
+    const Vector *dULast = this->getLastIncrement(dLambdaLast);
+    if (this->getPredictor() > 0 && dULast != 0 && this->activateSensitivity() == false) {
+      double lastLength2 = ((*dULast)^(*dULast)) + alpha2*dLambdaLast*dLambdaLast;
+      if (lastLength2 > 0.0)
+	dUpredicted = this->formPredictor(sqrt(arcLength2/lastLength2), dLambdaPredicted);
+      if (dUpredicted != 0) {
+	predictedLength2 = ((*dUpredicted)^(*dUpredicted)) + alpha2*dLambdaPredicted*dLambdaPredicted;
+	if (predictedLength2 <= 0.0)
+	  dUpredicted = 0;
+      }
+    }
+
+    double dLambda;
+    if (dUpredicted != 0) {
+      double scale = sqrt(arcLength2/predictedLength2);
+      dLambda = dLambdaPredicted*scale;
+      deltaU->addVector(0.0, *dUpredicted, scale);
+    } else {
+
     // determine dUhat
     this->formTangent();
     theLinSOE->setB(*phat);
@@ -161,17 +256,20 @@ ArcLength::newStep(void)
     Vector &dUhat = *deltaUhat;
     
     // determine delta lambda(1) == dlambda
-    double dLambda = sqrt(arcLength2/((dUhat^dUhat)+alpha2));
+    dLambda = sqrt(arcLength2/((dUhat^dUhat)+alpha2));
     dLambda *= signLastDeltaLambdaStep; // base sign of load change
    //    opserr<<"newStep:   the sign is "<<signLastDeltaLambdaStep<<endln;     // on what was happening last step
+
+    // determine delta U(1) == dU
+    (*deltaU) = dUhat;
+    (*deltaU) *= dLambda;
+    }
+
     deltaLambdaStep = dLambda;
     dLAMBDA=dLambda;
   //  opserr<<"newStep:   dLAMBDA= "<<dLAMBDA<<endln;
     currentLambda += dLambda;
 
-    // determine delta U(1) == dU
-    (*deltaU) = dUhat;
-    (*deltaU) *= dLambda;
     (*deltaUstep) = (*deltaU);
     (*deltaUstep2)=(*deltaU);
 
@@ -306,6 +404,8 @@ dLAMBDA2=dLambda;
     
     // set the X soln in linearSOE to be deltaU for convergence Test
     theLinSOE->setX(*deltaU);
+
+    numIncrLastStep++;
 //opserr<<" update:  end"<<endln;
     return 0;
 }
@@ -316,6 +416,7 @@ int
 ArcLength::domainChanged(void)
 {
  //  opserr<<"domainChanged: start"<<endln;
+    this->resetPredictor();
 
     // we first create the Vectors needed
     AnalysisModel *theModel = this->getAnalysisModel();
@@ -510,12 +611,18 @@ ArcLength::sendSelf(int cTag,
 {
  //  opserr<<"sendSelf: start"<<endln;
 
-  Vector data(5);
+  Vector data(11);
   data(0) = arcLength2;
   data(1) = alpha2;
   data(2) = deltaLambdaStep;
   data(3) = currentLambda;
   data(4)  = signLastDeltaLambdaStep;
+  data(5) = specNumIncrStep;
+  data(6) = numIncrLastStep;
+  data(7) = arcLengthMin;
+  data(8) = arcLengthMax;
+  data(9) = adaptExponent;
+  data(10) = this->getPredictor();
 
   if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
       opserr << "ArcLength::sendSelf() - failed to send the data\n";
@@ -532,7 +639,7 @@ ArcLength::recvSelf(int cTag,
 {
  //  opserr<<"ArcLength:: recSelf: start"<<endln;
 
-  Vector data(5);
+  Vector data(11);
   if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
       opserr << "ArcLength::sendSelf() - failed to send the data\n";
       return -1;
@@ -544,6 +651,12 @@ ArcLength::recvSelf(int cTag,
   deltaLambdaStep = data(2);
   currentLambda = data(3);
   signLastDeltaLambdaStep = data(4);
+  specNumIncrStep = (int)data(5);
+  numIncrLastStep = (int)data(6);
+  arcLengthMin = data(7);
+  arcLengthMax = data(8);
+  adaptExponent = data(9);
+  this->setPredictor((int)data(10));
  // opserr<<"recSelf: end"<<endln;
 
   return 0;
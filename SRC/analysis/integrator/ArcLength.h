@@ -60,6 +60,10 @@ class ArcLength : public StaticIntegrator
     int newStep(void);    
     int update(const Vector &deltaU);
     int domainChanged(void);
+
+    // arcLength *= (Jd/J)^exponent after a step of J iterations, in [min,max]
+    int setStepAdaptation(int specNumIter, double minArcLength,
+			  double maxArcLength, double exponent = 0.5);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -99,6 +103,9 @@ class ArcLength : public StaticIntegrator
     double dlambda1dh;
     int gradNumber;
    int sensitivityFlag;
+
+    int specNumIncrStep, numIncrLastStep; // Jd & J(i-1), Jd = 0: no adaptation
+    double arcLengthMin, arcLengthMax, adaptExponent;
 };
 
 #endif
@@ -61,6 +61,7 @@
 #include <Matrix.h>
 #include <TaggedObjectStorage.h>
 #include <elementAPI.h>
+#include <ctype.h>
 
 void* OPS_DisplacementControlIntegrator()
 {
@@ -88,7 +89,13 @@ void* OPS_DisplacementControlIntegrator()
     int numIter = 1;
     int formTangent = 0;
     double data[2] = {incr,incr};
+    bool positional = false;
     if(OPS_GetNumRemainingInputArgs() > 2) {
+       const char* next = OPS_GetString();
+       OPS_ResetCurrentInputArg(-1);
+       positional = (next == 0 || next[0] != '-' || isdigit(next[1]) || next[1] == '.');
+    }
+    if(positional) {
        numData = 1;
        if(OPS_GetIntInput(&numData,&numIter) < 0) {
 	   opserr << "WARNING failed to read numIter\n";
@@ -101,11 +108,29 @@ void* OPS_DisplacementControlIntegrator()
        }
     }
 
-    if (OPS_GetNumRemainingInputArgs() == 1) {
-      	std::string type = OPS_GetString();
+    int predictor = 0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* flag = OPS_GetString();
+	if (flag == 0) {
+	    opserr << "WARNING integrator DisplacementControl failed to read an option\n";
+	    return 0;
+	}
+      	std::string type = flag;
 	if(type=="-initial" || type=="-Initial") {
 	    formTangent = 1;
-	} 
+	} else if(type=="-predictor") {
+	    if (OPS_GetNumRemainingInputArgs() > 0)
+		predictor = StaticIntegrator::getPredictorType(OPS_GetString());
+	    else
+		predictor = -1;
+	    if (predictor < 0) {
+		opserr << "WARNING integrator DisplacementControl -predictor tangent, secant or quadratic\n";
+		return 0;
+	    }
+	} else {
+	    opserr << "WARNING integrator DisplacementControl unknown option " << flag << endln;
+	    return 0;
+	}
     }
 
     // check node
@@ -122,10 +147,13 @@ void* OPS_DisplacementControlIntegrator()
        return 0;
     }
 
-    return new DisplacementControl(iData[0],iData[1]-1,
+    DisplacementControl *theIntegrator = new DisplacementControl(iData[0],iData[1]-1,
 				   incr,theDomain,
 				   numIter,data[0],data[1], 
 				   formTangent);
+    theIntegrator->setPredictor(predictor);
+
+    return theIntegrator;
 }
 
 
@@ -210,7 +238,7 @@ DisplacementControl::newStep(void)
      theDomain = theModel->getDomainPtr();   
      
    // determine increment for this iteration
-   double factor = double(specNumIncrStep)/numIncrLastStep;
+   double factor = this->getStepFactor(specNumIncrStep, numIncrLastStep);
    theIncrement *=factor;
 
    if (theIncrement < minIncrement)
@@ -222,6 +250,26 @@ DisplacementControl::newStep(void)
    // get the current load factor
    currentLambda = theModel->getCurrentDomainTime();
 
+   // extrapolated predictor, scaled so the control dof moves by theIncrement
+   const Vector *dUpredicted = 0;
+   double dLambdaPredicted = 0.0;
+   double dLambdaLast;
+   const Vector *dULast = this->getLastIncrement(dLambdaLast);
+   if (this->getPredictor() > 0 && dULast != 0 && this->activateSensitivity() == false &&
+       (*dULast)(theDofID) != 0.0) {
+     dUpredicted = this->formPredictor(theIncrement/(*dULast)(theDofID), dLambdaPredicted);
+     if (dUpredicted != 0 && (*dUpredicted)(theDofID)*theIncrement <= 0.0)
+       dUpredicted = 0;
+   }
+
+   if (dUpredicted != 0) {
+     double scale = theIncrement/(*dUpredicted)(theDofID);
+     deltaU->addVector(0.0, *dUpredicted, scale);
+     (*deltaUstep) = (*deltaU);
+     deltaLambdaStep = dLambdaPredicted*scale;
+     currentLambda += deltaLambdaStep;
+   } else {
+
    // determine dUhat
    this->formTangent(tangFlag);
    theLinSOE->setB(*phat);
@@ -251,6 +299,7 @@ DisplacementControl::newStep(void)
    (*deltaU) = dUhat;
    (*deltaU) *= dlambda;// this is eq(4) in the paper {dU}_1=dLAmbda1*Uft.
    (*deltaUstep) = (*deltaU);
+   }
 
 
    ////////////////Abbas////////////////////////////
@@ -362,6 +411,8 @@ int DisplacementControl::update(const Vector &dU)
 int 
 DisplacementControl::domainChanged(void)
 {
+   this->resetPredictor();
+
    // we first create the Vectors needed
   //opserr<<" this is the domain change function"<<endln;//Abbas
    AnalysisModel *theModel = this->getAnalysisModel();
@@ -559,7 +610,7 @@ int
 DisplacementControl::sendSelf(int cTag,
       Channel &theChannel)
 {
-  Vector data(10);
+  Vector data(11);
   data(0) = theNode;
   data(1) = theDof;
   data(2) = theIncrement;
@@ -570,6 +621,7 @@ DisplacementControl::sendSelf(int cTag,
   data(7) = numIncrLastStep;
   data(8) = minIncrement;
   data(9) = maxIncrement;
+  data(10) = this->getPredictor();
 
   if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
     opserr << "DisplacementControl::sendSelf() - failed to send the Vector\n";
@@ -584,7 +636,7 @@ int
 DisplacementControl::recvSelf(int cTag,
       Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  Vector data(10);
+  Vector data(11);
   if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
     opserr << "DisplacementControl::sendSelf() - failed to send the Vector\n";
     return -1;
@@ -600,6 +652,7 @@ DisplacementControl::recvSelf(int cTag,
   numIncrLastStep = (int)data(7);
   minIncrement = data(8);
   maxIncrement = data(9);
+  this->setPredictor((int)data(10));
   
   return 0;
 }
@@ -39,14 +39,23 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <PhaseTimer.h>
+#include <Domain.h>
+#include <ConvergenceTest.h>
+#include <Matrix.h>
+#include <ID.h>
 #include <cmath>
 
+#ifdef _PARALLEL_PROCESSING
+#include <mpi.h>
+#endif
+
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
- mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ mV(0),tmpV1(0),tmpV2(0), reduceInactiveDOFs(false),
+ theSOE(0), theAnalysisModel(0), theTest(0), activeDOFs(0), sizeActiveDOFs(0)
 {
   
 }
@@ -65,6 +74,8 @@ IncrementalIntegrator::~IncrementalIntegrator()
     delete tmpV1;
   if (tmpV2 != 0)
     delete tmpV2;
+  if (activeDOFs != 0)
+    delete [] activeDOFs;
 }
 
 void
@@ -73,6 +84,11 @@ IncrementalIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, C
     theAnalysisModel = &theModel;
     theSOE = &theLinSOE;
     theTest = theConvergenceTest;
+
+    // quiescent elements may be skipped in a static analysis
+    Domain *theDomain = theModel.getDomainPtr();
+    if (theDomain != 0)
+      theDomain->allowQuiescentSkip(true);
 }
 
 
@@ -84,6 +100,8 @@ IncrementalIntegrator::setEigenSOE(EigenSOE *theEigSOE) {
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    PhaseTimer theTimer(PhaseTimer::Assembly);
+    PhaseTimer::tangentFormed();
     int result = 0;
     statusFlag = statFlag;
 
@@ -109,9 +127,99 @@ IncrementalIntegrator::formTangent(int statFlag)
 	    result = -3;
 	}
 
+    if (this->formInactiveTangent() < 0)
+	result = -3;
+
     return result;
 }
 
+int
+IncrementalIntegrator::formInactiveTangent(void)
+{
+    // quick return if no element has been deactivated; the Staged
+    // integrators always look for the equations no active element sees
+    FE_Element *elePtr;
+    if (reduceInactiveDOFs == false) {
+      FE_EleIter &theEles = theAnalysisModel->getFEs();
+      bool allActive = true;
+      while ((elePtr = theEles()) != 0)
+	if (elePtr->isActive() == false) {
+	  allActive = false;
+	  break;
+	}
+
+      if (allActive == true)
+	return 0;
+    }
+
+    int numEqn = theSOE->getNumEqn();
+    if (sizeActiveDOFs < numEqn) {
+      if (activeDOFs != 0)
+	delete [] activeDOFs;
+      activeDOFs = new int[numEqn];
+      sizeActiveDOFs = numEqn;
+    }
+    for (int i = 0; i < numEqn; i++)
+      activeDOFs[i] = 0;
+
+    // mark the equations with 2 if an active element is connected to
+    // them, else with 1 if an inactive one is
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();
+    while ((elePtr = theEles2()) != 0) {
+      int mark = (elePtr->isActive() == true) ? 2 : 1;
+      const ID &theID = elePtr->getID();
+      for (int i = 0; i < theID.Size(); i++) {
+	int dof = theID(i);
+	if (dof >= 0 && dof < numEqn && activeDOFs[dof] < mark)
+	  activeDOFs[dof] = mark;
+      }
+    }
+
+#ifdef _PARALLEL_PROCESSING
+    if (reduceInactiveDOFs == true)
+      MPI_Allreduce(MPI_IN_PLACE, activeDOFs, numEqn, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+    // the equations only inactive elements see get a unit stiffness,
+    // with the Staged integrators also those no element is connected to;
+    // their unbalance is zero as inactive elements add no force
+    int lonely = (reduceInactiveDOFs == true) ? 1 : 0;
+    static Matrix one(1, 1);
+    static ID dofID(1);
+    one(0, 0) = 1.0;
+    int result = 0;
+    for (int i = 0; i < numEqn; i++)
+      if (activeDOFs[i] == 1 || activeDOFs[i] < lonely) {
+	dofID(0) = i;
+	if (theSOE->addA(one, dofID) < 0)
+	  result = -1;
+      }
+
+    if (result < 0)
+      opserr << "WARNING IncrementalIntegrator::formInactiveTangent - failed in addA\n";
+
+    return result;
+}
+
+int
+IncrementalIntegrator::refreshStalledElements(void)
+{
+    Domain *theDomain = theAnalysisModel->getDomainPtr();
+    if (theDomain == 0 || theDomain->getQuiescentTolerance() <= 0.0 || theTest == 0)
+      return 0;
+
+    // the test has stalled if the last norm is not smaller than the one before
+    int numTests = theTest->getNumTests();
+    const Vector &norms = theTest->getNorms();
+    if (numTests < 2 || numTests > norms.Size())
+      return 0;
+
+    if (norms(numTests-1) < norms(numTests-2))
+      return 0;
+
+    return theDomain->refreshElementState();
+}
+
 int 
 IncrementalIntegrator::formTangent(int statFlag, double iFact, double cFact)
 {
@@ -129,12 +237,15 @@ IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
+    PhaseTimer theTimer(PhaseTimer::Assembly);
     if (theAnalysisModel == 0 || theSOE == 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance -";
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
 	return -1;
     }
     
+    this->refreshStalledElements();
+
     theSOE->zeroB();
 
     if (this->formElementResidual() < 0) {
@@ -111,6 +111,16 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+
+    // adds a unit stiffness on the equations that are only connected to
+    // inactive (staged) elements, so they are not singular and the SOE
+    // keeps its structure while elements are deactivated and activated
+    int formInactiveTangent(void);
+
+    // when the Domain skips quiescent elements, updates them all if the
+    // convergence test has stopped making progress
+    int refreshStalledElements(void);
+
     int statusFlag;
     double iFactor;
     double cFactor;
@@ -125,12 +135,19 @@ class IncrementalIntegrator : public Integrator
     Vector *mV;
     Vector *tmpV1;
     Vector *tmpV2;
+
+    // set by the Staged integrators, whose processes share one distributed
+    // SOE, to combine the active equations of all the processes; they also
+    // give a unit stiffness to the equations no element is connected to
+    bool reduceInactiveDOFs;
     
   private:
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
 
+    int *activeDOFs;
+    int sizeActiveDOFs;
 };
 
 #endif
@@ -54,6 +54,7 @@
 #include<EquiSolnAlgo.h>
 #include <elementAPI.h>
 #include <iostream>
+#include <string.h>
 
 void* OPS_LoadControlIntegrator()
 {
@@ -83,7 +84,28 @@ void* OPS_LoadControlIntegrator()
 	}
     }
 
-    return new LoadControl(lambda,numIter,mLambda[0],mLambda[1]);
+    int predictor = 0;
+    while(OPS_GetNumRemainingInputArgs() > 0) {
+	const char* flag = OPS_GetString();
+	if(flag != 0 && strcmp(flag,"-predictor") == 0) {
+	    if(OPS_GetNumRemainingInputArgs() > 0)
+		predictor = StaticIntegrator::getPredictorType(OPS_GetString());
+	    else
+		predictor = -1;
+	    if(predictor < 0) {
+		opserr<<"WARNING LoadControl - -predictor tangent, secant or quadratic\n";
+		return 0;
+	    }
+	} else {
+	    opserr<<"WARNING LoadControl - unknown option "<<(flag != 0 ? flag : "")<<endln;
+	    return 0;
+	}
+    }
+
+    LoadControl *theIntegrator = new LoadControl(lambda,numIter,mLambda[0],mLambda[1]);
+    theIntegrator->setPredictor(predictor);
+
+    return theIntegrator;
 }
 
 LoadControl::LoadControl(double dLambda, int numIncr, double min, double max, int classtag)
@@ -116,7 +138,7 @@ LoadControl::newStep(void)
     }
 
     // determine delta lambda for this step based on dLambda and #iter of last step
-    double factor = specNumIncrStep/numIncrLastStep;
+    double factor = this->getStepFactor(specNumIncrStep, numIncrLastStep);
     deltaLambda *=factor;
 
     if (deltaLambda < dLambdaMin)
@@ -129,6 +151,21 @@ LoadControl::newStep(void)
     currentLambda += deltaLambda;
     theModel->applyLoadDomain(currentLambda);
 
+    // start the iterations from the extrapolated displacements
+    double dLambdaLast;
+    if (this->getPredictor() > 0 && this->getLastIncrement(dLambdaLast) != 0 &&
+	dLambdaLast != 0.0) {
+      double dLambdaPredicted;
+      const Vector *dUpredicted = this->formPredictor(deltaLambda/dLambdaLast, dLambdaPredicted);
+      if (dUpredicted != 0) {
+	theModel->incrDisp(*dUpredicted);
+	if (theModel->updateDomain() < 0) {
+	  opserr << "LoadControl::newStep - model failed to update for predicted dU\n";
+	  return -1;
+	}
+      }
+    }
+
     numIncrLastStep = 0;
    
      return 0;
@@ -174,12 +211,13 @@ int
 LoadControl::sendSelf(int cTag,
 		      Channel &theChannel)
 {
-  Vector data(5);
+  Vector data(6);
   data(0) = deltaLambda;
   data(1) = specNumIncrStep;
   data(2) = numIncrLastStep;
   data(3) = dLambdaMin;
   data(4) = dLambdaMax;
+  data(5) = this->getPredictor();
   if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
       opserr << "LoadControl::sendSelf() - failed to send the Vector\n";
       return -1;
@@ -192,7 +230,7 @@ int
 LoadControl::recvSelf(int cTag,
 		      Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  Vector data(5);
+  Vector data(6);
   if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
       opserr << "LoadControl::sendSelf() - failed to send the Vector\n";
       deltaLambda = 0;
@@ -203,6 +241,7 @@ LoadControl::recvSelf(int cTag,
   numIncrLastStep = data(2);
   dLambdaMin = data(3);
   dLambdaMax = data(4);
+  this->setPredictor((int)data(5));
   return 0;
 }
 
@@ -54,6 +54,9 @@
 #include<TaggedObjectStorage.h>
 #include <elementAPI.h>
 #include <Matrix.h>
+#include <string.h>
+#include <ctype.h>
+
 void* OPS_MinUnbalDispNorm()
 {
     double lambda11, minlambda, maxlambda;
@@ -69,7 +72,13 @@ void* OPS_MinUnbalDispNorm()
 	return 0;
     }
 
+    bool positional = false;
     if (OPS_GetNumRemainingInputArgs() >= 3) {
+	const char* next = OPS_GetString();
+	OPS_ResetCurrentInputArg(-1);
+	positional = (next == 0 || next[0] != '-' || isdigit(next[1]) || next[1] == '.');
+    }
+    if (positional) {
 	if (OPS_GetIntInput(&numdata, &numIter) < 0) {
 	    opserr << "WARNING integrator MinUnbalDispNorm invalid numIter\n";
 	    return 0;
@@ -90,15 +99,35 @@ void* OPS_MinUnbalDispNorm()
     }
 
     int signFirstStepMethod = SIGN_LAST_STEP;
-    if (OPS_GetNumRemainingInputArgs() > 0) {
+    int predictor = 0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
 	const char* flag = OPS_GetString();
+	if (flag == 0) {
+	    opserr << "WARNING integrator MinUnbalDispNorm failed to read an option\n";
+	    return 0;
+	}
 	if ((strcmp(flag,"-determinant") == 0) ||
 	    (strcmp(flag,"-det") == 0)) {
 	    signFirstStepMethod = CHANGE_DETERMINANT;
+	} else if (strcmp(flag,"-predictor") == 0) {
+	    if (OPS_GetNumRemainingInputArgs() > 0)
+		predictor = StaticIntegrator::getPredictorType(OPS_GetString());
+	    else
+		predictor = -1;
+	    if (predictor < 0) {
+		opserr << "WARNING integrator MinUnbalDispNorm -predictor tangent, secant or quadratic\n";
+		return 0;
+	    }
+	} else {
+	    opserr << "WARNING integrator MinUnbalDispNorm unknown option " << flag << endln;
+	    return 0;
 	}
     }
 
-    return new MinUnbalDispNorm(lambda11,numIter,minlambda,maxlambda,signFirstStepMethod);
+    MinUnbalDispNorm *theIntegrator = new MinUnbalDispNorm(lambda11,numIter,minlambda,maxlambda,signFirstStepMethod);
+    theIntegrator->setPredictor(predictor);
+
+    return theIntegrator;
 
 }
 
@@ -169,19 +198,8 @@ MinUnbalDispNorm::newStep(void)
     // get the current load factor
     currentLambda = theModel->getCurrentDomainTime();
 
-//opserr<<" NewStep=      "<<*phat<<endln;
-    // determine dUhat
-    this->formTangent();
-    theLinSOE->setB(*phat);
-    if (theLinSOE->solve() < 0) {
-      opserr << "MinUnbalanceDispNorm::newStep(void) - failed in solver\n";
-      return -1;
-    }
-    (*deltaUhat) = theLinSOE->getX();
-    Vector &dUhat = *deltaUhat;
-
     // determine delta lambda(1) == dlambda
-    double factor = specNumIncrStep/numIncrLastStep;
+    double factor = this->getStepFactor(specNumIncrStep, numIncrLastStep);
     double dLambda = dLambda1LastStep*factor;
 
     // check aaint min and max values specified in constructor
@@ -192,6 +210,30 @@ MinUnbalDispNorm::newStep(void)
 
     dLambda1LastStep = dLambda;
 
+    // extrapolated predictor, the sign of the load change follows the path
+    const Vector *dUpredicted = 0;
+    double dLambdaPredicted = 0.0;
+    double dLambdaLast;
+    if (this->getPredictor() > 0 && signFirstStepMethod == SIGN_LAST_STEP &&
+	this->activateSensitivity() == false &&
+	this->getLastIncrement(dLambdaLast) != 0 && dLambdaLast != 0.0)
+      dUpredicted = this->formPredictor(dLambda/fabs(dLambdaLast), dLambdaPredicted);
+
+    if (dUpredicted != 0) {
+      (*deltaU) = *dUpredicted;
+      dLambda = dLambdaPredicted;
+    } else {
+
+//opserr<<" NewStep=      "<<*phat<<endln;
+    // determine dUhat
+    this->formTangent();
+    theLinSOE->setB(*phat);
+    if (theLinSOE->solve() < 0) {
+      opserr << "MinUnbalanceDispNorm::newStep(void) - failed in solver\n";
+      return -1;
+    }
+    (*deltaUhat) = theLinSOE->getX();
+    Vector &dUhat = *deltaUhat;
 
     if (signFirstStepMethod == SIGN_LAST_STEP) {
       if (deltaLambdaStep < 0)
@@ -221,13 +263,15 @@ MinUnbalDispNorm::newStep(void)
     if (signCurrentWork != signLastDeltaStep)
     */
 
+    // determine delta U(1) == dU
+    (*deltaU) = dUhat;
+    (*deltaU) *= dLambda;
+    }
+
     deltaLambdaStep = dLambda;
     currentLambda += dLambda;
     numIncrLastStep = 0;
 
-    // determine delta U(1) == dU
-    (*deltaU) = dUhat;
-    (*deltaU) *= dLambda;
     (*deltaUstep) = (*deltaU);
 
 //////////////////
@@ -356,6 +400,8 @@ MinUnbalDispNorm::update(const Vector &dU)
 int 
 MinUnbalDispNorm::domainChanged(void)
 {
+    this->resetPredictor();
+
     // we first create the Vectors needed
     AnalysisModel *theModel = this->getAnalysisModel();
     LinearSOE *theLinSOE = this->getLinearSOE();    
@@ -536,7 +582,7 @@ int
 MinUnbalDispNorm::sendSelf(int cTag,
 		    Channel &theChannel)
 {
-  Vector data(8);
+  Vector data(9);
   data(0) = dLambda1LastStep;
   data(1) = specNumIncrStep;
   data(2) = numIncrLastStep;
@@ -548,6 +594,7 @@ MinUnbalDispNorm::sendSelf(int cTag,
     data(5) = 0.0;
   data(6) = dLambda1min;
   data(7) = dLambda1max;
+  data(8) = this->getPredictor();
 
   if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
       opserr << "MinUnbalDispNorm::sendSelf() - failed to send the data\n";
@@ -561,7 +608,7 @@ int
 MinUnbalDispNorm::recvSelf(int cTag,
 		    Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-  Vector data(8);
+  Vector data(9);
   if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
       opserr << "MinUnbalDispNorm::sendSelf() - failed to send the data\n";
       return -1;
@@ -580,6 +627,7 @@ MinUnbalDispNorm::recvSelf(int cTag,
     signLastDeltaLambdaStep = -1;
   dLambda1min = data(6);
   dLambda1max = data(7);
+  this->setPredictor((int)data(8));
 
   return 0;
 }
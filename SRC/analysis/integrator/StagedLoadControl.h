@@ -57,9 +57,6 @@ public:
                 double minLambda, double maxlambda);
 
 
-    int  formTangent(int statusFlag = CURRENT_TANGENT);
-
-
 };
 
 #endif
@@ -33,8 +33,6 @@ public:
     StagedNewmark();
     StagedNewmark(double gamma, double beta, bool disp = true, bool aflag=false);
 
-    int  formTangent(int statusFlag = CURRENT_TANGENT);
-
 
 private:
 };
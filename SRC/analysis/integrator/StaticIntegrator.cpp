@@ -53,9 +53,19 @@
 #include <DOF_GrpIter.h>
 #include <LoadPattern.h>
 #include <LoadPatternIter.h>
+#include <ID.h>
+#include <math.h>
+#include <string.h>
+
+// an extrapolated step is not trusted for the next step if the
+// converged increment deviates more than this angle (its cosine) from it
+#define STATIC_PREDICTOR_MIN_COS 0.5
 
 StaticIntegrator::StaticIntegrator(int clasTag)
- :IncrementalIntegrator(clasTag)
+ :IncrementalIntegrator(clasTag),
+  predictorOrder(0), lastU(0), deltaU1(0), deltaU2(0), predictedU(0),
+  lastLambda(0.0), deltaLambda1(0.0), deltaLambda2(0.0),
+  numIncrements(-1), predicted(false), skipPredictor(false)
 {
    
     // for subclasses
@@ -63,6 +73,193 @@ StaticIntegrator::StaticIntegrator(int clasTag)
 
 StaticIntegrator::~StaticIntegrator()
 {
+  if (lastU != 0)
+    delete lastU;
+  if (deltaU1 != 0)
+    delete deltaU1;
+  if (deltaU2 != 0)
+    delete deltaU2;
+  if (predictedU != 0)
+    delete predictedU;
+}
+
+int
+StaticIntegrator::setPredictor(int order)
+{
+  if (order < 0 || order > 2) {
+    opserr << "WARNING StaticIntegrator::setPredictor() - order " << order;
+    opserr << " not 0 (tangent), 1 (secant) or 2 (quadratic), tangent assumed\n";
+    order = 0;
+  }
+  predictorOrder = order;
+  return 0;
+}
+
+int
+StaticIntegrator::getPredictor(void) const
+{
+  return predictorOrder;
+}
+
+int
+StaticIntegrator::getPredictorType(const char *type)
+{
+  if (type == 0)
+    return -1;
+  if (strcmp(type, "tangent") == 0 || strcmp(type, "Tangent") == 0)
+    return 0;
+  if (strcmp(type, "secant") == 0 || strcmp(type, "Secant") == 0)
+    return 1;
+  if (strcmp(type, "quadratic") == 0 || strcmp(type, "Quadratic") == 0)
+    return 2;
+  return -1;
+}
+
+void
+StaticIntegrator::resetPredictor(void)
+{
+  numIncrements = -1;
+  predicted = false;
+  skipPredictor = false;
+}
+
+int
+StaticIntegrator::domainChanged(void)
+{
+  // the equation numbers may have changed
+  this->resetPredictor();
+  return this->IncrementalIntegrator::domainChanged();
+}
+
+int
+StaticIntegrator::commit(void)
+{
+  if (predictorOrder > 0) {
+    AnalysisModel *theModel = this->getAnalysisModel();
+    int size = theModel->getNumEqn();
+
+    if (lastU == 0 || lastU->Size() != size) {
+      if (lastU != 0) {
+	delete lastU;
+	delete deltaU1;
+	delete deltaU2;
+	delete predictedU;
+      }
+      lastU = new Vector(size);
+      deltaU1 = new Vector(size);
+      deltaU2 = new Vector(size);
+      predictedU = new Vector(size);
+      this->resetPredictor();
+    }
+
+    // the converged displacements, deltaU2 is used as work space until
+    // the increments are shifted below
+    Vector &U = *deltaU2;
+    U.Zero();
+    DOF_GrpIter &theDOFs = theModel->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != 0) {
+      const ID &id = dofPtr->getID();
+      const Vector &disp = dofPtr->getTrialDisp();
+      for (int i = 0; i < id.Size(); i++) {
+	int loc = id(i);
+	if (loc >= 0 && loc < size)
+	  U(loc) = disp(i);
+      }
+    }
+    double lambda = theModel->getCurrentDomainTime();
+
+    if (numIncrements >= 0) {
+      // the increment of this step: U - lastU, held in lastU
+      lastU->addVector(-1.0, U, 1.0);
+      double dLambda = lambda - lastLambda;
+
+      // check the prediction this step was started from
+      skipPredictor = false;
+      if (predicted) {
+	double norm = lastU->Norm()*predictedU->Norm();
+	if (norm > 0.0 && ((*lastU)^(*predictedU)) < STATIC_PREDICTOR_MIN_COS*norm)
+	  skipPredictor = true;
+      }
+
+      // shift the history: deltaU2 <- deltaU1 <- increment, lastU <- U
+      Vector *work = deltaU2;
+      deltaU2 = deltaU1;
+      deltaU1 = lastU;
+      lastU = work;
+      deltaLambda2 = deltaLambda1;
+      deltaLambda1 = dLambda;
+      if (numIncrements < 2)
+	numIncrements++;
+    } else {
+      (*lastU) = U;
+      numIncrements = 0;
+    }
+
+    lastLambda = lambda;
+    predicted = false;
+  }
+
+  return this->IncrementalIntegrator::commit();
+}
+
+const Vector *
+StaticIntegrator::formPredictor(double stepRatio, double &dLambda)
+{
+  if (predictorOrder <= 0 || numIncrements < 1)
+    return 0;
+
+  // one step back to the tangent after a poor extrapolation
+  if (skipPredictor == true) {
+    skipPredictor = false;
+    return 0;
+  }
+
+  // lengths of the last increments along the path
+  double h1 = sqrt(((*deltaU1)^(*deltaU1)) + deltaLambda1*deltaLambda1);
+  if (h1 == 0.0 || stepRatio <= 0.0)
+    return 0;
+
+  // secant: the last increment, scaled to the new step size
+  Vector &dU = *predictedU;
+  dU.addVector(0.0, *deltaU1, stepRatio);
+  dLambda = stepRatio*deltaLambda1;
+
+  // quadratic: add the second divided difference of the path through
+  // the last three converged points, unless the path reversed
+  if (predictorOrder > 1 && numIncrements > 1) {
+    double h2 = sqrt(((*deltaU2)^(*deltaU2)) + deltaLambda2*deltaLambda2);
+    double dot = ((*deltaU1)^(*deltaU2)) + deltaLambda1*deltaLambda2;
+    if (h2 > 0.0 && dot > 0.0) {
+      double h = stepRatio*h1;
+      double c = h*(h + h1)/(h1 + h2);
+      dU.addVector(1.0, *deltaU1, c/h1);
+      dU.addVector(1.0, *deltaU2, -c/h2);
+      dLambda += c*(deltaLambda1/h1 - deltaLambda2/h2);
+    }
+  }
+
+  predicted = true;
+
+  return predictedU;
+}
+
+const Vector *
+StaticIntegrator::getLastIncrement(double &dLambda) const
+{
+  dLambda = deltaLambda1;
+  if (numIncrements < 1)
+    return 0;
+  return deltaU1;
+}
+
+double
+StaticIntegrator::getStepFactor(double specNumIter, double numIterLastStep, double exponent)
+{
+  double factor = specNumIter/numIterLastStep;
+  if (exponent != 1.0)
+    factor = pow(factor, exponent);
+  return factor;
 }
 
 int
@@ -36,6 +36,14 @@
 // StaticIntegrator is an algorithmic class for setting up the finite element
 // equations for a static analysis and for Incrementing the nodal displacements
 // with the values in the soln vector to the LinearSOE object. 
+// 
+// A StaticIntegrator also keeps the converged increments (dU, dLambda) of
+// the last two steps, so that a subclass can start a step from a secant
+// (one increment) or quadratic (two increments) extrapolation of the
+// equilibrium path instead of from the linear tangent predictor. The
+// extrapolation falls back to the lower order or to the tangent when the
+// history is missing, the path reversed its direction or the last
+// extrapolated step ended far from where it was predicted.
 //
 // What: "@(#) StaticIntegrator.h, revA"
 
@@ -64,10 +72,34 @@ class StaticIntegrator : public IncrementalIntegrator
    
    virtual int newStep(void) =0;    
 
+    virtual int commit(void);
+    virtual int domainChanged(void);
+
+    // predictor order: 0 tangent (default), 1 secant, 2 quadratic
+    int setPredictor(int order);
+    int getPredictor(void) const;
+    static int getPredictorType(const char *type);
+
   protected:
+    // extrapolates the increment of the next step; stepRatio is the size of
+    // the next step relative to the last one, as measured by the subclass.
+    // returns 0 if the tangent predictor is to be used
+    const Vector *formPredictor(double stepRatio, double &dLambda);
+    const Vector *getLastIncrement(double &dLambda) const;
+    void resetPredictor(void);
 
+    // factor (Jd/J)^exponent on the step size after a step of J iterations
+    static double getStepFactor(double specNumIter, double numIterLastStep,
+				double exponent = 1.0);
  
   private:
+    int predictorOrder;
+    Vector *lastU;                   // converged U at the end of the last step
+    Vector *deltaU1, *deltaU2;       // converged increments of the last two steps
+    Vector *predictedU;              // increment predicted for the current step
+    double lastLambda, deltaLambda1, deltaLambda2;
+    int numIncrements;               // valid increments, -1 if lastU is not set
+    bool predicted, skipPredictor;
 };
 
 #endif
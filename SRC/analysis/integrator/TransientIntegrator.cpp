@@ -40,10 +40,12 @@
 #include <FE_Element.h>
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
+#include <Domain.h>
 #include <Vector.h>
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <PhaseTimer.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
 :IncrementalIntegrator(clasTag)
@@ -56,6 +58,19 @@ TransientIntegrator::~TransientIntegrator()
 
 }
 
+void
+TransientIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, ConvergenceTest *theConvergenceTest)
+{
+    this->IncrementalIntegrator::setLinks(theModel, theLinSOE, theConvergenceTest);
+
+    // only displacements are tracked, the velocities and the time change
+    // the state of viscous and rate dependent elements, so no element is
+    // skipped in a transient analysis
+    Domain *theDomain = theModel.getDomainPtr();
+    if (theDomain != 0)
+      theDomain->allowQuiescentSkip(false);
+}
+
 int 
 TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
 {
@@ -67,6 +82,8 @@ TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
 int 
 TransientIntegrator::formTangent(int statFlag)
 {
+    PhaseTimer theTimer(PhaseTimer::Assembly);
+    PhaseTimer::tangentFormed();
     int result = 0;
     statusFlag = statFlag;
 
@@ -113,6 +130,10 @@ TransientIntegrator::formTangent(int statFlag)
 	    result = -2;
 	}
     }
+
+    if (this->formInactiveTangent() < 0)
+	result = -2;
+
     return result;
 }
 
@@ -120,6 +141,7 @@ TransientIntegrator::formTangent(int statFlag)
     
 int
 TransientIntegrator::formUnbalance(void) {
+    PhaseTimer theTimer(PhaseTimer::Assembly);
     LinearSOE *theLinSOE = this->getLinearSOE();
     AnalysisModel *theModel = this->getAnalysisModel();
 
@@ -128,6 +150,8 @@ TransientIntegrator::formUnbalance(void) {
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
 	return -1;
     }
+
+    this->refreshStalledElements();
     
     theLinSOE->zeroB();
 
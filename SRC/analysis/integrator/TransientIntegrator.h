@@ -53,6 +53,10 @@ class TransientIntegrator : public IncrementalIntegrator
     TransientIntegrator(int classTag);
     virtual ~TransientIntegrator();
 
+    virtual void setLinks(AnalysisModel &theModel,
+			  LinearSOE &theSOE,
+			  ConvergenceTest *theTest);
+
     virtual int formTangent(int statFlag);
     virtual int formTangent(int statusFlag, 
 			    double iFactor,
@@ -53,25 +53,224 @@
 #include <Node.h>
 #include <MP_ConstraintIter.h>
 #include <DOF_GrpIter.h>
+#include <elementAPI.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// ordering cache: one file per topology hash in orderingCacheDir
+static char *orderingCacheDir = 0;
+static const int ORDERING_CACHE_MAGIC = 0x4f50534f; // "OPSO"
+static const int ORDERING_CACHE_VERSION = 1;
+
+static inline void
+hashInt(unsigned long long &hash, int value)
+{
+  // FNV-1a, 64 bit
+  unsigned int v = (unsigned int)value;
+  for (int i=0; i<4; i++) {
+    hash ^= (unsigned long long)(v & 0xff);
+    hash *= 1099511628211ULL;
+    v >>= 8;
+  }
+}
+
+static unsigned long long
+topologyHash(AnalysisModel &theModel, GraphNumberer &theGraphNumberer,
+	     int lastDOF_Group, const ID *lastDOF_Groups)
+{
+  unsigned long long hash = 14695981039346656037ULL;
+
+  hashInt(hash, theGraphNumberer.getClassTag());
+  if (lastDOF_Groups != 0) {
+    hashInt(hash, lastDOF_Groups->Size());
+    for (int i=0; i<lastDOF_Groups->Size(); i++)
+      hashInt(hash, (*lastDOF_Groups)(i));
+  } else {
+    hashInt(hash, -1);
+    hashInt(hash, lastDOF_Group);
+  }
+
+  // the DOF_Groups, with the constraint flags set by the handler
+  hashInt(hash, theModel.getNumDOF_Groups());
+  DOF_GrpIter &theDOFs = theModel.getDOFs();
+  DOF_Group *dofPtr;
+  while ((dofPtr = theDOFs()) != 0) {
+    hashInt(hash, dofPtr->getTag());
+    hashInt(hash, dofPtr->getNodeTag());
+    const ID &theID = dofPtr->getID();
+    hashInt(hash, theID.Size());
+    for (int i=0; i<theID.Size(); i++)
+      hashInt(hash, theID(i));
+  }
+
+  // the FE_Elements, i.e. the edges of the DOF_Group graph
+  int numEle = 0;
+  FE_EleIter &theEles = theModel.getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+    const ID &dofTags = elePtr->getDOFtags();
+    hashInt(hash, dofTags.Size());
+    for (int i=0; i<dofTags.Size(); i++)
+      hashInt(hash, dofTags(i));
+    numEle++;
+  }
+  hashInt(hash, numEle);
+
+  return hash;
+}
+
+static std::string
+orderingCacheFile(unsigned long long hash)
+{
+  char name[32];
+  snprintf(name, 32, "%016llx.ord", hash);
+  std::string fileName(orderingCacheDir);
+  if (!fileName.empty() && fileName[fileName.size()-1] != '/')
+    fileName += '/';
+  fileName += name;
+  return fileName;
+}
+
+static bool
+loadOrdering(unsigned long long hash, AnalysisModel &theModel, ID &orderedRefs)
+{
+  std::ifstream theFile(orderingCacheFile(hash).c_str(), std::ios::in | std::ios::binary);
+  if (!theFile.is_open())
+    return false;
+
+  int header[2];
+  unsigned long long fileHash = 0;
+  int size = 0;
+  theFile.read((char *)header, sizeof(header));
+  theFile.read((char *)&fileHash, sizeof(fileHash));
+  theFile.read((char *)&size, sizeof(size));
+  if (!theFile || header[0] != ORDERING_CACHE_MAGIC || header[1] != ORDERING_CACHE_VERSION
+      || fileHash != hash || size != theModel.getNumDOF_Groups())
+    return false;
+
+  // the ordering must be a permutation of the DOF_Group tags 0..size-1
+  std::vector<bool> seen(size, false);
+  orderedRefs.resize(size);
+  for (int i=0; i<size; i++) {
+    int dofTag;
+    theFile.read((char *)&dofTag, sizeof(dofTag));
+    if (!theFile || dofTag < 0 || dofTag >= size || seen[dofTag]
+	|| theModel.getDOF_GroupPtr(dofTag) == 0)
+      return false;
+    seen[dofTag] = true;
+    orderedRefs(i) = dofTag;
+  }
+
+  return true;
+}
+
+static void
+saveOrdering(unsigned long long hash, const ID &orderedRefs)
+{
+  // write to a temporary file, unique to this process, and rename, so
+  // that concurrent runs never read a partially written ordering
+  static int numSaved = 0;
+  std::string fileName = orderingCacheFile(hash);
+  char suffix[48];
+  snprintf(suffix, 48, ".%ld.%d.tmp", (long)getpid(), numSaved++);
+  std::string tmpName = fileName + suffix;
+
+  std::ofstream theFile(tmpName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!theFile.is_open()) {
+    opserr << "WARNING DOF_Numberer - could not write ordering cache file ";
+    opserr << tmpName.c_str() << endln;
+    return;
+  }
+
+  int header[2] = {ORDERING_CACHE_MAGIC, ORDERING_CACHE_VERSION};
+  int size = orderedRefs.Size();
+  theFile.write((const char *)header, sizeof(header));
+  theFile.write((const char *)&hash, sizeof(hash));
+  theFile.write((const char *)&size, sizeof(size));
+  for (int i=0; i<size; i++) {
+    int dofTag = orderedRefs(i);
+    theFile.write((const char *)&dofTag, sizeof(dofTag));
+  }
+  theFile.close();
+
+  if (!theFile || rename(tmpName.c_str(), fileName.c_str()) != 0)
+    remove(tmpName.c_str());
+}
+
+int
+DOF_Numberer::setOrderingCache(const char *dirName)
+{
+  if (orderingCacheDir != 0)
+    delete [] orderingCacheDir;
+  orderingCacheDir = 0;
+
+  if (dirName != 0) {
+    orderingCacheDir = new char[strlen(dirName)+1];
+    strcpy(orderingCacheDir, dirName);
+  }
+
+  return 0;
+}
+
+const char *
+DOF_Numberer::getOrderingCache(void)
+{
+  return orderingCacheDir;
+}
+
+int OPS_NumbererCache()
+{
+    // numbererCache dirName <or> numbererCache -off
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	const char *dirName = DOF_Numberer::getOrderingCache();
+	if (dirName != 0)
+	    opserr << "numbererCache " << dirName << endln;
+	else
+	    opserr << "numbererCache -off\n";
+	return 0;
+    }
+
+    const char *dirName = OPS_GetString();
+    if (dirName == 0) {
+	opserr << "WARNING numbererCache dirName <or> numbererCache -off\n";
+	return -1;
+    }
+
+    if (strcmp(dirName, "-off") == 0)
+	return DOF_Numberer::setOrderingCache(0);
+
+    return DOF_Numberer::setOrderingCache(dirName);
+}
+
 // Constructor
 
 DOF_Numberer::DOF_Numberer(int clsTag) 
 :MovableObject(clsTag),
- theAnalysisModel(0), theGraphNumberer(0)
+ theAnalysisModel(0), theGraphNumberer(0), cachedRefs(0)
 {
 
 }
 
 DOF_Numberer::DOF_Numberer(GraphNumberer &aGraphNumberer)
 :MovableObject(NUMBERER_TAG_DOF_Numberer),
- theAnalysisModel(0), theGraphNumberer(&aGraphNumberer)
+ theAnalysisModel(0), theGraphNumberer(&aGraphNumberer), cachedRefs(0)
 {
 
 }    
 
 DOF_Numberer::DOF_Numberer()
 :MovableObject(NUMBERER_TAG_DOF_Numberer),
- theAnalysisModel(0), theGraphNumberer(0)
+ theAnalysisModel(0), theGraphNumberer(0), cachedRefs(0)
 {
 
 }    
@@ -82,6 +281,8 @@ DOF_Numberer::~DOF_Numberer()
 {
   if (theGraphNumberer != 0)
     delete theGraphNumberer;
+  if (cachedRefs != 0)
+    delete cachedRefs;
 }
 
 
@@ -121,10 +322,7 @@ DOF_Numberer::numberDOF(int lastDOF_Group)
 
     // we first number the dofs using the dof group graph
 
-    const ID &orderedRefs = theGraphNumberer->
-      number(theAnalysisModel->getDOFGroupGraph(), lastDOF_Group);     
-
-    theAnalysisModel->clearDOFGroupGraph();
+    const ID &orderedRefs = *(this->orderDOF_Groups(lastDOF_Group, 0));
 
     // we now iterate through the DOFs first time setting -2 values
 
@@ -253,10 +451,7 @@ DOF_Numberer::numberDOF(ID &lastDOFs)
 
     // we first number the dofs using the dof group graph
 	
-    const ID &orderedRefs = theGraphNumberer->
-	number(theAnalysisModel->getDOFGroupGraph(), lastDOFs);     
-
-    theAnalysisModel->clearDOFGroupGraph();
+    const ID &orderedRefs = *(this->orderDOF_Groups(-1, &lastDOFs));
 
     // we now iterate through the DOFs first time setting -2 values
 
@@ -403,6 +598,40 @@ DOF_Numberer::recvSelf(int cTag, Channel &theChannel,
 }
 
 
+// const ID *orderDOF_Groups(int lastDOF_Group, const ID *lastDOF_Groups)
+//	Method to order the DOF_Groups with theGraphNumberer, or to reload
+//	the ordering from the cache if the topology has been seen before.
+
+const ID *
+DOF_Numberer::orderDOF_Groups(int lastDOF_Group, const ID *lastDOF_Groups)
+{
+    unsigned long long hash = 0;
+    if (orderingCacheDir != 0) {
+	hash = topologyHash(*theAnalysisModel, *theGraphNumberer,
+			    lastDOF_Group, lastDOF_Groups);
+	if (cachedRefs == 0)
+	    cachedRefs = new ID(theAnalysisModel->getNumDOF_Groups());
+	if (loadOrdering(hash, *theAnalysisModel, *cachedRefs))
+	    return cachedRefs;
+    }
+
+    const ID *orderedRefs;
+    if (lastDOF_Groups != 0)
+	orderedRefs = &(theGraphNumberer->
+			number(theAnalysisModel->getDOFGroupGraph(), *lastDOF_Groups));
+    else
+	orderedRefs = &(theGraphNumberer->
+			number(theAnalysisModel->getDOFGroupGraph(), lastDOF_Group));
+
+    theAnalysisModel->clearDOFGroupGraph();
+
+    if (orderingCacheDir != 0 && orderedRefs->Size() == theAnalysisModel->getNumDOF_Groups())
+	saveOrdering(hash, *orderedRefs);
+
+    return orderedRefs;
+}
+
+
 AnalysisModel *
 DOF_Numberer::getAnalysisModelPtr(void) const
 {
@@ -33,6 +33,13 @@
 // DOF_Numberer is an abstract base class, i.e. no objects of it's
 // type can be created. 
 //
+// The ordering of the DOF_Groups produced by the GraphNumberer can be
+// kept in an opt-in on-disk cache (setOrderingCache()). The cache is
+// keyed by a hash of the DOF_Group/FE_Element connectivity, the
+// constrained dofs and the GraphNumberer type, so a later run of the same
+// model reloads the ordering instead of building the DOF_Group graph and
+// renumbering it.
+//
 // What: "@(#) DOF_Numberer.h, revA"
 
 #ifndef DOF_Numberer_h
@@ -63,6 +70,10 @@ class DOF_Numberer: public MovableObject
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
 			 FEM_ObjectBroker &theBroker);
+
+    // directory of the ordering cache, 0 to turn the cache off
+    static int setOrderingCache(const char *dirName);
+    static const char *getOrderingCache(void);
     
 
   protected:
@@ -70,8 +81,11 @@ class DOF_Numberer: public MovableObject
     GraphNumberer *getGraphNumbererPtr(void) const;
     
   private:
+    const ID *orderDOF_Groups(int lastDOF_Group, const ID *lastDOF_Groups);
+
     AnalysisModel *theAnalysisModel;
     GraphNumberer *theGraphNumberer;
+    ID *cachedRefs;
 };
 
 #endif
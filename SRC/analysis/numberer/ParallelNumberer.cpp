@@ -48,9 +48,17 @@
 #include <MP_ConstraintIter.h>
 #include <Node.h>
 
+#include <map>
+#include <vector>
+#include <algorithm>
+
+#if defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+#include <mpi.h>
+#endif
+
 
 ParallelNumberer::ParallelNumberer(int dTag, int numSub, Channel **theC) 
-  :DOF_Numberer(NUMBERER_TAG_ParallelNumberer), 
+  :DOF_Numberer(NUMBERER_TAG_ParallelNumberer), theNumberer(0),
    processID(dTag), numChannels(numSub)
 
 {
@@ -109,12 +117,31 @@ ParallelNumberer::setChannels(int nChannels, Channel **theC)
 
 
 // int numberDOF(void)
-// The ParallelNumberer sitting on P0, collects each partition graph from P1 through Pn-1, 
-// merges them into 1 large graph, & then numbers this graph. The ParallelNumberers sitting 
-// on P1 through Pn-1 then receive the mapping info for the dof tag and dof numbering from P0.
+// Each ParallelNumberer orders the DOF_Groups of its own partition, using the
+// GraphNumberer on the partition graph if one was provided, and finds which of
+// its nodes are shared with other partitions (see findInterfaceNodes()). The
+// partitions then send P0 only their number of interior equations and the node
+// tags and number of free dofs of their interface nodes. P0 returns to each
+// partition the start equation of its interior block and the start equations
+// of its interface nodes. The interior dofs of P0, P1, .. Pn-1 are numbered in
+// turn in their local order, the interface dofs last in ascending node tag
+// order. DOF_Groups without a node, e.g. those of Lagrange multipliers, are
+// interior to their partition.
 
 int
 ParallelNumberer::numberDOF(int lastDOF)
+{
+  if (lastDOF != -1) {
+    opserr << "WARNING ParallelNumberer::numberDOF(int lastDOF):";
+    opserr << " does not use the lastDOF as requested\n";
+  }
+
+  return this->numberDistributed();
+}
+
+
+int
+ParallelNumberer::numberDistributed(void)
 {
   int result = 0;
 
@@ -128,187 +155,181 @@ ParallelNumberer::numberDOF(int lastDOF)
     opserr << " - no AnalysisModel - has setLinks() been invoked?\n";
     return -1;
   }
-  
-  if (lastDOF != -1) {
-    opserr << "WARNING ParallelNumberer::numberDOF(int lastDOF):";
-    opserr << " does not use the lastDOF as requested\n";
-  }
 
-  Graph &theGraph = theModel->getDOFGroupGraph();
+  // order the local DOF_Groups & collect their node tags and number of free dof
+  int numVertex = theModel->getNumDOF_Groups();
+  ID localOrder(numVertex);
+  ID localData(2*numVertex);
 
-  // if subdomain, collect graph, send it off, get 
-  // ID back containing dof tags & start id numbers.
-  if (processID != 0) {
-
-    Channel *theChannel = theChannels[0];
-    int numVertex = theGraph.getNumVertex();
-
-    theGraph.sendSelf(0, *theChannel);
-
-    // recv iD
-    ID theID(2*numVertex);
-    theChannel->recvID(0, 0, theID);
-
-    // set vertex numbering based on ID received
-    for (int i=0; i<numVertex; i ++) {
-      int vertexTag = theID(i);
-      int startID = theID(i+numVertex);
-      //      Vertex *vertexPtr = theGraph.getVertexPtr(vertexTag);
-      int dofTag = vertexTag;
-      DOF_Group *dofPtr;	
-      dofPtr = theModel->getDOF_GroupPtr(dofTag);
-      if (dofPtr == 0) {
-	opserr << "WARNING ParallelNumberer::numberDOF - ";
-	opserr << "DOF_Group " << dofTag << "not in AnalysisModel!\n";
-	result = -4;
-      } else {
-	const ID &theDOFID = dofPtr->getID();
-	int idSize = theDOFID.Size();
-	for (int j=0; j<idSize; j++)
-	  if (theDOFID(j) == -2 || theDOFID(j) == -3) dofPtr->setID(j, startID++);
-      }
-      const ID &theDOFID = dofPtr->getID();
+  if (numVertex != 0) {
+    if (theNumberer != 0) {
+      localOrder = theNumberer->number(theModel->getDOFGroupGraph(), -1);
+      theModel->clearDOFGroupGraph();
+    } else {
+      DOF_GrpIter &theDOFs = theModel->getDOFs();
+      DOF_Group *dofPtr;
+      int loc = 0;
+      while ((dofPtr = theDOFs()) != 0)
+	localOrder[loc++] = dofPtr->getTag();
     }
+  }
 
-    theChannel->sendID(0, 0, theID);
-  } 
-  
-  // if main domain, collect graphs from all subdomains,
-  // merge into 1, number this one, send to subdomains the
-  // id containing dof tags & start id's.
-  else {
-
-    // for P0 domain determine original vertex and ref tags
-    int numVertex = theGraph.getNumVertex(); 
-    int numVertexP0 = numVertex;
-
-    ID vertexTags(numVertex);
-    ID vertexRefs(numVertex);
-    Vertex *vertexPtr;
-    int loc = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((vertexPtr = theVertices()) != 0) {
-      vertexTags[loc] = vertexPtr->getTag();
-      vertexRefs[loc] = vertexPtr->getRef();
-      loc++;
+  for (int i=0; i<numVertex; i++) {
+    DOF_Group *dofPtr = theModel->getDOF_GroupPtr(localOrder(i));
+    if (dofPtr == 0) {
+      opserr << "WARNING ParallelNumberer::numberDOF - ";
+      opserr << "DOF_Group " << localOrder(i) << "not in AnalysisModel!\n";
+      return -4;
     }
-    
-    ID **theSubdomainIDs = new ID *[numChannels];
-    FEM_ObjectBroker theBroker;
+    localData(2*i) = dofPtr->getNodeTag();
+    localData(2*i+1) = dofPtr->getNumFreeDOF();
+  }
 
-    // for each subdomain we receive graph, create an ID (to store
-    // subdomain graph to merged graph vertex mapping and the final
-    // subdoain graph vertex to startDOF mapping) and finally merge the
-    // subdomain graph
+  // split the local DOF_Groups into interior and interface ones
+  ID isInterface(numVertex);
+  if (this->findInterfaceNodes(localData, isInterface) < 0)
+    result = -5;
+
+  int numInterior = 0;
+  int numInterface = 0;
+  for (int i=0; i<numVertex; i++) {
+    if (isInterface(i) != 0)
+      numInterface++;
+    else
+      numInterior += localData(2*i+1);
+  }
 
-    for (int j=0; j<numChannels; j++) {
-      Channel *theChannel = theChannels[j];
-      Graph *theSubGraph = new Graph();
+  // (node tag, number of free dof) and location in localOrder of the interface nodes
+  ID interfaceData(2*numInterface);
+  ID interfaceLoc(numInterface);
+  int loc = 0;
+  for (int i=0; i<numVertex; i++)
+    if (isInterface(i) != 0) {
+      interfaceData(2*loc) = localData(2*i);
+      interfaceData(2*loc+1) = localData(2*i+1);
+      interfaceLoc(loc++) = i;
+    }
 
-      theSubGraph->recvSelf(0, *theChannel, theBroker);
+  // header: start of interior block, numEqn, number of interface nodes
+  ID header(3);
+  ID interfaceDOFs(2*numInterface);
 
-      theSubdomainIDs[j] = new ID(theSubGraph->getNumVertex()*2);
+  // if subdomain, send the counts and the interface nodes off, get back the
+  // start of the interior block and the start ids of the interface nodes
+  if (processID != 0) {
 
-      this->mergeSubGraph(theGraph, *theSubGraph, vertexTags, vertexRefs, *theSubdomainIDs[j]);
+    Channel *theChannel = theChannels[0];
 
-      delete theSubGraph;
+    header(0) = numInterior;
+    header(1) = 0;
+    header(2) = numInterface;
+    theChannel->sendID(0, 0, header);
+    if (numInterface != 0)
+      theChannel->sendID(0, 0, interfaceData);
+
+    ID interfaceStart(numInterface);
+    theChannel->recvID(0, 0, header);
+    if (numInterface != 0)
+      theChannel->recvID(0, 0, interfaceStart);
+
+    for (int i=0; i<numInterface; i++) {
+      interfaceDOFs(2*i) = interfaceLoc(i);
+      interfaceDOFs(2*i+1) = interfaceStart(i);
     }
-    
-    // we use graph numberer if one was provided in constructor,
-    // otherwise we number based on subdomains (all in subdomain 1 numbered first, 
-    // then  those in 2 not in 1 and so on till done.
-    //    GraphNumberer *theNumberer = this->getGraphNumbererPtr();
 
-    ID *theOrderedRefs = new ID(theGraph.getNumVertex());
+    if (this->setLocalNumbering(localOrder, header(0), interfaceDOFs) < 0)
+      result = -4;
 
-    if (theNumberer != 0) {
-
-      // use the supplied graph numberer to number the merged graph
-      *theOrderedRefs = theNumberer->number(theGraph, lastDOF);     
+    header(0) = result;
+    theChannel->sendID(0, 0, header);
+  } 
+  
+  // if main domain, collect the counts and interface nodes of all the
+  // subdomains, determine the start of each interior block and number
+  // the interface nodes
+  else {
 
-    } else {
+    int numPartitions = numChannels+1;
+    ID interiorStart(numPartitions);
+    ID **theInterfaces = new ID *[numPartitions];
+    theInterfaces[0] = &interfaceData;
 
-      // assign numbers based on the subdomains
+    int numEqn = numInterior;
+    for (int j=0; j<numChannels; j++) {
+      Channel *theChannel = theChannels[j];
+      theChannel->recvID(0, 0, header);
+      interiorStart(j+1) = numEqn;
+      numEqn += header(0);
+      theInterfaces[j+1] = new ID(2*header(2));
+      if (header(2) != 0)
+	theChannel->recvID(0, 0, *theInterfaces[j+1]);
+    }
 
-      int loc = 0;
-      for (int l=0; l<numChannels; l++) {
-	const ID &theSubdomain = *theSubdomainIDs[l];
-	int numVertexSubdomain = theSubdomain.Size()/2;
-
-	for (int i=0; i<numVertexSubdomain; i++) {
-	  int vertexTagMerged = theSubdomain(i+numVertexSubdomain);
-	  //  int refTag = vertexRefs[vertexTags.getLocation(vertexTagMerged)];
-	  if (theOrderedRefs->getLocation(vertexTagMerged) == -1)
-	    (*theOrderedRefs)[loc++] = vertexTagMerged;
+    // the interface nodes, each once, numbered last in ascending tag order
+    std::map<int, ParallelNumbererNode> theNodes;
+    for (int j=0; j<numPartitions; j++) {
+      const ID &data = *theInterfaces[j];
+      int numInterfaceJ = data.Size()/2;
+      for (int i=0; i<numInterfaceJ; i++) {
+	int nodeTag = data(2*i);
+	int numDOF = data(2*i+1);
+	std::map<int, ParallelNumbererNode>::iterator theNode = theNodes.find(nodeTag);
+	if (theNode == theNodes.end()) {
+	  ParallelNumbererNode newNode = {numDOF, -1};
+	  theNodes[nodeTag] = newNode;
+	} else if (theNode->second.numDOF != numDOF) {
+	  opserr << "WARNING ParallelNumberer::numberDOF - node " << nodeTag;
+	  opserr << " has a different number of free dof in different partitions\n";
+	  result = -5;
 	}
       }
-
-      // now order those not yet ordered in p0
-      for (int j=0; j<numVertexP0; j++) {
-	int refTagP0 = vertexTags[j];
-	if (theOrderedRefs->getLocation(refTagP0) == -1)
-	  (*theOrderedRefs)[loc++] = refTagP0;
-      }	
     }
 
-    int count = 0;
-    for (int i=0; i<theOrderedRefs->Size(); i++) {
-      int vertexTag = (*theOrderedRefs)(i);
-      //      int vertexTag = vertexTags[vertexRefs.getLocation(tag)];
-      Vertex *vertexPtr = theGraph.getVertexPtr(vertexTag);
-      int numDOF= vertexPtr->getColor();
-      vertexPtr->setTmp(count);
-      count += numDOF;
+    std::map<int, ParallelNumbererNode>::iterator theNode;
+    for (theNode = theNodes.begin(); theNode != theNodes.end(); theNode++) {
+      theNode->second.startDOF = numEqn;
+      numEqn += theNode->second.numDOF;
     }
 
-    if (theNumberer == 0)
-      delete theOrderedRefs;
-
-    // number own dof's
-    for (int i=0; i<numVertexP0; i++  ) {
-      int vertexTag = vertexTags(i);
-      Vertex *vertexPtr = theGraph.getVertexPtr(vertexTag);
-
-      int startID = vertexPtr->getTmp();
-      int dofTag = vertexTag;
-      DOF_Group *dofPtr;	
-      dofPtr = theModel->getDOF_GroupPtr(dofTag);
-      if (dofPtr == 0) {
-	opserr << "WARNING ParallelNumberer::numberDOF - ";
-	opserr << "DOF_Group (P0) " << dofTag << "not in AnalysisModel!\n";
-	result = -4;
+    // send each subdomain its interior start and interface dofs, P0 numbers
+    // its own last so that the subdomains number theirs at the same time
+    for (int j=numPartitions-1; j>=0; j--) {
+      const ID &data = *theInterfaces[j];
+      int numInterfaceJ = data.Size()/2;
+      ID interfaceStart(numInterfaceJ);
+      for (int i=0; i<numInterfaceJ; i++)
+	interfaceStart(i) = theNodes[data(2*i)].startDOF;
+
+      if (j == 0) {
+	for (int i=0; i<numInterface; i++) {
+	  interfaceDOFs(2*i) = interfaceLoc(i);
+	  interfaceDOFs(2*i+1) = interfaceStart(i);
+	}
+	if (this->setLocalNumbering(localOrder, interiorStart(0), interfaceDOFs) < 0)
+	  result = -4;
       } else {
-	const ID &theDOFID = dofPtr->getID();
-	int idSize = theDOFID.Size();
-	for (int j=0; j<idSize; j++)
-	  if (theDOFID(j) == -2 || theDOFID(j) == -3) dofPtr->setID(j, startID++);
+	Channel *theChannel = theChannels[j-1];
+	header(0) = interiorStart(j);
+	header(1) = numEqn;
+	header(2) = numInterfaceJ;
+	theChannel->sendID(0, 0, header);
+	if (numInterfaceJ != 0)
+	  theChannel->sendID(0, 0, interfaceStart);
+	delete theInterfaces[j];
       }
     }
+    delete [] theInterfaces;
 
-    // now given the ordered refs we determine the mapping for each subdomain
-    // and send the id with the information back to the subdomain, which it uses to order
-    // it's own graph
-    for (int k=0; k<numChannels; k++) {
-      Channel *theChannel = theChannels[k];
-      ID &theSubdomain = *theSubdomainIDs[k];
-      int numVertexSubdomain = theSubdomain.Size()/2;
-
-      for (int i=0; i<numVertexSubdomain; i++) {
-	int vertexTagMerged = theSubdomain[numVertexSubdomain+i];
-	Vertex *vertexPtr = theGraph.getVertexPtr(vertexTagMerged);
-	int startDOF = vertexPtr->getTmp();
-	theSubdomain[i+numVertexSubdomain] = startDOF;
-      }
+    // wait till all the subdomains have numbered their dofs
+    for (int j=0; j<numChannels; j++) {
+      theChannels[j]->recvID(0, 0, header);
+      if (header(0) < 0)
+	result = header(0);
+    }
 
-      theChannel->sendID(0, 0, theSubdomain);
-      theChannel->recvID(0, 0, theSubdomain);
-      delete theSubdomainIDs[k];
-    }      
-    delete [] theSubdomainIDs;
+    header(1) = numEqn;
   }
 
-
-
   // iterate through the DOFs one last time setting any -4 values
   // iterate through  the DOFs second time setting -3 values
   AnalysisModel *theAModel = this->getAnalysisModelPtr();
@@ -355,72 +376,235 @@ ParallelNumberer::numberDOF(int lastDOF)
   while ((elePtr = theEle()) != 0)
     elePtr->setID();
 
-  theModel->clearDOFGroupGraph();
+  theModel->setNumEqn(header(1));
   
   return result;
 }
 
 
+// marks the (tag, partition) pairs whose tag comes from more than one
+// partition; a partition may list a tag more than once
+static void
+markSharedTags(const std::vector<int> &tags, const std::vector<int> &partitions,
+	       std::vector<int> &shared)
+{
+  int numTags = tags.size();
+  std::vector<std::pair<int, int> > sorted(numTags);
+  for (int k=0; k<numTags; k++)
+    sorted[k] = std::pair<int, int>(tags[k], k);
+  std::sort(sorted.begin(), sorted.end());
+
+  shared.assign(numTags, 0);
+  int first = 0;
+  while (first < numTags) {
+    int last = first+1;
+    bool isShared = false;
+    while (last < numTags && sorted[last].first == sorted[first].first) {
+      if (partitions[sorted[last].second] != partitions[sorted[first].second])
+	isShared = true;
+      last++;
+    }
+    if (isShared == true)
+      for (int k=first; k<last; k++)
+	shared[sorted[k].second] = 1;
+    first = last;
+  }
+}
+
+
+// int findInterfaceNodes(const ID &localData, ID &isInterface)
+// Sets isInterface(i) to 1 if the node of the i'th (node tag, number of free
+// dof) pair in localData is also in another partition. In the MPI builds the
+// node tags are spread over the processes by tag, each process finds the
+// shared ones among the tags it was given and sends the answer back, so no
+// process holds more than its share of the node tags; all the processes in
+// MPI_COMM_WORLD must take part. Otherwise the node tags are gathered on P0.
+
 int
-ParallelNumberer::mergeSubGraph(Graph &theGraph, Graph &theSubGraph, ID &vertexTags, ID &vertexRefs, ID &theSubdomainMap)
-{  
-  // for each vertex in the SubGraph we see if a vertex exists in the Graph which has the same
-  // reference tag (Reference tag in the AnalysisModel graph is the node tag) .. if so this will be 
-  // the new vertex tag for SubGraph vertex in new graph, otherwise we assign it some new vertex tag,
-  // create a vertex for this new vertex tag & add it to the graph
-
-  Vertex *subVertexPtr;
-  VertexIter &theSubGraphIter1 = theSubGraph.getVertices();
-  int count =0;
-  int numVertex = theGraph.getNumVertex();
-  int numVertexSub = theSubGraph.getNumVertex();
-
-  while ((subVertexPtr = theSubGraphIter1()) != 0) {
-    int vertexTagSub = subVertexPtr->getTag();
-    int vertexTagRef = subVertexPtr->getRef();
-    int loc = vertexRefs.getLocation(vertexTagRef);
-
-    int vertexTagMerged;
-    if (loc < 0) {
-      // if not already in, we will be creating a new vertex
-      vertexTagMerged = theGraph.getFreeTag();
-      vertexTags[numVertex] = vertexTagMerged;
-      vertexRefs[numVertex] = vertexTagRef;
-      Vertex *newVertex = new Vertex(vertexTagMerged, vertexTagRef, subVertexPtr->getWeight(), subVertexPtr->getColor());
-
-      theGraph.addVertex(newVertex);
-      numVertex++;
-    } else
-      vertexTagMerged = vertexTags[loc];
-
-    // use the subgraphs ID to hold the mapping of vertex numbers between merged and original
-    theSubdomainMap[count] = vertexTagSub;
-    theSubdomainMap[count+numVertexSub] = vertexTagMerged;
-    count++;
+ParallelNumberer::findInterfaceNodes(const ID &localData, ID &isInterface)
+{
+  int numVertex = localData.Size()/2;
+  for (int i=0; i<numVertex; i++)
+    isInterface(i) = 0;
+
+  // the local DOF_Groups with a node, those without one are interior
+  std::vector<int> localLoc;
+  for (int i=0; i<numVertex; i++)
+    if (localData(2*i) >= 0)
+      localLoc.push_back(i);
+  int numLocal = localLoc.size();
+
+#if defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+
+  int numProcesses = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &numProcesses);
+  if (numProcesses == 1)
+    return 0;
+
+  // send each node tag to process tag % numProcesses
+  std::vector<int> sendCounts(numProcesses, 0), sendDispls(numProcesses, 0);
+  std::vector<int> recvCounts(numProcesses, 0), recvDispls(numProcesses, 0);
+  for (int k=0; k<numLocal; k++)
+    sendCounts[localData(2*localLoc[k]) % numProcesses]++;
+  for (int p=1; p<numProcesses; p++)
+    sendDispls[p] = sendDispls[p-1] + sendCounts[p-1];
+
+  // one extra entry so that the buffers are never empty
+  std::vector<int> sendTags(numLocal+1), sendLoc(numLocal+1);
+  std::vector<int> next(sendDispls);
+  for (int k=0; k<numLocal; k++) {
+    int tag = localData(2*localLoc[k]);
+    int pos = next[tag % numProcesses]++;
+    sendTags[pos] = tag;
+    sendLoc[pos] = localLoc[k];
   }
 
-  // for each vertex in subgraph, we add it's adjacenecy into the merged graph
-  VertexIter &theSubGraphIter2 = theSubGraph.getVertices();
-  while ((subVertexPtr = theSubGraphIter2()) != 0) {
-    int vertexTagSub = subVertexPtr->getTag();
-    int loc = theSubdomainMap.getLocation(vertexTagSub);
-    int vertexTagMerged = theSubdomainMap[loc+numVertexSub];
+  MPI_Alltoall(&sendCounts[0], 1, MPI_INT, &recvCounts[0], 1, MPI_INT, MPI_COMM_WORLD);
+  for (int p=1; p<numProcesses; p++)
+    recvDispls[p] = recvDispls[p-1] + recvCounts[p-1];
+  int numRecv = recvDispls[numProcesses-1] + recvCounts[numProcesses-1];
+
+  std::vector<int> recvTags(numRecv+1), recvFrom(numRecv+1);
+  MPI_Alltoallv(&sendTags[0], &sendCounts[0], &sendDispls[0], MPI_INT,
+		&recvTags[0], &recvCounts[0], &recvDispls[0], MPI_INT, MPI_COMM_WORLD);
+  recvTags.resize(numRecv);
+  recvFrom.resize(numRecv);
+  for (int p=0; p<numProcesses; p++)
+    for (int k=0; k<recvCounts[p]; k++)
+      recvFrom[recvDispls[p]+k] = p;
+
+  // answer for the tags this process was given
+  std::vector<int> recvShared;
+  markSharedTags(recvTags, recvFrom, recvShared);
+  recvShared.push_back(0);
+
+  std::vector<int> sendShared(numLocal+1);
+  MPI_Alltoallv(&recvShared[0], &recvCounts[0], &recvDispls[0], MPI_INT,
+		&sendShared[0], &sendCounts[0], &sendDispls[0], MPI_INT, MPI_COMM_WORLD);
+
+  for (int k=0; k<numLocal; k++)
+    isInterface(sendLoc[k]) = sendShared[k];
+
+#else
 
-    const ID &adjacency = subVertexPtr->getAdjacency();
+  ID tags(numLocal);
+  for (int k=0; k<numLocal; k++)
+    tags(k) = localData(2*localLoc[k]);
 
-    for (int i=0; i<adjacency.Size(); i++) {
-      int vertexTagSubAdjacent = adjacency(i);
-      int loc = theSubdomainMap.getLocation(vertexTagSubAdjacent);
-      int vertexTagMergedAdjacent = theSubdomainMap[loc+numVertexSub];      
-      theGraph.addEdge(vertexTagMerged, vertexTagMergedAdjacent);
+  if (processID != 0) {
+
+    Channel *theChannel = theChannels[0];
+    ID sizeData(1);
+    sizeData(0) = numLocal;
+    theChannel->sendID(0, 0, sizeData);
+    if (numLocal != 0) {
+      theChannel->sendID(0, 0, tags);
+      theChannel->recvID(0, 0, tags);
+      for (int k=0; k<numLocal; k++)
+	isInterface(localLoc[k]) = tags(k);
+    }
+
+  } else if (numChannels != 0) {
+
+    // gather the tags of all the partitions
+    std::vector<int> allTags(tags.Size());
+    std::vector<int> allFrom(tags.Size(), 0);
+    for (int k=0; k<numLocal; k++)
+      allTags[k] = tags(k);
+
+    ID numTags(numChannels+1);
+    numTags(0) = numLocal;
+    for (int j=0; j<numChannels; j++) {
+      ID sizeData(1);
+      theChannels[j]->recvID(0, 0, sizeData);
+      numTags(j+1) = sizeData(0);
+      if (sizeData(0) != 0) {
+	ID tagsJ(sizeData(0));
+	theChannels[j]->recvID(0, 0, tagsJ);
+	for (int k=0; k<sizeData(0); k++) {
+	  allTags.push_back(tagsJ(k));
+	  allFrom.push_back(j+1);
+	}
+      }
+    }
+
+    std::vector<int> allShared;
+    markSharedTags(allTags, allFrom, allShared);
+
+    for (int k=0; k<numLocal; k++)
+      isInterface(localLoc[k]) = allShared[k];
+
+    int pos = numLocal;
+    for (int j=0; j<numChannels; j++) {
+      if (numTags(j+1) != 0) {
+	ID sharedJ(numTags(j+1));
+	for (int k=0; k<numTags(j+1); k++)
+	  sharedJ(k) = allShared[pos++];
+	theChannels[j]->sendID(0, 0, sharedJ);
+      }
     }
   }
 
+#endif
 
   return 0;
 }
 
 
+// int setLocalNumbering(const ID &localOrder, int interiorStart, const ID &interfaceDOFs)
+// Numbers the free dofs of the DOF_Groups in localOrder; interface nodes, given as
+// (location in localOrder, start id) pairs in interfaceDOFs, get the given start id,
+// all other DOF_Groups are numbered consecutively from interiorStart.
+
+int
+ParallelNumberer::setLocalNumbering(const ID &localOrder, int interiorStart, const ID &interfaceDOFs)
+{
+  AnalysisModel *theModel = this->getAnalysisModelPtr();
+  int numVertex = localOrder.Size();
+
+  ID startIDs(numVertex);
+  for (int i=0; i<numVertex; i++)
+    startIDs[i] = -1;
+
+  int numInterface = interfaceDOFs.Size()/2;
+  for (int i=0; i<numInterface; i++) {
+    int loc = interfaceDOFs(2*i);
+    if (loc < 0 || loc >= numVertex) {
+      opserr << "WARNING ParallelNumberer::numberDOF - ";
+      opserr << "received an invalid interface location " << loc << endln;
+      return -4;
+    }
+    startIDs[loc] = interfaceDOFs(2*i+1);
+  }
+
+  int result = 0;
+  int eqnNumber = interiorStart;
+  for (int i=0; i<numVertex; i++) {
+    int dofTag = localOrder(i);
+    DOF_Group *dofPtr = theModel->getDOF_GroupPtr(dofTag);
+    if (dofPtr == 0) {
+      opserr << "WARNING ParallelNumberer::numberDOF - ";
+      opserr << "DOF_Group " << dofTag << "not in AnalysisModel!\n";
+      result = -4;
+      continue;
+    }
+
+    int startID = startIDs(i);
+    if (startID < 0) {
+      startID = eqnNumber;
+      eqnNumber += dofPtr->getNumFreeDOF();
+    }
+
+    const ID &theDOFID = dofPtr->getID();
+    int idSize = theDOFID.Size();
+    for (int j=0; j<idSize; j++)
+      if (theDOFID(j) == -2 || theDOFID(j) == -3) dofPtr->setID(j, startID++);
+  }
+
+  return result;
+}
+
+
 int
 ParallelNumberer::sendSelf(int cTag, Channel &theChannel)
 {
@@ -506,94 +690,8 @@ ParallelNumberer::recvSelf(int cTag,
 int
 ParallelNumberer::numberDOF(ID &lastDOFs)
 {
-  int result = 0;
+  opserr << "WARNING ParallelNumberer::numberDOF(ID &lastDOFs):";
+  opserr << " does not use the lastDOFs as requested\n";
 
-  // get a pointer to the model & check its not null
-  AnalysisModel *theModel = this->getAnalysisModelPtr();
-  Domain *theDomain = 0;
-  if (theModel != 0) theDomain = theModel->getDomainPtr();
-  
-  if (theModel == 0 || theDomain == 0) {
-    opserr << "WARNING ParallelNumberer::numberDOF(int) -";
-    opserr << " - no AnalysisModel - has setLinks() been invoked?\n";
-    return -1;
-  }
-  
-  Graph &theGraph = theModel->getDOFGroupGraph();
-  
-  // if subdomain, collect graph, send it off, get 
-  // ID back containing dof tags & start id numbers.
-  if (processID != 0) {
-    Channel *theChannel = theChannels[0];
-    int numVertex = theGraph.getNumVertex();
-    theGraph.sendSelf(0, *theChannel);
-    ID theID(2*numVertex);
-    theChannel->recvID(0, 0, theID);
-    for (int i=0; i<numVertex; i += 2) {
-      int dofTag = theID(i);
-      int startID = theID(i+1);
-      DOF_Group *dofPtr;	
-      dofPtr = theModel->getDOF_GroupPtr(dofTag);
-      if (dofPtr == 0) {
-	opserr << "WARNING ParallelNumberer::numberDOF - ";
-	opserr << "DOF_Group " << dofTag << "not in AnalysisModel!\n";
-	result = -4;
-      } else {
-	const ID &theID = dofPtr->getID();
-	int idSize = theID.Size();
-	for (int j=0; j<idSize; j++)
-	  if (theID(j) == -2) dofPtr->setID(j, startID++);
-      }
-    }
-  } 
-  
-  // if main domain, collect graphs from all subdomains,
-  // merge into 1, number this one, send to subdomains the
-  // id containing dof tags & start id's.
-  else {
-    
-    // determine original vertex and ref tags
-    int numVertex = theGraph.getNumVertex();
-    ID vertexTags(numVertex);
-    ID vertexRefs(numVertex);
-    Vertex *vertexPtr;
-    int loc = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((vertexPtr = theVertices()) != 0) {
-      vertexTags[loc] = vertexPtr->getTag();
-      vertexRefs[loc] = vertexPtr->getRef();
-      loc++;
-    }
-    
-    ID **theSubdomainIDs = new ID *[numChannels];
-    FEM_ObjectBroker theBroker;
-
-    // merge all subdomain graphs
-    for (int j=0; j<numChannels; j++) {
-      Channel *theChannel = theChannels[j];
-      Graph theSubGraph;
-      theSubGraph.recvSelf(0, *theChannel, theBroker);
-      
-      theSubdomainIDs[j] = new ID(theSubGraph.getNumVertex()*2);
-      this->mergeSubGraph(theGraph, theSubGraph, vertexTags, vertexRefs, *theSubdomainIDs[j]);
-    }
-
-    // number the merged graph
-    //    result =  this->DOF_Numberer::number(theGraph);
-
-    // send results of numbered back to subdomains
-    for (int k=0; k<numChannels; k++) {
-      Channel *theChannel = theChannels[k];
-      // this->determineSubIDs
-      theChannel->sendID(0, 0, *theSubdomainIDs[k]);
-      delete theSubdomainIDs[k];
-    }      
-    delete [] theSubdomainIDs;
-    
-    // number own dof's
-  }
-
-  theModel->clearDOFGroupGraph();
-
-  return result;
+  return this->numberDistributed();
 }
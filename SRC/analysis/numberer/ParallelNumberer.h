@@ -28,20 +28,28 @@
 // Description: This file contains the class definition for ParallelNumberer.
 // ParallelNumberer is a subclass of DOF_Numberer. The ParallelNumberer numbers
 // the dof of a partitioned domain, where the partitions are on different processors
-// and each processor has a ParallelNumberer. The ParallelNumberer sitting on P0, 
-// collects each partition graph from P1 through Pn-1, merges them into 1 large graph, 
-// & then numbers this graph. The ParallelNumberers sitting on P1 through Pn-1 then 
-// receive the mapping info for the dof tag and dof numbering from P0.
+// and each processor has a ParallelNumberer. Each ParallelNumberer orders the dof
+// of its own partition (with the GraphNumberer, if one is given) and finds which
+// of its nodes are shared with other partitions. Only the number of interior
+// equations and the interface nodes of each partition are sent to the
+// ParallelNumberer sitting on P0, which returns the start of each partition's
+// interior block of equations and the equation numbers of its interface nodes,
+// which are numbered last. In the MPI builds the shared nodes are found with the
+// node tags spread over all the processes, so P0 holds a few numbers per partition
+// and the interface nodes only; otherwise P0 gathers the node tags to find them.
 //
 // What: "@(#) ParallelNumberer.h, revA"
 
 #ifndef ParallelNumberer_h
 #define ParallelNumberer_h
 
-class Graph;
-
 #include <DOF_Numberer.h>
 
+struct ParallelNumbererNode {
+  int numDOF;          // number of free dof
+  int startDOF;        // first equation number of the interface node
+};
+
 class ParallelNumberer: public DOF_Numberer
 {
   public:
@@ -62,7 +70,9 @@ class ParallelNumberer: public DOF_Numberer
     virtual int setChannels(int numChannels, Channel **theChannels);
 
   protected:
-    int mergeSubGraph(Graph &theGraph, Graph &theSubGraph, ID &vertexTags, ID &vertexRefs, ID &theSubdomainMap);
+    int numberDistributed(void);
+    int findInterfaceNodes(const ID &localData, ID &isInterface);
+    int setLocalNumbering(const ID &localOrder, int interiorStart, const ID &interfaceDOFs);
 
   private:
     GraphNumberer *theNumberer;
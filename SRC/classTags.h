@@ -1188,6 +1188,8 @@
 #define RECORDER_TAGS_VTK_Recorder               22
 #define RECORDER_TAGS_NodeRecorderRMS               23
 #define RECORDER_TAGS_ElementRecorderRMS               24
+#define RECORDER_TAGS_ElementRecorderRainflow          25
+#define RECORDER_TAGS_StatisticsRecorder               26
 
 #define OPS_STREAM_TAGS_FileStream		1
 #define OPS_STREAM_TAGS_StandardStream		2
@@ -59,7 +59,7 @@ public:
 
   virtual Damping *getCopy(void) = 0;
   virtual int setDomain(Domain *domain, int nComp) = 0;
-  virtual int update(Vector q) = 0;
+  virtual int update(const Vector &q) = 0;
   virtual int commitState(void) = 0;
   virtual int revertToLastCommit(void) = 0;
   virtual int revertToStart(void) = 0;
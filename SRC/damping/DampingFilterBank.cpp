@@ -0,0 +1,166 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation for the
+// DampingFilterBank class.
+//
+// What: "@(#) DampingFilterBank.cpp, revA"
+
+#include <string.h>
+#include <Vector.h>
+#include <DampingFilterBank.h>
+
+DampingFilterBank::DampingFilterBank(int nF, const double *g, const double *w)
+:nFilter(nF), refCount(1), gain(0), omegac(0), lastDT(-1.0), coef(0), km(0.0)
+{
+  if (nFilter < 0)
+    nFilter = 0;
+
+  gain = new double[nFilter + 1];
+  omegac = new double[nFilter + 1];
+  coef = new double[3 * nFilter + 1];
+  for (int i = 0; i < nFilter; ++i)
+  {
+    gain[i] = g[i];
+    omegac[i] = w[i];
+  }
+}
+
+DampingFilterBank::~DampingFilterBank()
+{
+  delete [] gain;
+  delete [] omegac;
+  delete [] coef;
+}
+
+DampingFilterBank *
+DampingFilterBank::share(void)
+{
+  ++refCount;
+  return this;
+}
+
+void
+DampingFilterBank::release(DampingFilterBank *theFilters)
+{
+  if (theFilters != 0 && --theFilters->refCount == 0)
+    delete theFilters;
+}
+
+void
+DampingFilterBank::setStepSize(double dT)
+{
+  if (dT == lastDT)
+    return;
+
+  km = 0.0;
+  for (int i = 0; i < nFilter; ++i)
+  {
+    double dTomegac = dT * omegac[i];
+    double *c = &coef[3 * i];
+    c[0] = 4.0 * gain[i] / (2.0 + dTomegac);
+    c[1] = dTomegac / (2.0 + dTomegac);
+    c[2] = (2.0 - dTomegac) / (2.0 + dTomegac);
+    km += c[0];
+  }
+  lastDT = dT;
+}
+
+double
+DampingFilterBank::getStiffnessMultiplier(double dT)
+{
+  this->setStepSize(dT);
+  return km;
+}
+
+void
+DampingFilterBank::filter(int nComp, double dT, const Vector &q, double *state)
+{
+  this->setStepSize(dT);
+
+  int blockSize = this->getBlockSize(nComp);
+  double *qd = state;
+  double *q0 = state + nComp;
+  double *qL = state + 2 * nComp;
+  const double *qdC = qd + blockSize;
+  const double *q0C = q0 + blockSize;
+  const double *qLC = qL + blockSize;
+
+  // the damping force is accumulated on top of -qdC
+  for (int j = 0; j < nComp; ++j)
+  {
+    q0[j] = q(j);
+    qd[j] = -qdC[j];
+  }
+
+  for (int i = 0; i < nFilter; ++i)
+  {
+    const double cd = coef[3 * i];
+    const double c0 = coef[3 * i + 1];
+    const double cL = coef[3 * i + 2];
+    double *qLi = qL + i * nComp;
+    const double *qLCi = qLC + i * nComp;
+    for (int j = 0; j < nComp; ++j)
+    {
+      double s = q0C[j] + q0[j];
+      qd[j] += cd * (s - 2.0 * qLCi[j]);
+      qLi[j] = c0 * s + cL * qLCi[j];
+    }
+  }
+}
+
+void
+DampingFilterBank::follow(int nComp, const Vector &q, double *state, bool resetFilters)
+{
+  double *qd = state;
+  double *q0 = state + nComp;
+  double *qL = state + 2 * nComp;
+
+  for (int j = 0; j < nComp; ++j)
+  {
+    qd[j] = 0.0;
+    q0[j] = q(j);
+  }
+
+  if (resetFilters)
+    for (int i = 0; i < nFilter; ++i)
+      memcpy(qL + i * nComp, q0, nComp * sizeof(double));
+}
+
+void
+DampingFilterBank::commitState(int nComp, double *state)
+{
+  int blockSize = this->getBlockSize(nComp);
+  memcpy(state + blockSize, state, blockSize * sizeof(double));
+}
+
+void
+DampingFilterBank::revertToLastCommit(int nComp, double *state)
+{
+  int blockSize = this->getBlockSize(nComp);
+  memcpy(state, state + blockSize, blockSize * sizeof(double));
+}
+
+void
+DampingFilterBank::revertToStart(int nComp, double *state)
+{
+  int blockSize = this->getBlockSize(nComp);
+  memset(state, 0, 2 * blockSize * sizeof(double));
+}
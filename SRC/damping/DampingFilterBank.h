@@ -0,0 +1,77 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the definition for the DampingFilterBank
+// class. A DampingFilterBank holds the low-pass filters of the UniformDamping,
+// URDDamping and URDDampingbeta models: filter i has the cut-off frequency
+// omegac(i) and the gain g(i). The filter coefficients only depend on dT, so
+// they are computed once per time step size and shared, through a reference
+// count, by all the copies of a damping model (one per element or section).
+//
+// The state of one copy is a flat array of 2*getBlockSize() doubles, the
+// trial block followed by the committed block, each laid out as
+//   [ qd (nComp) | q0 (nComp) | qL (nFilter x nComp, filter by filter) ]
+// so committing or reverting the state is a single block copy.
+//
+// What: "@(#) DampingFilterBank.h, revA"
+
+#ifndef DampingFilterBank_h
+#define DampingFilterBank_h
+
+class Vector;
+
+class DampingFilterBank
+{
+public:
+  DampingFilterBank(int nFilter, const double *gain, const double *omegac);
+
+  DampingFilterBank *share(void);
+  static void release(DampingFilterBank *theFilters);
+
+  int getNumFilters(void) const {return nFilter;};
+  int getBlockSize(int nComp) const {return (2 + nFilter) * nComp;};
+
+  // sum of the filter damping coefficients for the step size dT
+  double getStiffnessMultiplier(double dT);
+
+  // active filters: advance the trial state from the committed one
+  void filter(int nComp, double dT, const Vector &q, double *state);
+  // inactive filters: qd = 0, q0 = q and, if resetFilters, qL = q
+  void follow(int nComp, const Vector &q, double *state, bool resetFilters);
+
+  void commitState(int nComp, double *state);
+  void revertToLastCommit(int nComp, double *state);
+  void revertToStart(int nComp, double *state);
+
+private:
+  ~DampingFilterBank();
+  void setStepSize(double dT);
+
+  int nFilter;
+  int refCount;
+  double *gain, *omegac;
+
+  // per filter {cd, c0, cL} for the step size lastDT, and km = sum(cd)
+  double lastDT;
+  double *coef;
+  double km;
+};
+
+#endif
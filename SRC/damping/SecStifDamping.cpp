@@ -112,7 +112,7 @@ SecStifDamping::setDomain(Domain *domain, int nComp)
 
 
 int
-SecStifDamping::update(Vector q)
+SecStifDamping::update(const Vector &q)
 {       
   double t = theDomain->getCurrentTime();
   double dT = theDomain->getDT();
@@ -126,8 +126,10 @@ SecStifDamping::update(Vector q)
     *q0 = q;
     if (t > ta && t < td)
     {
-      *qd = (beta / dT) * (*q0 - *q0C);
-      if (fac) *qd *= fac->getFactor(t);
+      double factor = beta / dT;
+      if (fac) factor *= fac->getFactor(t);
+      qd->addVector(0.0, *q0, factor);
+      qd->addVector(1.0, *q0C, -factor);
     }
     else
     {
@@ -44,6 +44,7 @@
 #include <URDDamping.h>
 #include <FEM_ObjectBroker.h>
 #include <ID.h>
+#include <DampingFilterBank.h>
 //#include <algorithm>
 #include <iostream>
 #include <fstream>
@@ -57,8 +58,8 @@ URDDamping::URDDamping(int tag, int nfreq, Matrix *etaf, double tol, double t1,
 Damping(tag, DMP_TAG_URDDamping),
 nComp(0), nFilter(0),
 numfreq(nfreq), dptol(tol), ta(t1), td(t2), fac(f), prttag(ptag), maxiter(iter),
-alpha(0), omegac(0), omegaetaf(0), qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0),
-Freqlog(0), Fredif(0), Freqk(0), Freqb(0)
+alpha(0), omegac(0), omegaetaf(0),
+Freqlog(0), Fredif(0), Freqk(0), Freqb(0), theFilters(0), state(0), qd(), theDomain(0)
 {
   etaFreq = new Matrix(*etaf);
   Initialize();
@@ -70,8 +71,8 @@ URDDamping::URDDamping(int tag, int nfreq, Matrix* etaf, double tol, double t1,
 Damping(tag, DMP_TAG_URDDamping),
 nComp(0), nFilter(0),
 numfreq(nfreq), dptol(tol), ta(t1), td(t2), fac(f), prttag(ptag), maxiter(iter),
-alpha(0), omegac(0), omegaetaf(0), qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0),
-Freqlog(0), Fredif(0), Freqk(0), Freqb(0)
+alpha(0), omegac(0), omegaetaf(0),
+Freqlog(0), Fredif(0), Freqk(0), Freqb(0), theFilters(0), state(0), qd(), theDomain(0)
 {
   etaFreq = new Matrix(*etaf);
   if (nF > 0 && a->Size() == nF && w->Size() == nF && ef->Size() == nF)
@@ -94,8 +95,8 @@ URDDamping::URDDamping():
 Damping(0, DMP_TAG_URDDamping),
 nComp(0), nFilter(0),
 numfreq(0), etaFreq(0), dptol(0.0), ta(0.0), td(0.0), fac(0), prttag(0), maxiter(0),
-alpha(0), omegac(0), omegaetaf(0), qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0),
-Freqlog(0), Fredif(0), Freqk(0), Freqb(0)
+alpha(0), omegac(0), omegaetaf(0),
+Freqlog(0), Fredif(0), Freqk(0), Freqb(0), theFilters(0), state(0), qd(), theDomain(0)
 {
 
 }
@@ -108,12 +109,8 @@ URDDamping::~URDDamping()
   if (alpha) delete alpha;
   if (omegac) delete omegac;
   if (omegaetaf) delete omegaetaf;
-  if (qL) delete qL;
-  if (qLC) delete qLC;
-  if (qd) delete qd;
-  if (qdC) delete qdC;
-  if (q0) delete q0;
-  if (q0C) delete q0C;
+  DampingFilterBank::release(theFilters);
+  if (state) delete [] state;
   if (Freqlog) delete Freqlog;
   if (Fredif) delete Fredif;
   if (Freqk) delete Freqk;
@@ -501,9 +498,7 @@ URDDamping::Initialize(void)
 int
 URDDamping::commitState(void)
 {
-  *qdC = *qd;
-  *q0C = *q0;
-  *qLC = *qL;
+  if (theFilters) theFilters->commitState(nComp, state);
   return 0;
 }
 
@@ -511,9 +506,7 @@ URDDamping::commitState(void)
 int
 URDDamping::revertToLastCommit(void)
 {
-  *qd = *qdC;
-  *q0 = *q0C;
-  *qL = *qLC;
+  if (theFilters) theFilters->revertToLastCommit(nComp, state);
   return 0;
 }
 
@@ -521,12 +514,7 @@ URDDamping::revertToLastCommit(void)
 int
 URDDamping::revertToStart(void)
 {
-  (*qd).Zero();
-  (*qdC).Zero();
-  (*q0).Zero();
-  (*q0C).Zero();
-  (*qL).Zero();
-  (*qLC).Zero();
+  if (theFilters) theFilters->revertToStart(nComp, state);
   return 0;
 }
 
@@ -536,61 +524,59 @@ URDDamping::setDomain(Domain *domain, int nC)
 {
   theDomain = domain;
   nComp = nC;
-  
-  qd = new Vector(nComp);
-  qdC = new Vector(nComp);
-  q0 = new Vector(nComp);
-  q0C = new Vector(nComp);
-  qL = new Matrix(nComp, nFilter);
-  qLC = new Matrix(nComp, nFilter);
+
+  DampingFilterBank *theBank = this->getFilters();
+  if (state) delete [] state;
+  state = new double[2 * theBank->getBlockSize(nComp)];
+  theBank->revertToStart(nComp, state);
+  qd.setData(state, nComp);
   
   return 0;
 }
 
 
+DampingFilterBank *
+URDDamping::getFilters(void)
+{
+  // the filters are shared with the copies made by getCopy()
+  if (theFilters == 0)
+  {
+    double *data = new double[2 * nFilter + 1];
+    for (int i = 0; i < nFilter; ++i)
+    {
+      data[i] = (*alpha)(i) * (*omegaetaf)(i);
+      data[nFilter + i] = (*omegac)(i);
+    }
+    theFilters = new DampingFilterBank(nFilter, data, data + nFilter);
+    delete [] data;
+  }
+  return theFilters;
+}
+
+
 int
-URDDamping::update(Vector q)
+URDDamping::update(const Vector &q)
 {
   double t = theDomain->getCurrentTime();
   double dT = theDomain->getDT();
   StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();
   if (*theStaticAnalysis)
   {
-    *q0 = q;
-    (*qd).Zero();
-    for (int i = 0; i < nFilter; ++i)
-      for (int j = 0; j < nComp; ++j)
-        (*qL)(j,i) = q(j);
+    theFilters->follow(nComp, q, state, true);
   }
   else if (dT > 0.0)
   {
-    *q0 = q;
-    (*qd).Zero();
     if (t < td)
     {
       if (t > ta)
-      {
-        for (int i = 0; i < nFilter; ++i)
-        {
-          double dTomegac = dT * (*omegac)(i);
-          double cd = 4.0 * (*alpha)(i) * (*omegaetaf)(i) / (2.0 + dTomegac);
-          double c0 = dTomegac / (2.0 + dTomegac);
-          double cL = (2.0 - dTomegac) / (2.0 + dTomegac);
-          for (int j = 0; j < nComp; ++j)
-          {
-            (*qd)(j) += cd * ((*q0C)(j) + (*q0)(j) - 2.0 * (*qLC)(j,i));
-            (*qL)(j,i) = c0 * ((*q0C)(j) + (*q0)(j)) + cL * (*qLC)(j,i);
-          }
-        }
-        *qd -= *qdC;
-      }
+        theFilters->filter(nComp, dT, q, state);
       else
-      {
-        for (int i = 0; i < nFilter; ++i)
-          for (int j = 0; j < nComp; ++j)
-            (*qL)(j,i) = q(j);
-      }
-      if (fac) *qd *= fac->getFactor(t);
+        theFilters->follow(nComp, q, state, true);
+      if (fac) qd *= fac->getFactor(t);
+    }
+    else
+    {
+      theFilters->follow(nComp, q, state, false);
     }
   }
   return 0;
@@ -599,7 +585,7 @@ URDDamping::update(Vector q)
 const Vector &
 URDDamping::getDampingForce(void)
 {
-  return (*qd);
+  return qd;
 }
 
 double URDDamping::getStiffnessMultiplier(void)
@@ -610,10 +596,7 @@ double URDDamping::getStiffnessMultiplier(void)
   StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();
   if (!*theStaticAnalysis && dT > 0.0 && t > ta && t < td)
   {
-    for (int i = 0; i < nFilter; ++i)
-    {
-        km += 4.0 * (*alpha)(i) * (*omegaetaf)(i) / (2.0 + (*omegac)(i) * dT); 
-    }
+    km = this->getFilters()->getStiffnessMultiplier(dT);
     if (fac) km *= fac->getFactor(t);
   }
   return 1.0 + km;
@@ -626,6 +609,7 @@ Damping *URDDamping::getCopy(void)
   URDDamping *theCopy;
 
   theCopy = new URDDamping(this->getTag(), numfreq, etaFreq, dptol, ta, td, fac, nFilter, alpha, omegac, omegaetaf, prttag, maxiter);
+  theCopy->theFilters = this->getFilters()->share();
 
   return theCopy;
 }
@@ -735,6 +719,8 @@ URDDamping::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   maxiter = data(6);
   (*etaFreq) = (*data2);
 
+  DampingFilterBank::release(theFilters);
+  theFilters = 0;
   Initialize();
   return 0;
 }
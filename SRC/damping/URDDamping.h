@@ -42,6 +42,8 @@
 #include <Vector.h>
 #include <TimeSeries.h>
 
+class DampingFilterBank;
+
 class URDDamping: public Damping
 {
 public:
@@ -56,7 +58,7 @@ public:
   int Initialize(void);
   
   int setDomain(Domain *domain, int nComp);
-  int update(Vector q);
+  int update(const Vector &q);
   
   int commitState(void);
   int revertToLastCommit(void);    
@@ -73,6 +75,7 @@ public:
   void Print(OPS_Stream &s, int flag = 0);
   
 private:
+  DampingFilterBank *getFilters(void);
   
   // internal data
   int numfreq,prttag,maxiter;
@@ -82,8 +85,9 @@ private:
   Vector *alpha, *omegac, *omegaetaf;
   Vector *Freqlog, *Fredif, *Freqk, *Freqb; 
   Matrix *etaFreq;
-  Matrix *qL, *qLC;
-  Vector *qd, *qdC, *q0, *q0C;
+  DampingFilterBank *theFilters;
+  double *state;
+  Vector qd;
   Domain *theDomain;
 };
 
@@ -44,6 +44,7 @@
 #include <URDDampingbeta.h>
 #include <FEM_ObjectBroker.h>
 #include <ID.h>
+#include <DampingFilterBank.h>
 //#include <algorithm>
 //#include <iostream>
 //#include <fstream>
@@ -57,7 +58,7 @@ URDDampingbeta::URDDampingbeta(int tag, int nfreq, Vector *tmpomegac, Vector *tm
 Damping(tag, DMP_TAG_URDDampingbeta),
 nComp(0), nFilter(nfreq),
 ta(t1), td(t2), fac(f),
-qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0)
+theFilters(0), state(0), qd(), theDomain(0)
 {
   beta = new Vector(*tmpbeta);
   omegac = new Vector(*tmpomegac);
@@ -71,7 +72,7 @@ URDDampingbeta::URDDampingbeta():
 Damping(0, DMP_TAG_URDDampingbeta),
 nComp(0), nFilter(0),
 beta(0), omegac(0), ta(0.0), td(0.0), fac(0),
-qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0)
+theFilters(0), state(0), qd(), theDomain(0)
 {
 
 }
@@ -83,12 +84,8 @@ URDDampingbeta::~URDDampingbeta()
   if (fac) delete fac;
   if (beta) delete beta;
   if (omegac) delete omegac;
-  if (qL) delete qL;
-  if (qLC) delete qLC;
-  if (qd) delete qd;
-  if (qdC) delete qdC;
-  if (q0) delete q0;
-  if (q0C) delete q0C;
+  DampingFilterBank::release(theFilters);
+  if (state) delete [] state;
 }
 
 int
@@ -100,9 +97,7 @@ URDDampingbeta::Initialize(void)
 int
 URDDampingbeta::commitState(void)
 {
-  *qdC = *qd;
-  *q0C = *q0;
-  *qLC = *qL;
+  if (theFilters) theFilters->commitState(nComp, state);
   return 0;
 }
 
@@ -110,9 +105,7 @@ URDDampingbeta::commitState(void)
 int
 URDDampingbeta::revertToLastCommit(void)
 {
-  *qd = *qdC;
-  *q0 = *q0C;
-  *qL = *qLC;
+  if (theFilters) theFilters->revertToLastCommit(nComp, state);
   return 0;
 }
 
@@ -120,12 +113,7 @@ URDDampingbeta::revertToLastCommit(void)
 int
 URDDampingbeta::revertToStart(void)
 {
-  (*qd).Zero();
-  (*qdC).Zero();
-  (*q0).Zero();
-  (*q0C).Zero();
-  (*qL).Zero();
-  (*qLC).Zero();
+  if (theFilters) theFilters->revertToStart(nComp, state);
   return 0;
 }
 
@@ -135,61 +123,59 @@ URDDampingbeta::setDomain(Domain *domain, int nC)
 {
   theDomain = domain;
   nComp = nC;
-  
-  qd = new Vector(nComp);
-  qdC = new Vector(nComp);
-  q0 = new Vector(nComp);
-  q0C = new Vector(nComp);
-  qL = new Matrix(nComp, nFilter);
-  qLC = new Matrix(nComp, nFilter);
+
+  DampingFilterBank *theBank = this->getFilters();
+  if (state) delete [] state;
+  state = new double[2 * theBank->getBlockSize(nComp)];
+  theBank->revertToStart(nComp, state);
+  qd.setData(state, nComp);
   
   return 0;
 }
 
 
+DampingFilterBank *
+URDDampingbeta::getFilters(void)
+{
+  // the filters are shared with the copies made by getCopy()
+  if (theFilters == 0)
+  {
+    double *data = new double[2 * nFilter + 1];
+    for (int i = 0; i < nFilter; ++i)
+    {
+      data[i] = (*beta)(i);
+      data[nFilter + i] = (*omegac)(i);
+    }
+    theFilters = new DampingFilterBank(nFilter, data, data + nFilter);
+    delete [] data;
+  }
+  return theFilters;
+}
+
+
 int
-URDDampingbeta::update(Vector q)
+URDDampingbeta::update(const Vector &q)
 {
   double t = theDomain->getCurrentTime();
   double dT = theDomain->getDT();
-  StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();  
+  StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();
   if (*theStaticAnalysis)
   {
-    *q0 = q;
-    (*qd).Zero();
-    for (int i = 0; i < nFilter; ++i)
-      for (int j = 0; j < nComp; ++j)
-        (*qL)(j,i) = q(j);
+    theFilters->follow(nComp, q, state, true);
   }
   else if (dT > 0.0)
   {
-    *q0 = q;
-    (*qd).Zero();
     if (t < td)
     {
       if (t > ta)
-      {
-        for (int i = 0; i < nFilter; ++i)
-        {
-          double dTomegac = dT * (*omegac)(i);
-          double cd = 4.0 * (*beta)(i) / (2.0 + dTomegac);
-          double c0 = dTomegac / (2.0 + dTomegac);
-          double cL = (2.0 - dTomegac) / (2.0 + dTomegac);
-          for (int j = 0; j < nComp; ++j)
-          {
-            (*qd)(j) += cd * ((*q0C)(j) + (*q0)(j) - 2.0 * (*qLC)(j,i));
-            (*qL)(j,i) = c0 * ((*q0C)(j) + (*q0)(j)) + cL * (*qLC)(j,i);
-          }
-        }
-        *qd -= *qdC;
-      }
+        theFilters->filter(nComp, dT, q, state);
       else
-      {
-        for (int i = 0; i < nFilter; ++i)
-          for (int j = 0; j < nComp; ++j)
-            (*qL)(j,i) = q(j);
-      }
-      if (fac) *qd *= fac->getFactor(t);
+        theFilters->follow(nComp, q, state, true);
+      if (fac) qd *= fac->getFactor(t);
+    }
+    else
+    {
+      theFilters->follow(nComp, q, state, false);
     }
   }
   return 0;
@@ -198,7 +184,7 @@ URDDampingbeta::update(Vector q)
 const Vector &
 URDDampingbeta::getDampingForce(void)
 {
-  return (*qd);
+  return qd;
 }
 
 double URDDampingbeta::getStiffnessMultiplier(void)
@@ -209,10 +195,7 @@ double URDDampingbeta::getStiffnessMultiplier(void)
   StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();
   if (!*theStaticAnalysis && dT > 0.0 && t > ta && t < td)
   {
-    for (int i = 0; i < nFilter; ++i)
-    {
-        km += 4.0 * (*beta)(i) / (2.0 + (*omegac)(i) * dT); 
-    }
+    km = this->getFilters()->getStiffnessMultiplier(dT);
     if (fac) km *= fac->getFactor(t);
   }
   return 1.0 + km;
@@ -225,6 +208,7 @@ Damping *URDDampingbeta::getCopy(void)
   URDDampingbeta *theCopy;
 
   theCopy = new URDDampingbeta(this->getTag(), nFilter, omegac, beta, ta, td, fac);
+  theCopy->theFilters = this->getFilters()->share();
 
   return theCopy;
 }
@@ -334,6 +318,8 @@ URDDampingbeta::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBro
   *omegac = dataomegac;
   *beta = databeta;
 
+  DampingFilterBank::release(theFilters);
+  theFilters = 0;
   Initialize();
   return 0;
 }
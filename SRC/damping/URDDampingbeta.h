@@ -42,6 +42,8 @@
 #include <Vector.h>
 #include <TimeSeries.h>
 
+class DampingFilterBank;
+
 class URDDampingbeta: public Damping
 {
 public:
@@ -55,7 +57,7 @@ public:
   int Initialize(void);
   
   int setDomain(Domain *domain, int nComp);
-  int update(Vector q);
+  int update(const Vector &q);
   
   int commitState(void);
   int revertToLastCommit(void);    
@@ -72,14 +74,16 @@ public:
   void Print(OPS_Stream &s, int flag = 0);
   
 private:
+  DampingFilterBank *getFilters(void);
   
   // internal data
   int nComp, nFilter;
   double ta, td;
   TimeSeries *fac;
   Vector *beta, *omegac;
-  Matrix *qL, *qLC;
-  Vector *qd, *qdC, *q0, *q0C;
+  DampingFilterBank *theFilters;
+  double *state;
+  Vector qd;
   Domain *theDomain;
 };
 
@@ -57,6 +57,7 @@
 #include <UniformDamping.h>
 #include <FEM_ObjectBroker.h>
 #include <ID.h>
+#include <DampingFilterBank.h>
 
 //extern StaticAnalysis *theStaticAnalysis;
 
@@ -65,7 +66,7 @@ UniformDamping::UniformDamping(int tag, double cd, double f1, double f2, double
 Damping(tag, DMP_TAG_UniformDamping),
 nComp(0), nFilter(0),
 eta(cd), freq1(f1), freq2(f2), ta(t1), td(t2), fac(f),
-alpha(0), omegac(0), qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0)
+alpha(0), omegac(0), theFilters(0), state(0), qd(), theDomain(0)
 {
   if (eta <= 0.0) opserr << "UniformDamping::UniformDamping:  Invalid damping ratio\n";
   if (freq1 <= 0.0 || freq2 <= 0.0 || freq1 >= freq2)
@@ -79,7 +80,7 @@ UniformDamping::UniformDamping(int tag, double cd, double f1, double f2, double
 Damping(tag, DMP_TAG_UniformDamping),
 nComp(0), nFilter(0),
 eta(cd), freq1(f1), freq2(f2), ta(t1), td(t2), fac(f),
-alpha(0), omegac(0), qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0)
+alpha(0), omegac(0), theFilters(0), state(0), qd(), theDomain(0)
 {
   if (eta <= 0.0) opserr << "UniformDamping::UniformDamping:  Invalid damping ratio\n";
   if (freq1 <= 0.0 || freq2 <= 0.0 || freq1 >= freq2)
@@ -103,7 +104,7 @@ UniformDamping::UniformDamping():
 Damping(0, DMP_TAG_UniformDamping),
 nComp(0), nFilter(0),
 eta(0.0), freq1(0.0), freq2(0.0), ta(0.0), td(0.0), fac(0),
-alpha(0), omegac(0), qL(0), qLC(0), qd(0), qdC(0), q0(0), q0C(0)
+alpha(0), omegac(0), theFilters(0), state(0), qd(), theDomain(0)
 {
 
 }
@@ -115,12 +116,8 @@ UniformDamping::~UniformDamping()
   if (fac) delete fac;
   if (alpha) delete alpha;
   if (omegac) delete omegac;
-  if (qL) delete qL;
-  if (qLC) delete qLC;
-  if (qd) delete qd;
-  if (qdC) delete qdC;
-  if (q0) delete q0;
-  if (q0C) delete q0C;
+  DampingFilterBank::release(theFilters);
+  if (state) delete [] state;
 }
 
 int
@@ -134,6 +131,8 @@ UniformDamping::Initialize(void)
   for (int iter = 0; iter < 100; ++iter)
   {
     double dfreq = (f2log - f1log) / (nFilter - 1);
+    if (alpha) delete alpha;
+    if (omegac) delete omegac;
     alpha = new Vector(nFilter);
     omegac = new Vector(nFilter);
 
@@ -198,9 +197,7 @@ UniformDamping::Initialize(void)
 int
 UniformDamping::commitState(void)
 {
-  *qdC = *qd;
-  *q0C = *q0;
-  *qLC = *qL;
+  if (theFilters) theFilters->commitState(nComp, state);
   return 0;
 }
 
@@ -208,9 +205,7 @@ UniformDamping::commitState(void)
 int
 UniformDamping::revertToLastCommit(void)
 {
-  *qd = *qdC;
-  *q0 = *q0C;
-  *qL = *qLC;
+  if (theFilters) theFilters->revertToLastCommit(nComp, state);
   return 0;
 }
 
@@ -218,12 +213,7 @@ UniformDamping::revertToLastCommit(void)
 int
 UniformDamping::revertToStart(void)
 {
-  (*qd).Zero();
-  (*qdC).Zero();
-  (*q0).Zero();
-  (*q0C).Zero();
-  (*qL).Zero();
-  (*qLC).Zero();
+  if (theFilters) theFilters->revertToStart(nComp, state);
   return 0;
 }
 
@@ -233,61 +223,59 @@ UniformDamping::setDomain(Domain *domain, int nC)
 {
   theDomain = domain;
   nComp = nC;
-  
-  qd = new Vector(nComp);
-  qdC = new Vector(nComp);
-  q0 = new Vector(nComp);
-  q0C = new Vector(nComp);
-  qL = new Matrix(nComp, nFilter);
-  qLC = new Matrix(nComp, nFilter);
+
+  DampingFilterBank *theBank = this->getFilters();
+  if (state) delete [] state;
+  state = new double[2 * theBank->getBlockSize(nComp)];
+  theBank->revertToStart(nComp, state);
+  qd.setData(state, nComp);
   
   return 0;
 }
 
 
+DampingFilterBank *
+UniformDamping::getFilters(void)
+{
+  // the filters are shared with the copies made by getCopy()
+  if (theFilters == 0)
+  {
+    double *data = new double[2 * nFilter + 1];
+    for (int i = 0; i < nFilter; ++i)
+    {
+      data[i] = eta * (*alpha)(i);
+      data[nFilter + i] = (*omegac)(i);
+    }
+    theFilters = new DampingFilterBank(nFilter, data, data + nFilter);
+    delete [] data;
+  }
+  return theFilters;
+}
+
+
 int
-UniformDamping::update(Vector q)
+UniformDamping::update(const Vector &q)
 {
   double t = theDomain->getCurrentTime();
   double dT = theDomain->getDT();
   StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();
   if (*theStaticAnalysis)
   {
-    *q0 = q;
-    (*qd).Zero();
-    for (int i = 0; i < nFilter; ++i)
-      for (int j = 0; j < nComp; ++j)
-        (*qL)(j,i) = q(j);
+    theFilters->follow(nComp, q, state, true);
   }
   else if (dT > 0.0)
   {
-    *q0 = q;
-    (*qd).Zero();
     if (t < td)
     {
       if (t > ta)
-      {
-        for (int i = 0; i < nFilter; ++i)
-        {
-          double dTomegac = dT * (*omegac)(i);
-          double cd = 4.0 * (*alpha)(i) * eta / (2.0 + dTomegac);
-          double c0 = dTomegac / (2.0 + dTomegac);
-          double cL = (2.0 - dTomegac) / (2.0 + dTomegac);
-          for (int j = 0; j < nComp; ++j)
-          {
-            (*qd)(j) += cd * ((*q0C)(j) + (*q0)(j) - 2.0 * (*qLC)(j,i));
-            (*qL)(j,i) = c0 * ((*q0C)(j) + (*q0)(j)) + cL * (*qLC)(j,i);
-          }
-        }
-        *qd -= *qdC;
-      }
+        theFilters->filter(nComp, dT, q, state);
       else
-      {
-        for (int i = 0; i < nFilter; ++i)
-          for (int j = 0; j < nComp; ++j)
-            (*qL)(j,i) = q(j);
-      }
-      if (fac) *qd *= fac->getFactor(t);
+        theFilters->follow(nComp, q, state, true);
+      if (fac) qd *= fac->getFactor(t);
+    }
+    else
+    {
+      theFilters->follow(nComp, q, state, false);
     }
   }
   return 0;
@@ -296,7 +284,7 @@ UniformDamping::update(Vector q)
 const Vector &
 UniformDamping::getDampingForce(void)
 {
-  return (*qd);
+  return qd;
 }
 
 double UniformDamping::getStiffnessMultiplier(void)
@@ -307,10 +295,7 @@ double UniformDamping::getStiffnessMultiplier(void)
   StaticAnalysis **theStaticAnalysis = OPS_GetStaticAnalysis();
   if (!*theStaticAnalysis && dT > 0.0 && t > ta && t < td)
   {
-    for (int i = 0; i < nFilter; ++i)
-    {
-      km += 4.0 * (*alpha)(i) * eta / (2.0 + (*omegac)(i) * dT);
-    }
+    km = this->getFilters()->getStiffnessMultiplier(dT);
     if (fac) km *= fac->getFactor(t);
   }
   return 1.0 + km;
@@ -323,6 +308,7 @@ Damping *UniformDamping::getCopy(void)
   UniformDamping *theCopy;
 
   theCopy = new UniformDamping(this->getTag(), eta, freq1, freq2, ta, td, fac, nFilter, alpha, omegac);
+  theCopy->theFilters = this->getFilters()->share();
 
   return theCopy;
 }
@@ -426,6 +412,8 @@ UniformDamping::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBro
   if (freq1 <= 0.0 || freq2 <= 0.0 || freq1 >= freq2)
     opserr << "UniformDamping::recvSelf:  Invalid frequency range\n";
   
+  DampingFilterBank::release(theFilters);
+  theFilters = 0;
   Initialize();
   return 0;
 }
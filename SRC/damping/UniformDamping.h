@@ -55,6 +55,8 @@
 #include <Vector.h>
 #include <TimeSeries.h>
 
+class DampingFilterBank;
+
 class UniformDamping: public Damping
 {
 public:
@@ -69,7 +71,7 @@ public:
   int Initialize(void);
   
   int setDomain(Domain *domain, int nComp);
-  int update(Vector q);
+  int update(const Vector &q);
   
   int commitState(void);
   int revertToLastCommit(void);    
@@ -86,14 +88,16 @@ public:
   void Print(OPS_Stream &s, int flag = 0);
   
 private:
+  DampingFilterBank *getFilters(void);
   
   // internal data
   int nComp, nFilter;
   double eta, freq1, freq2, ta, td;
   TimeSeries *fac;
   Vector *alpha, *omegac;
-  Matrix *qL, *qLC;
-  Vector *qd, *qdC, *q0, *q0C;
+  DampingFilterBank *theFilters;
+  double *state;
+  Vector qd;
   Domain *theDomain;
 };
 
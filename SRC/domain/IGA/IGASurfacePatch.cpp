@@ -539,6 +539,9 @@ void IGASurfacePatch::setDomain(Domain *theDomain)
 {
     opsDomain = theDomain;
 
+    // the elements are created again below and register their points anew
+    basisCache.clear();
+
     opserr << "IGASurfacePatch::setDomain ->" <<  endln;
 
     opserr << "nodeStartTag = " << nodeStartTag << endln;
@@ -1143,7 +1146,55 @@ int IGASurfacePatch::Nurbs2DBasis2ndDers(double xi, double eta, Vector & R, Vect
     return result;
 }
 
-double IGASurfacePatch::parent2ParametricSpace(Vector range, double xibar)
+int IGASurfacePatch::addBasisCachePoints(const Vector & xiE, const Vector & etaE, const Matrix & quadPoint)
+{
+    int nFuncs = (P + 1) * (Q + 1);
+    int numPoints = quadPoint.noRows();
+    int first = basisCache.size() / (6 * nFuncs);
+
+    Vector R(nFuncs), dRdxi(nFuncs), dRdeta(nFuncs);
+    Vector dR2dxi(nFuncs), dR2deta(nFuncs), dR2dxideta(nFuncs);
+    Vector *ders[6] = {&R, &dRdxi, &dRdeta, &dR2dxi, &dR2deta, &dR2dxideta};
+
+    basisCache.resize(basisCache.size() + numPoints * 6 * nFuncs);
+    for (int gp = 0; gp < numPoints; ++gp)
+    {
+        double xi = parent2ParametricSpace(xiE, quadPoint(gp, 0));
+        double eta = parent2ParametricSpace(etaE, quadPoint(gp, 1));
+
+        // second derivatives are only written for P, Q >= 2 so start from zero
+        for (int d = 0; d < 6; ++d)
+            ders[d]->Zero();
+        Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+
+        double *data = &basisCache[(first + gp) * 6 * nFuncs];
+        for (int d = 0; d < 6; ++d)
+            for (int i = 0; i < nFuncs; ++i)
+                data[d * nFuncs + i] = (*ders[d])(i);
+    }
+
+    return first;
+}
+
+int IGASurfacePatch::cachedNurbs2DBasis2ndDers(int point, Vector & R, Vector & dRdxi, Vector & dRdeta, Vector & dR2dxi, Vector & dR2deta, Vector & dR2dxideta) const
+{
+    int nFuncs = (P + 1) * (Q + 1);
+    if (point < 0 || (size_t)(point + 1) * 6 * nFuncs > basisCache.size())
+    {
+        opserr << "IGASurfacePatch::cachedNurbs2DBasis2ndDers - point " << point << " is not in the cache" << endln;
+        return -1;
+    }
+
+    Vector *ders[6] = {&R, &dRdxi, &dRdeta, &dR2dxi, &dR2deta, &dR2dxideta};
+    const double *data = &basisCache[point * 6 * nFuncs];
+    for (int d = 0; d < 6; ++d)
+        for (int i = 0; i < nFuncs; ++i)
+            (*ders[d])(i) = data[d * nFuncs + i];
+
+    return 0;
+}
+
+double IGASurfacePatch::parent2ParametricSpace(const Vector &range, double xibar)
 {
     double xi = 0.5 * ((range(1) - range(0)) * xibar + range(1) + range(0));
     return xi;
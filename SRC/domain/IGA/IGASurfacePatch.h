@@ -44,6 +44,7 @@
 #include <Information.h>
 #include <Parameter.h>
 
+#include <vector>
 
 
 typedef enum 
@@ -68,7 +69,14 @@ public:
 
     // NURBS member functions
     int Nurbs2DBasis2ndDers(double xi, double eta, Vector& R, Vector& dRdxi, Vector& dRdeta, Vector& dR2dxi, Vector& dR2deta, Vector& dR2dxideta);
-    double parent2ParametricSpace(Vector range, double xibar);
+    // Same as above at the element quadrature points, which are visited on
+    // every state determination. An element evaluates its points once with
+    // addBasisCachePoints() in setDomain() and gets the index of the first
+    // one; quadrature point gp is then served from the cache as point
+    // first+gp. The cache is only read after setDomain().
+    int addBasisCachePoints(const Vector& xiE, const Vector& etaE, const Matrix& quadPoint);
+    int cachedNurbs2DBasis2ndDers(int point, Vector& R, Vector& dRdxi, Vector& dRdeta, Vector& dR2dxi, Vector& dR2deta, Vector& dR2dxideta) const;
+    double parent2ParametricSpace(const Vector &range, double xibar);
     int getNoFuncs();
     ID getOrders();
 
@@ -147,6 +155,10 @@ private:
     // Guardar puntero a vector de posiciones
     Vector* Zk;
 
+    // Basis functions and derivatives at the element quadrature points:
+    // R, dRdxi, dRdeta, dR2dxi, dR2deta and dR2dxideta of each point are
+    // stored back to back, point after point
+    std::vector<double> basisCache;
 
 
 };
@@ -81,6 +81,7 @@
 #include <FEM_ObjectBroker.h>
 
 #include <DomainModalProperties.h>
+#include <PhaseTimer.h>
 
 //
 // global variables
@@ -103,7 +104,8 @@ Domain::Domain()
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ quiescentTol(0.0), numSkipped(0), quiescentSkipAllowed(true), massChangeStamp(0)
 {
   
     // init the arrays for storing the domain components
@@ -158,7 +160,8 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0), paramIndex(0), paramSize(0), numParameters(0),
+ quiescentTol(0.0), numSkipped(0), quiescentSkipAllowed(true), massChangeStamp(0)
 {
     // init the arrays for storing the domain components
     theElements = new MapOfTaggedObjects();
@@ -219,7 +222,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0),
+ quiescentTol(0.0), numSkipped(0), quiescentSkipAllowed(true), massChangeStamp(0)
 {
     // init the arrays for storing the domain components
     thePCs      = new MapOfTaggedObjects();
@@ -278,7 +282,8 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),paramIndex(0), paramSize(0), numParameters(0),
+ quiescentTol(0.0), numSkipped(0), quiescentSkipAllowed(true), massChangeStamp(0)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -1989,6 +1994,7 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
 int
 Domain::record(bool fromAnalysis)
 {
+  PhaseTimer theTimer(PhaseTimer::Recording);
   int res = 0;
 
   // invoke record on all recorders
@@ -2005,6 +2011,10 @@ Domain::record(bool fromAnalysis)
 int
 Domain::commit(void)
 {
+    // bring the skipped quiescent elements up to date before committing
+    if (quiescentTol > 0.0)
+      this->refreshElementState();
+
     // 
     // first invoke commit on all nodes and elements in the domain
     //
@@ -2023,11 +2033,15 @@ Domain::commit(void)
     // set the new committed time in the domain
     committedTime = currentTime;
     dT = 0.0;
+    PhaseTimer::countStep();
 
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    {
+      PhaseTimer theTimer(PhaseTimer::Recording);
+      for (int i=0; i<numRecorders; i++)
+	if (theRecorders[i] != 0)
+	  theRecorders[i]->record(commitTag, currentTime);
+    }
 
     // update the commitTag
     commitTag++;
@@ -2101,17 +2115,41 @@ Domain::revertToStart(void)
 int
 Domain::update(void)
 {
+  PhaseTimer theTimer(PhaseTimer::StateDetermination);
   // set the global constants
   ops_Dt = dT;
   ops_TheActiveDomain = this;
 
   int ok = 0;
 
-  // invoke update on all the ele's
+  // the state of an element whose nodes have all moved less than
+  // quiescentTol since the last full update is not determined again;
+  // velocities and time are not tracked, so never in a transient analysis
+  bool skipQuiescent = (quiescentTol > 0.0 && quiescentSkipAllowed == true &&
+			numParameters == 0);
+
+  // invoke update on all the active ele's; an inactive element keeps the
+  // state it had when deactivated, so it is activated stress free
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
   while ((theEle = theEles()) != 0) {
+    if (theEle->isActive() == false)
+      continue;
+
+    if (skipQuiescent == true) {
+      Node **theNodes = theEle->getNodePtrs();
+      int numNodes = theEle->getNumExternalNodes();
+      bool quiescent = (theNodes != 0 && numNodes > 0);
+      for (int i = 0; i < numNodes && quiescent == true; i++)
+	if (theNodes[i] == 0 || theNodes[i]->getDispChange() > quiescentTol)
+	  quiescent = false;
+      if (quiescent == true) {
+	numSkipped++;
+	continue;
+      }
+    }
+
     ops_TheActiveElement = theEle;
     ok += theEle->update();
   }
@@ -2123,6 +2161,66 @@ Domain::update(void)
 }
 
 
+int
+Domain::setQuiescentTolerance(double tol)
+{
+  quiescentTol = tol;
+
+  // the nodes start tracking from the next full update
+  if (quiescentTol > 0.0)
+    numSkipped = 1;
+  else
+    numSkipped = 0;
+
+  return 0;
+}
+
+double
+Domain::getQuiescentTolerance(void) const
+{
+  return quiescentTol;
+}
+
+void
+Domain::allowQuiescentSkip(bool allowed)
+{
+  quiescentSkipAllowed = allowed;
+}
+
+int
+Domain::refreshElementState(void)
+{
+  int ok = 0;
+
+  // update the elements skipped since the last full update
+  if (numSkipped != 0) {
+    PhaseTimer theTimer(PhaseTimer::StateDetermination);
+    ops_Dt = dT;
+    ops_TheActiveDomain = this;
+
+    ElementIter &theEles = this->getElements();
+    Element *theEle;
+    while ((theEle = theEles()) != 0) {
+      if (theEle->isActive() == false)
+	continue;
+      ops_TheActiveElement = theEle;
+      ok += theEle->update();
+    }
+    numSkipped = 0;
+
+    if (ok != 0)
+      opserr << "Domain::refreshElementState - domain failed in update\n";
+  }
+
+  // all the elements are now consistent with the trial displacements
+  NodeIter &theNodes = this->getNodes();
+  Node *theNode;
+  while ((theNode = theNodes()) != 0)
+    theNode->resetDispChange();
+
+  return ok;
+}
+
 int
 Domain::update(double newTime, double dT)
 {
@@ -2299,6 +2397,18 @@ Domain::setDomainChangeStamp(int newStamp)
     currentGeoTag = newStamp;
 }
 
+int
+Domain::getDomainChangeStamp(void) const
+{
+    return currentGeoTag;
+}
+
+int
+Domain::getMassChangeStamp(void) const
+{
+    return massChangeStamp;
+}
+
 
 void
 Domain::domainChange(void)
@@ -3633,6 +3743,11 @@ Domain::setMass(const Matrix &mass, int nodeTag)
   if (theNode == 0) {
     return -1;
   }
+
+  // only the -M*R the load patterns keep for their ground motions depends
+  // on the mass, the numbering and the system of equations do not
+  massChangeStamp++;
+
   return theNode->setMass(mass);  
 }
 
@@ -3689,7 +3804,9 @@ int Domain::activateElements(const ID& elementList)
     {
         int eleTag = elementList(i);
         theElement = this->getElement(eleTag);
-        if (theElement != 0)
+        // an active element keeps its state, only an inactive one is
+        // activated stress free in the current configuration
+        if (theElement != 0 && theElement->isActive() == false)
         {
             theElement->activate();
         }
@@ -192,6 +192,16 @@ class Domain
     virtual  int  update(double newTime, double dT);
     virtual  int  updateParameter(int tag, int value);
     virtual  int  updateParameter(int tag, double value);    
+
+    // update() skips the elements whose nodes have all moved less than
+    // tol since the last full update; tol <= 0 updates all the elements.
+    // Only displacements are tracked, so skipping is for static analysis
+    // and is turned off while a transient integrator drives the domain.
+    // The state commit() refreshes is not checked again for equilibrium.
+    virtual  int  setQuiescentTolerance(double tol);
+    virtual  double getQuiescentTolerance(void) const;
+    virtual  void allowQuiescentSkip(bool allowed);
+    virtual  int  refreshElementState(void);
     
     virtual  int  analysisStep(double dT);
     virtual  int  eigenAnalysis(int numMode, bool generalized, bool findSmallest);
@@ -212,6 +222,8 @@ class Domain
     virtual bool getDomainChangeFlag(void);    
     virtual void domainChange(void);    
     virtual void setDomainChangeStamp(int newStamp);
+    virtual int getDomainChangeStamp(void) const;
+    virtual int getMassChangeStamp(void) const;
 
 
     // methods for output
@@ -309,6 +321,11 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    double quiescentTol;   // skip quiescent elements in update() if > 0
+    int numSkipped;        // elements skipped since the last full update
+    bool quiescentSkipAllowed; // false in a transient analysis
+    int massChangeStamp;   // bumped by setMass(), the model is otherwise unchanged
 };
 
 #endif
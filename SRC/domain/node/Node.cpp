@@ -33,6 +33,7 @@
    
 #include <Node.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include <Element.h>
 #include <Vector.h>
@@ -228,7 +229,7 @@ Node::Node(int theClassTag)
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0), temperature(0)
+ index(-1), reaction(0), displayLocation(0), temperature(0), dispChange(0.0)
 {
   // for FEM_ObjectBroker, recvSelf() must be invoked on object
 
@@ -251,7 +252,7 @@ Node::Node(int tag, int theClassTag)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0), temperature(0)
+ index(-1), reaction(0), displayLocation(0), temperature(0), dispChange(0.0)
 {
   // for subclasses - they must implement all the methods with
   // their own data structures.
@@ -274,7 +275,7 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0), temperature(0)
+ index(-1), reaction(0), displayLocation(0), temperature(0), dispChange(0.0)
 {
   // AddingSensitivity:BEGIN /////////////////////////////////////////
   dispSensitivity = 0;
@@ -306,7 +307,7 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
- reaction(0), displayLocation(0), temperature(0)
+ reaction(0), displayLocation(0), temperature(0), dispChange(0.0)
 {
   // AddingSensitivity:BEGIN /////////////////////////////////////////
   dispSensitivity = 0;
@@ -340,7 +341,7 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
- reaction(0), displayLocation(0), temperature(0)
+ reaction(0), displayLocation(0), temperature(0), dispChange(0.0)
 {
   // AddingSensitivity:BEGIN /////////////////////////////////////////
   dispSensitivity = 0;
@@ -375,7 +376,7 @@ Node::Node(const Node &otherNode, bool copyMass)
  incrDeltaDisp(0), 
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
-   reaction(0), displayLocation(0), temperature(0)
+   reaction(0), displayLocation(0), temperature(0), dispChange(0.0)
 {
   // AddingSensitivity:BEGIN /////////////////////////////////////////
   dispSensitivity = 0;
@@ -720,6 +721,7 @@ Node::setTrialDisp(double value, int dof)
     disp[dof+2*numberDOF] = tDisp - disp[dof+numberDOF];
     disp[dof+3*numberDOF] = tDisp - disp[dof];	
     disp[dof] = tDisp;
+    dispChange += fabs(disp[dof+3*numberDOF]);
 
     return 0;
 }
@@ -746,12 +748,16 @@ Node::setTrialDisp(const Vector &newTrialDisp)
 
     // perform the assignment .. we don't go through Vector interface
     // as we are sure of size and this way is quicker
+    double maxChange = 0.0;
     for (int i=0; i<numberDOF; i++) {
         double tDisp = newTrialDisp(i);
 	disp[i+2*numberDOF] = tDisp - disp[i+numberDOF];
 	disp[i+3*numberDOF] = tDisp - disp[i];	
 	disp[i] = tDisp;
+	if (fabs(disp[i+3*numberDOF]) > maxChange)
+	  maxChange = fabs(disp[i+3*numberDOF]);
     }
+    dispChange += maxChange;
 
     return 0;
 }
@@ -827,6 +833,7 @@ Node::incrTrialDisp(const Vector &incrDispl)
 	  disp[i+2*numberDOF] = incrDispI;
 	  disp[i+3*numberDOF] = incrDispI;
 	}
+	dispChange += incrDispl.pNorm(-1);
 	return 0;
     }
 
@@ -837,6 +844,7 @@ Node::incrTrialDisp(const Vector &incrDispl)
 	  disp[i+2*numberDOF] += incrDispI;
 	  disp[i+3*numberDOF] = incrDispI;
     }
+    dispChange += incrDispl.pNorm(-1);
 
     return 0;
 }
@@ -1104,6 +1112,8 @@ Node::revertToLastCommit()
 	disp[i+3*numberDOF] = 0.0;
       }
     }
+    // the elements are reverted with the nodes
+    dispChange = 0.0;
     
     // check vel exists, if does set trial = last commit
     if (vel != 0) {
@@ -1130,6 +1140,7 @@ Node::revertToStart()
       for (int i=0 ; i<4*numberDOF; i++)
 	disp[i] = 0.0;
     }
+    dispChange = 0.0;
 
     // check vel exists, if does set all to zero
     if (vel != 0) {
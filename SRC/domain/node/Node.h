@@ -96,6 +96,11 @@ class Node : public DomainComponent
     virtual int incrTrialDisp(const Vector &);    
     virtual int incrTrialVel(const Vector &);    
     virtual int incrTrialAccel(const Vector &);        
+
+    // bound on the change of the trial displacements since the last
+    // resetDispChange(), used by the Domain to skip quiescent elements
+    double getDispChange(void) const {return dispChange;};
+    void resetDispChange(void) {dispChange = 0.0;};
     
     // public methods for adding and obtaining load information
     virtual void zeroUnbalancedLoad(void);
@@ -219,6 +224,7 @@ class Node : public DomainComponent
     Vector *reaction;
     Vector *displayLocation;
     double temperature; // Minjie
+    double dispChange;  // sum of the largest trial disp changes since the last reset
 };
 
 #endif
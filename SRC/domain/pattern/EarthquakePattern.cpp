@@ -39,12 +39,15 @@
 #include <stdlib.h>
 #include <Channel.h>
 #include <ErrorHandler.h>
+#include <Matrix.h>
 
 #include <string.h>
 #include <stdlib.h>
+#include <algorithm>
 
 EarthquakePattern::EarthquakePattern(int tag, int _classTag)
-  :LoadPattern(tag, _classTag), theMotions(0), numMotions(0), uDotG(0), uDotDotG(0), currentTime(0.0), parameterID(0)
+  :LoadPattern(tag, _classTag), theMotions(0), numMotions(0), uDotG(0), uDotDotG(0), currentTime(0.0),
+   inertiaStamp(-1), massStamp(-1), parameterID(0)
 {
 
 }
@@ -91,16 +94,175 @@ EarthquakePattern::applyLoad(double time)
     (*uDotDotG)(i) = theMotions[i]->getAccel(currentTime);
   }
 
+  // parameters can change the masses at any time, so with parameters in
+  // the domain the nodes and elements form their inertia loads every step
+  if (theDomain->getNumParameters() != 0) {
+    inertiaStamp = -1;
+
+    NodeIter &theNodes = theDomain->getNodes();
+    Node *theNode;
+    while ((theNode = theNodes()) != 0) {
+      this->setNodeInfluence(theNode);
+      theNode->addInertiaLoadToUnbalance(*uDotDotG, 1.0);
+    }
+
+    ElementIter &theElements = theDomain->getElements();
+    Element *theElement;
+    while ((theElement = theElements()) != 0) 
+      theElement->addInertiaLoadToUnbalance(*uDotDotG);
+
+    return;
+  }
+
+  // form -M*R again if the domain or a mass has changed, otherwise only
+  // reset R at the nodes of the other elements, another pattern may have
+  // changed it
+  if (theDomain->getDomainChangeFlag() == true ||
+      theDomain->getDomainChangeStamp() != inertiaStamp ||
+      theDomain->getMassChangeStamp() != massStamp) {
+    this->formInertiaLoads(theDomain);
+  } else {
+    int numOtherNodes = otherNodes.size();
+    for (int i=0; i<numOtherNodes; i++)
+      this->setNodeInfluence(otherNodes[i]);
+  }
+
+  // add -M*R*accel to the nodes and to the elements with a constant mass
+  int numInertiaNodes = inertiaNodes.size();
+  int numInertiaElements = inertiaElements.size();
+  for (int i=0; i<numInertiaNodes+numInertiaElements; i++) {
+    int numDOF = (inertiaLoc[i+1] - inertiaLoc[i])/numMotions;
+    Matrix MR(&inertiaData[inertiaLoc[i]], numDOF, numMotions);
+    Vector load(&workData[0], numDOF);
+    load.addMatrixVector(0.0, MR, *uDotDotG, 1.0);
+
+    if (i < numInertiaNodes)
+      inertiaNodes[i]->addUnbalancedLoad(load, 1.0);
+    else
+      inertiaElements[i-numInertiaNodes]->addEffectiveInertiaLoad(load, 1.0);
+  }
+
+  int numOtherElements = otherElements.size();
+  for (int i=0; i<numOtherElements; i++)
+    otherElements[i]->addInertiaLoadToUnbalance(*uDotDotG);
+}
+
+int
+EarthquakePattern::setNodeInfluence(Node *theNode)
+{
+  // R is left as set on the node
+  return 0;
+}
+
+int
+EarthquakePattern::formInertiaLoads(Domain *theDomain)
+{
+  inertiaNodes.clear();
+  inertiaElements.clear();
+  inertiaLoc.clear();
+  inertiaData.clear();
+  otherElements.clear();
+  otherNodes.clear();
+  inertiaStamp = theDomain->getDomainChangeStamp();
+  massStamp = theDomain->getMassChangeStamp();
+
+  Vector unit(numMotions);
+
+  // -M*R of the nodes, the columns of R are obtained as R*unit
   NodeIter &theNodes = theDomain->getNodes();
   Node *theNode;
-  while ((theNode = theNodes()) != 0) 
-    theNode->addInertiaLoadToUnbalance(*uDotDotG, 1.0);
-  
+  while ((theNode = theNodes()) != 0) {
+    this->setNodeInfluence(theNode);
+
+    int numDOF = theNode->getNumberDOF();
+    Matrix RV(numDOF, numMotions);
+    for (int j=0; j<numMotions; j++) {
+      unit.Zero();
+      unit(j) = 1.0;
+      const Vector &Rj = theNode->getRV(unit);
+      for (int i=0; i<numDOF; i++)
+	RV(i,j) = Rj(i);
+    }
 
+    if (this->addEffectiveLoad(theNode->getMass(), RV) == true)
+      inertiaNodes.push_back(theNode);
+  }
+
+  // -M*R of the elements whose mass does not change
   ElementIter &theElements = theDomain->getElements();
   Element *theElement;
-  while ((theElement = theElements()) != 0) 
-    theElement->addInertiaLoadToUnbalance(*uDotDotG);
+  while ((theElement = theElements()) != 0) {
+    const ID &theNodeTags = theElement->getExternalNodes();
+    int numNodes = theNodeTags.Size();
+
+    int numDOF = theElement->getNumDOF();
+    Matrix RV(numDOF, numMotions);
+    bool constantMass = theElement->hasConstantMass();
+    int loc = 0;
+    for (int k=0; k<numNodes && constantMass == true; k++) {
+      theNode = theDomain->getNode(theNodeTags(k));
+      if (theNode == 0 || loc + theNode->getNumberDOF() > numDOF) {
+	constantMass = false;
+	break;
+      }
+      int numNodeDOF = theNode->getNumberDOF();
+      for (int j=0; j<numMotions; j++) {
+	unit.Zero();
+	unit(j) = 1.0;
+	const Vector &Rj = theNode->getRV(unit);
+	for (int i=0; i<numNodeDOF; i++)
+	  RV(loc+i,j) = Rj(i);
+      }
+      loc += numNodeDOF;
+    }
+
+    if (constantMass == false || loc != numDOF) {
+      otherElements.push_back(theElement);
+      for (int k=0; k<numNodes; k++) {
+	theNode = theDomain->getNode(theNodeTags(k));
+	if (theNode != 0)
+	  otherNodes.push_back(theNode);
+      }
+      continue;
+    }
+
+    if (this->addEffectiveLoad(theElement->getMass(), RV) == true)
+      inertiaElements.push_back(theElement);
+  }
+  inertiaLoc.push_back(inertiaData.size());
+
+  std::sort(otherNodes.begin(), otherNodes.end());
+  otherNodes.erase(std::unique(otherNodes.begin(), otherNodes.end()), otherNodes.end());
+
+  return 0;
+}
+
+bool
+EarthquakePattern::addEffectiveLoad(const Matrix &mass, const Matrix &RV)
+{
+  int numDOF = RV.noRows();
+  Matrix MR(numDOF, numMotions);
+  MR.addMatrixProduct(0.0, mass, RV, -1.0);
+
+  // nodes and elements without mass need no load
+  bool hasLoad = false;
+  for (int j=0; j<numMotions; j++)
+    for (int i=0; i<numDOF; i++)
+      if (MR(i,j) != 0.0)
+	hasLoad = true;
+
+  if (hasLoad == false)
+    return false;
+
+  inertiaLoc.push_back(inertiaData.size());
+  for (int j=0; j<numMotions; j++)
+    for (int i=0; i<numDOF; i++)
+      inertiaData.push_back(MR(i,j));
+
+  if ((int)workData.size() < numDOF)
+    workData.resize(numDOF);
+
+  return true;
 }
     
 void 
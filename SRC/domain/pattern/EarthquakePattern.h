@@ -35,9 +35,13 @@
 // EarthquakePattern is an abstract class.
 
 #include <LoadPattern.h>
+#include <vector>
 
 class GroundMotion;
 class Vector;
+class Matrix;
+class Node;
+class Element;
 
 class EarthquakePattern : public LoadPattern
 {
@@ -68,13 +72,34 @@ class EarthquakePattern : public LoadPattern
     
  protected:
     int addMotion(GroundMotion &theMotion);
+    // sets the influence matrix R of a node, one column per ground motion
+    virtual int setNodeInfluence(Node *theNode);
     GroundMotion **theMotions;
     int numMotions;
 
   private:
+    int formInertiaLoads(Domain *theDomain);
+    bool addEffectiveLoad(const Matrix &mass, const Matrix &RV);
+
     Vector *uDotG, *uDotDotG;
     double currentTime;
 
+    // -M*R of the nodes with mass and of the elements with a constant mass,
+    // formed when the domain or a nodal mass changes; each is numDOF x
+    // numMotions, column major, starting at inertiaLoc in inertiaData
+    // (nodes first)
+    int inertiaStamp;
+    int massStamp;
+    std::vector<Node *> inertiaNodes;
+    std::vector<Element *> inertiaElements;
+    std::vector<int> inertiaLoc;
+    std::vector<double> inertiaData;
+    std::vector<double> workData;
+
+    // elements forming their own inertia loads and the nodes they use
+    std::vector<Element *> otherElements;
+    std::vector<Node *> otherNodes;
+
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
 // AddingSensitivity:END ///////////////////////////////////////////
@@ -51,6 +51,9 @@
 
 #include <OPS_Globals.h>
 #include <elementAPI.h>
+#include <Domain.h>
+#include <Element.h>
+#include <map>
 
 void* OPS_LoadPattern()
 {
@@ -112,7 +115,8 @@ LoadPattern::LoadPattern(int tag, int clasTag, double fact)
  theSeries(0), 
  currentGeoTag(0), lastGeoSendTag(-1),
  theNodalLoads(0), theElementalLoads(0), theSPs(0),
- theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0)
+ theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0),
+ eleLoadGeoTag(-1), eleLoadStamp(-1)
 {
     // constructor for subclass
     theNodalLoads = new MapOfTaggedObjects();
@@ -146,7 +150,8 @@ LoadPattern::LoadPattern()
  currentGeoTag(0), lastGeoSendTag(-1),
  dbSPs(0), dbNod(0), dbEle(0), 
  theNodalLoads(0), theElementalLoads(0), theSPs(0),
- theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0)
+ theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0),
+ eleLoadGeoTag(-1), eleLoadStamp(-1)
 {
     theNodalLoads = new MapOfTaggedObjects();
     theElementalLoads = new MapOfTaggedObjects();
@@ -179,7 +184,8 @@ LoadPattern::LoadPattern(int tag, double fact)
  currentGeoTag(0), lastGeoSendTag(-1),
  dbSPs(0), dbNod(0), dbEle(0), 
  theNodalLoads(0), theElementalLoads(0), theSPs(0),
- theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0)
+ theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0),
+ eleLoadGeoTag(-1), eleLoadStamp(-1)
 {
     theNodalLoads = new MapOfTaggedObjects();
     theElementalLoads = new MapOfTaggedObjects();
@@ -274,6 +280,7 @@ LoadPattern::setDomain(Domain *theDomain)
 
     // now we set this load patterns domain
     this->DomainComponent::setDomain(theDomain);
+    eleLoadStamp = -1;
 }
 
 
@@ -416,10 +423,30 @@ LoadPattern::applyLoad(double pseudoTime)
   while ((nodLoad = theNodalIter()) != 0)
     nodLoad->applyLoad(loadFactor);
     
-  ElementalLoad *eleLoad;
-  ElementalLoadIter &theElementalIter = this->getElementalLoads();
-  while ((eleLoad = theElementalIter()) != 0)
-    eleLoad->applyLoad(loadFactor);
+  // parameters can change the elemental loads at any time, so with
+  // parameters in the domain every load is applied through the element
+  Domain *theDomain = this->getDomain();
+  if (theDomain == 0 || theDomain->getNumParameters() != 0) {
+    ElementalLoad *eleLoad;
+    ElementalLoadIter &theElementalIter = this->getElementalLoads();
+    while ((eleLoad = theElementalIter()) != 0)
+      eleLoad->applyLoad(loadFactor);
+  } else {
+    if (eleLoadGeoTag != currentGeoTag ||
+	theDomain->getDomainChangeFlag() == true ||
+	theDomain->getDomainChangeStamp() != eleLoadStamp)
+      this->formEquivalentLoads(theDomain);
+
+    int numLoaded = loadedElements.size();
+    for (int i = 0; i < numLoaded; i++) {
+      Vector P(&eleLoadData[eleLoadLoc[i]], eleLoadLoc[i+1]-eleLoadLoc[i]);
+      loadedElements[i]->addEquivalentLoad(P, loadFactor);
+    }
+
+    int numOther = otherEleLoads.size();
+    for (int i = 0; i < numOther; i++)
+      otherEleLoads[i]->applyLoad(loadFactor);
+  }
 
   SP_Constraint *sp;
   SP_ConstraintIter &theIter = this->getSPs();
@@ -427,6 +454,51 @@ LoadPattern::applyLoad(double pseudoTime)
     sp->applyConstraint(loadFactor);
 }
 
+void
+LoadPattern::formEquivalentLoads(Domain *theDomain)
+{
+  loadedElements.clear();
+  eleLoadLoc.clear();
+  eleLoadData.clear();
+  otherEleLoads.clear();
+  eleLoadGeoTag = currentGeoTag;
+  eleLoadStamp = theDomain->getDomainChangeStamp();
+
+  // the loads of an element are summed into one vector
+  std::map<Element *, int> loadIndex;
+
+  ElementalLoad *eleLoad;
+  ElementalLoadIter &theElementalIter = this->getElementalLoads();
+  while ((eleLoad = theElementalIter()) != 0) {
+    Element *theEle = theDomain->getElement(eleLoad->getElementTag());
+    if (theEle == 0) {
+      otherEleLoads.push_back(eleLoad);
+      continue;
+    }
+
+    int numDOF = theEle->getNumDOF();
+    Vector P(numDOF);
+    if (theEle->getEquivalentLoad(eleLoad, P) < 0) {
+      otherEleLoads.push_back(eleLoad);
+      continue;
+    }
+
+    std::map<Element *, int>::iterator it = loadIndex.find(theEle);
+    if (it == loadIndex.end()) {
+      loadIndex[theEle] = loadedElements.size();
+      loadedElements.push_back(theEle);
+      eleLoadLoc.push_back(eleLoadData.size());
+      for (int i = 0; i < numDOF; i++)
+	eleLoadData.push_back(P(i));
+    } else {
+      int loc = eleLoadLoc[it->second];
+      for (int i = 0; i < numDOF; i++)
+	eleLoadData[loc+i] += P(i);
+    }
+  }
+  eleLoadLoc.push_back(eleLoadData.size());
+}
+
 void
 LoadPattern::setLoadConstant(void) 
 {
@@ -679,6 +751,7 @@ LoadPattern::sendSelf(int cTag, Channel &theChannel)
 int
 LoadPattern::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+  eleLoadStamp = -1;
 
   // get my current database tag
   // NOTE - dbTag equals 0 if not sending to a database OR has not yet been sent
@@ -40,6 +40,7 @@
 
 #include <DomainComponent.h>
 #include <Vector.h>
+#include <vector>
 
 class NodalLoad;
 class TimeSeries;
@@ -51,6 +52,7 @@ class SingleDomSP_Iter;
 class SP_ConstraintIter;
 class TaggedObjectStorage;
 class GroundMotion;
+class Element;
 
 class LoadPattern : public DomainComponent    
 {
@@ -114,6 +116,8 @@ class LoadPattern : public DomainComponent
     int    isConstant;     // to indictae whether setConstant has been called
 	
   private:
+    void formEquivalentLoads(Domain *theDomain);
+
     double loadFactor;     // current load factor
     double scaleFactor;    // factor to scale load factor from time series
 
@@ -140,6 +144,15 @@ class LoadPattern : public DomainComponent
     // AddingSensitivity:END ////////////////////////////////////////
 
     int lastChannel; 
+
+    // elemental loads the elements can form as equivalent loads, summed per
+    // element at eleLoadLoc in eleLoadData when the loads or the domain
+    // change; the other elemental loads are applied through addLoad()
+    int eleLoadGeoTag, eleLoadStamp;
+    std::vector<Element *> loadedElements;
+    std::vector<int> eleLoadLoc;
+    std::vector<double> eleLoadData;
+    std::vector<ElementalLoad *> otherEleLoads;
 };
 
 #endif
@@ -46,7 +46,6 @@ class UniformExcitation : public EarthquakePattern
     ~UniformExcitation();
 
     void setDomain(Domain *theDomain);    
-    void applyLoad(double time);
   double getLoadFactor(void);
     void Print(OPS_Stream &s, int flag =0);
     int getDirection(void) {return theDof;}
@@ -65,6 +64,7 @@ class UniformExcitation : public EarthquakePattern
     const GroundMotion *getGroundMotion(void);
     
  protected:
+    int setNodeInfluence(Node *theNode);
     
  private:
     GroundMotion *theMotion; // the ground motion
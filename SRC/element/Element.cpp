@@ -111,6 +111,18 @@ Element::addInertiaLoadToUnbalance(const Vector &accel)
   return -1;
 }
 
+bool
+Element::hasConstantMass(void)
+{
+  return false;
+}
+
+int
+Element::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  return -1;
+}
+
 
 int
 Element::setRayleighDampingFactors(double alpham, double betak, double betak0, double betakc)
@@ -366,6 +378,18 @@ Element::addLoad(ElementalLoad *theLoad, const Vector &loadFactors) {
   return 0;
 }
 
+int
+Element::getEquivalentLoad(ElementalLoad *theLoad, Vector &P)
+{
+  return -1;
+}
+
+int
+Element::addEquivalentLoad(const Vector &P, double fact)
+{
+  return -1;
+}
+
 /*
 int 
 Element::addInertiaLoadToUnbalance(const Vector &accel)
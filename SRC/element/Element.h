@@ -80,8 +80,17 @@ class Element : public DomainComponent
     virtual void zeroLoad(void);	
     virtual int addLoad(ElementalLoad *theLoad, double loadFactor);
     virtual int addLoad(ElementalLoad *theLoad, const Vector &loadFactors);
+    // elements whose load vector for an elemental load only scales with the
+    // load factor return it in P, the load pattern forms it once and then
+    // adds fact*P through addEquivalentLoad() instead of calling addLoad()
+    virtual int getEquivalentLoad(ElementalLoad *theLoad, Vector &P);
+    virtual int addEquivalentLoad(const Vector &P, double fact);
 
     virtual int addInertiaLoadToUnbalance(const Vector &accel);
+    // elements whose mass matrix does not change during the analysis let the
+    // load pattern form -M*R once and add fact*effLoad as the inertia load
+    virtual bool hasConstantMass(void);
+    virtual int addEffectiveInertiaLoad(const Vector &effLoad, double fact);
     virtual int setRayleighDampingFactors(double alphaM, double betaK, double betaK0, double betaKc);
     virtual int setDamping(Domain *theDomain, Damping *theDamping);
 
@@ -95,7 +95,9 @@ Vector*  IGAKLShell::resid = 0;
 //null constructor
 IGAKLShell::IGAKLShell( ) :
   Element( 0, ELE_TAG_IGAKLShell ),
-  connectedExternalNodes(4)
+  myPatch(0),
+  connectedExternalNodes(4),
+  basisPoint(-1)
 {
 
 }
@@ -115,7 +117,8 @@ IGAKLShell::IGAKLShell( int tag,
   myPatch(myPatch_),
   xiE(xiE_),
   etaE(etaE_),
-  connectedExternalNodes(nodes)
+  connectedExternalNodes(nodes),
+  basisPoint(-1)
 {
   if (numIGAKLShell == 0) {
     // opserr << "Using IGAKLShell - Developed by: Felipe Elgueta and Jose A. Abell (www.joseabell.com)\n";
@@ -252,6 +255,10 @@ void  IGAKLShell::setDomain( Domain *theDomain )
     }
   }
 
+  // evaluate the basis at the quadrature points once, the patch keeps them
+  if (basisPoint < 0 && myPatch != 0)
+    basisPoint = myPatch->addBasisCachePoints(xiE, etaE, *quadPoint);
+
   this->DomainComponent::setDomain(theDomain);
 }
 
@@ -850,7 +857,7 @@ IGAKLShell::getResponse(int responseID, Information &eleInfo)
       double xi = myPatch->parent2ParametricSpace(xiE, ptU);
       double eta = myPatch->parent2ParametricSpace(etaE, ptV);
 
-      myPatch->Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+      myPatch->cachedNurbs2DBasis2ndDers(basisPoint + gp, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
 
       // Get the 1st and the 2nd derivatives of the shape functions and call them dR, ddR
       Matrix ddR(3, noFuncs);
@@ -1048,7 +1055,7 @@ IGAKLShell::getResponse(int responseID, Information &eleInfo)
       double xi = myPatch->parent2ParametricSpace(xiE, ptU);
       double eta = myPatch->parent2ParametricSpace(etaE, ptV);
 
-      myPatch->Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+      myPatch->cachedNurbs2DBasis2ndDers(basisPoint + gp, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
 
       // Get the 1st and the 2nd derivatives of the shape functions and call them dR, ddR
       Matrix ddR(3, noFuncs);
@@ -1914,7 +1921,7 @@ const Matrix&  IGAKLShell::getMass( )
     J2 = 0.5 * (xiE(1) - xiE(0)) * 0.5 * (etaE(1) - etaE(0));
 
     R.Zero(); dRdxi.Zero(); dRdeta.Zero(); dR2dxi.Zero(); dR2deta.Zero(); dR2dxideta.Zero();
-    myPatch->Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+    myPatch->cachedNurbs2DBasis2ndDers(basisPoint + gp, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
 
     // Get first order jacobian
     Matrix dr(2, noFuncs);
@@ -3023,7 +3030,7 @@ void IGAKLShell::formStrainsLinear()
     dR2dxi.Zero();
     dR2deta.Zero();
     dR2dxideta.Zero();
-    myPatch->Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+    myPatch->cachedNurbs2DBasis2ndDers(basisPoint + gp, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
 
     // !~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~!
     // !    DESCRIPTION OF THE VARIABLES !
@@ -3400,7 +3407,7 @@ void IGAKLShell::formResidAndTangent( int tang_flag )
     dR2dxi.Zero();
     dR2deta.Zero();
     dR2dxideta.Zero();
-    myPatch->Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+    myPatch->cachedNurbs2DBasis2ndDers(basisPoint + gp, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
 
     // !~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~!
     // !    DESCRIPTION OF THE VARIABLES !
@@ -4121,7 +4128,7 @@ void IGAKLShell::formTangentNguyen()
     dR2dxi.Zero();
     dR2deta.Zero();
     dR2dxideta.Zero();
-    ders = myPatch->Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+    ders = myPatch->cachedNurbs2DBasis2ndDers(basisPoint + gp, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
     // opserr << "Got derivatives! " <<  endln;
 
     // Get first and second order jacobians
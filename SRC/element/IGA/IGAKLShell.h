@@ -143,6 +143,7 @@ private :
     Vector *quadWeight;
 
     ID connectedExternalNodes ;  // node numbers
+    int basisPoint;              // first quadrature point in the patch basis cache
 
     NDMaterial ***materialPointers ; //pointers to  materials
     Node **nodePointers ;      //pointers to  nodes
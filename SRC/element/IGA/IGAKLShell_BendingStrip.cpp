@@ -92,7 +92,9 @@ Vector*  IGAKLShell_BendingStrip::resid = 0;
 //null constructor
 IGAKLShell_BendingStrip::IGAKLShell_BendingStrip( ) :
   Element( 0, ELE_TAG_IGAKLShell_BendingStrip ),
-  connectedExternalNodes(4)
+  myPatch(0),
+  connectedExternalNodes(4),
+  basisPoint(-1)
 {
 
 }
@@ -112,7 +114,8 @@ IGAKLShell_BendingStrip::IGAKLShell_BendingStrip( int tag,
   myPatch(myPatch_),
   xiE(xiE_),
   etaE(etaE_),
-  connectedExternalNodes(nodes)
+  connectedExternalNodes(nodes),
+  basisPoint(-1)
 {
   if (numIGAKLShell_BendingStrip == 0) {
     // opserr << "Using IGAKLShell_BendingStrip - Developed by: Felipe Elgueta and Jose A. Abell (www.joseabell.com)\n";
@@ -243,6 +246,10 @@ void  IGAKLShell_BendingStrip::setDomain( Domain *theDomain )
     }
   }
 
+  // evaluate the basis at the quadrature points once, the patch keeps them
+  if (basisPoint < 0 && myPatch != 0)
+    basisPoint = myPatch->addBasisCachePoints(xiE, etaE, *quadPoint);
+
   this->DomainComponent::setDomain(theDomain);
 }
 
@@ -2256,7 +2263,7 @@ void IGAKLShell_BendingStrip::formResidAndTangent( int tang_flag )
     dR2dxi.Zero();
     dR2deta.Zero();
     dR2dxideta.Zero();
-    myPatch->Nurbs2DBasis2ndDers(xi, eta, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
+    myPatch->cachedNurbs2DBasis2ndDers(basisPoint + gp, R, dRdxi, dRdeta, dR2dxi, dR2deta, dR2dxideta);
 
 
 
@@ -869,18 +869,18 @@ PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups,
         return res;
     }
 
-    // add PFEM elements
+    // keep unchanged elements, only add the new ones
+    ID tags;
+    int etag = updateElements(starteletag,eles,tags,theDomain);
     int numeles = eles.Size()/3;
-    if(numeles == 0) return 0;
-    int etag = starteletag-1;
     for(int i=0; i<numeles; i++) {
         Element* theEle = 0;
         if(type == 1) {
-            theEle = new PFEMElement2D(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk);
+            theEle = new PFEMElement2D(tags(i), eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk);
         } else if(type == 3) {
-            theEle = new PFEMElement2DCompressible(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
+            theEle = new PFEMElement2DCompressible(tags(i), eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
         } else if(type == 4) {
-            theEle = new PFEMElement2DBubble(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
+            theEle = new PFEMElement2DBubble(tags(i), eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
         }
         
         if(theEle == 0) {
@@ -936,13 +936,13 @@ PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups,
         return -1;
     }
 
-    // add Tri31 elements
+    // add Tri31 elements, keeping unchanged elements
     //timer.start();
+    ID tags;
+    int etag = updateElements(starteletag,eles,tags,theDomain);
     int numeles = eles.Size()/3;
-    if(numeles == 0) return 0;
-    int etag = starteletag-1;
     for(int i=0; i<numeles; i++) {
-        Tri31* theEle = new Tri31(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),
+        Tri31* theEle = new Tri31(tags(i), eles(3*i), eles(3*i+1), eles(3*i+2),
                                   *theMaterial, type, t, p, rho, b1, b2);
 
         if(theEle == 0) {
@@ -1171,6 +1171,97 @@ PFEMMesher2D::doTriangulation(double alpha, const ID& groups, const ID& addgroup
     return 0;
 }
 
+int
+PFEMMesher2D::updateElements(int starteletag, ID& eles, ID& tags, Domain* theDomain)
+{
+    // a new start tag: forget the meshes none of whose elements are
+    // left in the domain
+    if(lastMeshes.find(starteletag) == lastMeshes.end()) {
+        std::map<int, std::map<std::vector<int>,int> >::iterator it = lastMeshes.begin();
+        while(it != lastMeshes.end()) {
+            bool used = false;
+            for(std::map<std::vector<int>,int>::iterator jt=it->second.begin(); jt!=it->second.end(); jt++) {
+                if(theDomain->getElement(jt->second) != 0) {
+                    used = true;
+                    break;
+                }
+            }
+            if(used) {
+                it++;
+            } else {
+                lastMeshes.erase(it++);
+            }
+        }
+    }
+
+    std::map<std::vector<int>,int>& lastMesh = lastMeshes[starteletag];
+    std::map<std::vector<int>,int> mesh;
+
+    // triangles of the new mesh that are already elements
+    int numeles = eles.Size()/3;
+    ID neweles(0, eles.Size());
+    int numnew = 0;
+    for(int i=0; i<numeles; i++) {
+        std::vector<int> key(3);
+        for(int j=0; j<3; j++) {
+            key[j] = eles(3*i+j);
+        }
+        std::sort(key.begin(), key.end());
+
+        std::map<std::vector<int>,int>::iterator it = lastMesh.find(key);
+        if(it != lastMesh.end() && theDomain->getElement(it->second) != 0) {
+            mesh[key] = it->second;
+            lastMesh.erase(it);
+        } else {
+            for(int j=0; j<3; j++) {
+                neweles[3*numnew+j] = eles(3*i+j);
+            }
+            numnew++;
+        }
+    }
+
+    // elements that are no longer in the mesh, their tags are reused
+    std::vector<int> freetags;
+    for(std::map<std::vector<int>,int>::iterator it=lastMesh.begin(); it!=lastMesh.end(); it++) {
+        Element* ele = theDomain->removeElement(it->second);
+        if(ele != 0) {
+            delete ele;
+            freetags.push_back(it->second);
+        }
+    }
+
+    // tags of the new elements
+    tags.resize(numnew);
+    int next = starteletag;
+    int endele = starteletag-1;
+    for(int i=0; i<numnew; i++) {
+        if(i < (int)freetags.size()) {
+            tags(i) = freetags[i];
+        } else {
+            // skip tags in use, including the reused ones not yet added
+            while(theDomain->getElement(next) != 0 ||
+                  std::find(freetags.begin(),freetags.end(),next) != freetags.end()) {
+                next++;
+            }
+            tags(i) = next++;
+        }
+        std::vector<int> key(3);
+        for(int j=0; j<3; j++) {
+            key[j] = neweles(3*i+j);
+        }
+        std::sort(key.begin(), key.end());
+        mesh[key] = tags(i);
+    }
+    for(std::map<std::vector<int>,int>::iterator it=mesh.begin(); it!=mesh.end(); it++) {
+        if(it->second > endele) endele = it->second;
+    }
+
+    lastMesh.swap(mesh);
+    eles = neweles;
+
+    return endele;
+}
+
 int 
 PFEMMesher2D::save(const char* filename, Domain* theDomain, int maxelenodes)
 {
@@ -2007,4 +2098,61 @@ PFEMMesher2D::removeElements(int regTag, Domain* theDomain)
         }
         eleReg->setElements(ID());
     }
+
+    // the mesh of the region is gone
+    std::map<int,int>::iterator it = regionMeshes.find(regTag);
+    if(it != regionMeshes.end()) {
+        lastMeshes.erase(it->second);
+        regionMeshes.erase(it);
+    }
+}
+
+int
+PFEMMesher2D::startRegionMesh(int regTag, Domain* theDomain)
+{
+    std::map<int,int>::iterator it = regionMeshes.find(regTag);
+    if(it == regionMeshes.end() ||
+       lastMeshes.find(it->second) == lastMeshes.end()) {
+        this->removeElements(regTag, theDomain);
+        int starteletag = this->findEleTag(theDomain);
+        regionMeshes[regTag] = starteletag;
+        return starteletag;
+    }
+
+    // remove the elements of the region that are not mesh elements,
+    // the mesh elements are updated by the triangulation
+    MeshRegion* eleReg = theDomain->getRegion(regTag);
+    if(eleReg != 0) {
+        std::set<int> meshEles;
+        std::map<std::vector<int>,int>& lastMesh = lastMeshes[it->second];
+        for(std::map<std::vector<int>,int>::iterator jt=lastMesh.begin(); jt!=lastMesh.end(); jt++) {
+            meshEles.insert(jt->second);
+        }
+        const ID& regEles = eleReg->getElements();
+        for(int i=0; i<regEles.Size(); i++) {
+            if(meshEles.find(regEles(i)) != meshEles.end()) continue;
+            Element* ele = theDomain->removeElement(regEles(i));
+            if(ele != 0) delete ele;
+        }
+    }
+
+    return it->second;
+}
+
+void
+PFEMMesher2D::getMeshElements(int starteletag, ID& eles)
+{
+    std::set<int> tags;
+    std::map<int, std::map<std::vector<int>,int> >::iterator it = lastMeshes.find(starteletag);
+    if(it != lastMeshes.end()) {
+        for(std::map<std::vector<int>,int>::iterator jt=it->second.begin(); jt!=it->second.end(); jt++) {
+            tags.insert(jt->second);
+        }
+    }
+
+    eles.resize(tags.size());
+    int i = 0;
+    for(std::set<int>::iterator jt=tags.begin(); jt!=tags.end(); jt++) {
+        eles(i++) = *jt;
+    }
 }
@@ -152,6 +152,14 @@ public:
                      Domain* theDomain);
     void removeElements(int regTag, Domain* theDomain);
 
+    // prepare remeshing a region: remove the elements of the region
+    // that are not in its last mesh and return the start tag of that
+    // mesh, or a new start tag if the region has no mesh yet
+    int startRegionMesh(int regTag, Domain* theDomain);
+
+    // tags of the elements in the mesh generated from starteletag
+    void getMeshElements(int starteletag, ID& eles);
+
     // identify interface
     void identify(double g, Domain* theDomain);
 
@@ -167,6 +175,18 @@ private:
     // free triangulateio
     void freeTri(triangulateio& tri);
     void freeTriOut(triangulateio& tri);
+
+    // incremental remeshing: keep the elements of the previous mesh
+    // generated from starteletag that are still in eles, remove the
+    // others; on return eles holds only the new triangles and tags
+    // the tags to use for them. Returns the largest tag in the mesh
+    int updateElements(int starteletag, ID& eles, ID& tags, Domain* theDomain);
+
+    // previous meshes: starteletag -> (sorted nodes -> element tag)
+    std::map<int, std::map<std::vector<int>,int> > lastMeshes;
+
+    // region tag -> starteletag of the mesh of the region
+    std::map<int,int> regionMeshes;
     
     // PI
     static double PI;
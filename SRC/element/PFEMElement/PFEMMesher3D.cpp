@@ -55,6 +55,7 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 
 PFEMMesher3D::PFEMMesher3D()
     :bound(6), avesize(0.0)
@@ -584,14 +585,14 @@ PFEMMesher3D::doTriangulation(int startele, const std::vector<int>& nodes, doubl
         return res;
     }
 
-    // add PFEM elements
+    // add PFEM elements, keeping unchanged elements
     //timer.start();
+    std::vector<int> tags;
+    int etag = updateElements(startele, eles, tags, theDomain);
     int numeles = eles.size()/4;
-    if(numeles == 0) return 0;
-    int etag = startele-1;
     for(int i=0; i<numeles; i++) {
         //opserr<<eles(4*i)<<" "<<eles(4*i+1)<<" "<<eles(4*i+2)<<" "<<eles(4*i+3)<<"\n";
-        PFEMElement3D* theEle = new PFEMElement3D(++etag, eles[4*i], eles[4*i+1], eles[4*i+2],
+        PFEMElement3D* theEle = new PFEMElement3D(tags[i], eles[4*i], eles[4*i+1], eles[4*i+2],
                                                   eles[4*i+3], rho, mu, b1, b2, b3);
 
         if(theEle == 0) {
@@ -611,6 +612,89 @@ PFEMMesher3D::doTriangulation(int startele, const std::vector<int>& nodes, doubl
     return etag;
 }
 
+int
+PFEMMesher3D::updateElements(int startele, ivector& eles, ivector& tags, Domain* theDomain)
+{
+    // a new start tag: forget the meshes none of whose elements are
+    // left in the domain
+    if(lastMeshes.find(startele) == lastMeshes.end()) {
+        std::map<int, std::map<ivector,int> >::iterator it = lastMeshes.begin();
+        while(it != lastMeshes.end()) {
+            bool used = false;
+            for(std::map<ivector,int>::iterator jt=it->second.begin(); jt!=it->second.end(); jt++) {
+                if(theDomain->getElement(jt->second) != 0) {
+                    used = true;
+                    break;
+                }
+            }
+            if(used) {
+                it++;
+            } else {
+                lastMeshes.erase(it++);
+            }
+        }
+    }
+
+    std::map<ivector,int>& lastMesh = lastMeshes[startele];
+    std::map<ivector,int> mesh;
+
+    // tetrahedra of the new mesh that are already elements
+    int numeles = eles.size()/4;
+    ivector neweles;
+    neweles.reserve(eles.size());
+    for(int i=0; i<numeles; i++) {
+        ivector key(eles.begin()+4*i, eles.begin()+4*i+4);
+        std::sort(key.begin(), key.end());
+
+        std::map<ivector,int>::iterator it = lastMesh.find(key);
+        if(it != lastMesh.end() && theDomain->getElement(it->second) != 0) {
+            mesh[key] = it->second;
+            lastMesh.erase(it);
+        } else {
+            neweles.insert(neweles.end(), eles.begin()+4*i, eles.begin()+4*i+4);
+        }
+    }
+
+    // elements that are no longer in the mesh, their tags are reused
+    ivector freetags;
+    for(std::map<ivector,int>::iterator it=lastMesh.begin(); it!=lastMesh.end(); it++) {
+        Element* ele = theDomain->removeElement(it->second);
+        if(ele != 0) {
+            delete ele;
+            freetags.push_back(it->second);
+        }
+    }
+
+    // tags of the new elements
+    int numnew = neweles.size()/4;
+    tags.resize(numnew);
+    int next = startele;
+    int endele = startele-1;
+    for(int i=0; i<numnew; i++) {
+        if(i < (int)freetags.size()) {
+            tags[i] = freetags[i];
+        } else {
+            // skip tags in use, including the reused ones not yet added
+            while(theDomain->getElement(next) != 0 ||
+                  std::find(freetags.begin(),freetags.end(),next) != freetags.end()) {
+                next++;
+            }
+            tags[i] = next++;
+        }
+        ivector key(neweles.begin()+4*i, neweles.begin()+4*i+4);
+        std::sort(key.begin(), key.end());
+        mesh[key] = tags[i];
+    }
+    for(std::map<ivector,int>::iterator it=mesh.begin(); it!=mesh.end(); it++) {
+        if(it->second > endele) endele = it->second;
+    }
+
+    lastMesh.swap(mesh);
+    eles.swap(neweles);
+
+    return endele;
+}
+
 int 
 PFEMMesher3D::save(const char* filename, const ID& snodes, int step, Domain* theDomain)
 {
@@ -128,8 +128,17 @@ public:
 
 private:
 
+    // incremental remeshing: keep the elements of the previous mesh
+    // generated from startele that are still in eles, remove the others;
+    // on return eles holds only the new tetrahedra and tags the tags to
+    // use for them. Returns the largest tag in the mesh
+    int updateElements(int startele, ivector& eles, ivector& tags, Domain* theDomain);
+
     Vector bound;
     double avesize;
+
+    // previous meshes: startele -> (sorted nodes -> element tag)
+    std::map<int, std::map<ivector,int> > lastMeshes;
 };
 
 
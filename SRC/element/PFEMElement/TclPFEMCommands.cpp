@@ -2186,11 +2186,9 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     kappa = params(5);
                 }
 
-                // remove all elements in eleReg
-                theMesher2D.removeElements(eleRegTag,theDomain);
-
-                // triangulation
-                int startele = theMesher2D.findEleTag(theDomain);
+                // triangulation, the elements of eleReg still in the
+                // mesh are kept and the others removed
+                int startele = theMesher2D.startRegionMesh(eleRegTag,theDomain);
                 int endele = startele;
             
                 res = theMesher2D.doTriangulation(startele,alpha,nodes,
@@ -2204,12 +2202,11 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     return TCL_ERROR; 
                 }
 
-                // add to element region
-                ID regioneles(2);
-                regioneles(0) = startele;
-                regioneles(1) = endele;
-                bool series = false;
-                int action = 1; // append
+                // the element region is the new mesh
+                ID regioneles;
+                theMesher2D.getMeshElements(startele,regioneles);
+                bool series = true;
+                int action = 0; // replace
                 theMesher2D.setElements(regioneles,eleRegTag,series,action,
                                         theDomain);
 
@@ -2237,11 +2234,9 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     b2 = params(6);
                 }
 
-                // remove all elements in eleReg
-                theMesher2D.removeElements(eleRegTag,theDomain);
-            
-                // triangulation
-                int startele = theMesher2D.findEleTag(theDomain);
+                // triangulation, the elements of eleReg still in the
+                // mesh are kept and the others removed
+                int startele = theMesher2D.startRegionMesh(eleRegTag,theDomain);
                 int endele = startele;
                 res = theMesher2D.doTriangulation(startele,alpha,nodes,addnodes,
                                                   theDomain,
@@ -2254,12 +2249,11 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     return TCL_ERROR; 
                 }
 
-                // add to element region
-                ID regioneles(2);
-                regioneles(0) = startele;
-                regioneles(1) = endele;
-                bool series = false;
-                int action = 1; // append
+                // the element region is the new mesh
+                ID regioneles;
+                theMesher2D.getMeshElements(startele,regioneles);
+                bool series = true;
+                int action = 0; // replace
                 theMesher2D.setElements(regioneles,eleRegTag,series,action,
                                         theDomain);
 
@@ -0,0 +1,185 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of ShapeFunctionCache.
+
+#include <ShapeFunctionCache.h>
+#include <OPS_Stream.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <new>
+
+bool   ShapeFunctionCache::enabled = false;
+double ShapeFunctionCache::budget = 0.0;
+double ShapeFunctionCache::bytesInUse = 0.0;
+double ShapeFunctionCache::peakBytes = 0.0;
+long   ShapeFunctionCache::numBlocks = 0;
+long   ShapeFunctionCache::numRefused = 0;
+long   ShapeFunctionCache::numHits = 0;
+
+// shapeFunctionCache on <-budget $MB>
+// shapeFunctionCache off
+// shapeFunctionCache stats
+//   returns: numElements bytesInUse peakBytes numRefused numHits
+// shapeFunctionCache print
+// shapeFunctionCache reset
+int
+OPS_shapeFunctionCache(void)
+{
+  if (OPS_GetNumRemainingInputArgs() < 1) {
+    opserr << "WARNING shapeFunctionCache on <-budget MB>|off|stats|print|reset\n";
+    return -1;
+  }
+
+  const char *option = OPS_GetString();
+
+  if (strcmp(option, "on") == 0) {
+    ShapeFunctionCache::setEnabled(true);
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+      option = OPS_GetString();
+      if (strcmp(option, "-budget") == 0) {
+	double mb;
+	int numData = 1;
+	if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDoubleInput(&numData, &mb) < 0) {
+	  opserr << "WARNING shapeFunctionCache - invalid budget\n";
+	  return -1;
+	}
+	ShapeFunctionCache::setBudget(mb*1024.0*1024.0);
+      } else {
+	opserr << "WARNING shapeFunctionCache on - unknown option " << option << endln;
+	return -1;
+      }
+    }
+  } else if (strcmp(option, "off") == 0) {
+    ShapeFunctionCache::setEnabled(false);
+  } else if (strcmp(option, "stats") == 0) {
+    double stats[5];
+    int numData = ShapeFunctionCache::getStatistics(stats);
+    if (OPS_SetDoubleOutput(&numData, stats, false) < 0) {
+      opserr << "WARNING shapeFunctionCache - failed to set output\n";
+      return -1;
+    }
+  } else if (strcmp(option, "print") == 0) {
+    ShapeFunctionCache::Print(opserr);
+  } else if (strcmp(option, "reset") == 0) {
+    ShapeFunctionCache::resetStatistics();
+  } else {
+    opserr << "WARNING shapeFunctionCache - unknown option " << option << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+double *
+ShapeFunctionCache::allocate(int numDoubles)
+{
+  if (enabled == false || numDoubles <= 0)
+    return 0;
+
+  double numBytes = double(numDoubles)*sizeof(double);
+  if (budget > 0.0 && bytesInUse + numBytes > budget) {
+    numRefused++;
+    return 0;
+  }
+
+  double *data = new (std::nothrow) double[numDoubles];
+  if (data == 0) {
+    numRefused++;
+    return 0;
+  }
+
+  bytesInUse += numBytes;
+  if (bytesInUse > peakBytes)
+    peakBytes = bytesInUse;
+  numBlocks++;
+
+  return data;
+}
+
+void
+ShapeFunctionCache::release(double *data, int numDoubles)
+{
+  if (data == 0)
+    return;
+
+  delete [] data;
+  bytesInUse -= double(numDoubles)*sizeof(double);
+  numBlocks--;
+}
+
+void
+ShapeFunctionCache::setEnabled(bool onOff)
+{
+  enabled = onOff;
+}
+
+bool
+ShapeFunctionCache::isEnabled(void)
+{
+  return enabled;
+}
+
+void
+ShapeFunctionCache::setBudget(double bytes)
+{
+  budget = bytes;
+}
+
+double
+ShapeFunctionCache::getBudget(void)
+{
+  return budget;
+}
+
+void
+ShapeFunctionCache::resetStatistics(void)
+{
+  peakBytes = bytesInUse;
+  numRefused = 0;
+  numHits = 0;
+}
+
+int
+ShapeFunctionCache::getStatistics(double *stats)
+{
+  stats[0] = numBlocks;
+  stats[1] = bytesInUse;
+  stats[2] = peakBytes;
+  stats[3] = numRefused;
+  stats[4] = numHits;
+
+  return 5;
+}
+
+void
+ShapeFunctionCache::Print(OPS_Stream &s)
+{
+  s << "ShapeFunctionCache: " << (enabled ? "on" : "off") << endln;
+  s << "  budget (bytes): ";
+  if (budget > 0.0)
+    s << budget << endln;
+  else
+    s << "unlimited" << endln;
+  s << "  elements cached: " << numBlocks << endln;
+  s << "  bytes in use: " << bytesInUse << " (peak " << peakBytes << ")" << endln;
+  s << "  requests refused: " << numRefused << endln;
+  s << "  cached evaluations: " << numHits << endln;
+}
@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ShapeFunctionCache_h
+#define ShapeFunctionCache_h
+
+// Description: This file contains the class definition for
+// ShapeFunctionCache. Geometrically linear isoparametric elements
+// (Brick, Twenty_Node_Brick, FourNodeQuad) can keep their shape functions,
+// global derivatives and Jacobian weights at the quadrature points instead
+// of re-evaluating them from the nodal coordinates in every state
+// determination. The element asks for storage in setDomain() and falls
+// back to recomputation when the cache is off or the memory budget is
+// exhausted. The cache is off by default and is switched on with the
+// shapeFunctionCache command.
+
+class OPS_Stream;
+
+class ShapeFunctionCache
+{
+  public:
+    // storage for numDoubles doubles, 0 if disabled or over budget
+    static double *allocate(int numDoubles);
+    static void release(double *data, int numDoubles);
+
+    static void setEnabled(bool onOff);
+    static bool isEnabled(void);
+
+    // memory budget in bytes, <= 0.0 means unlimited
+    static void setBudget(double bytes);
+    static double getBudget(void);
+
+    // called by an element each time it uses its cached data
+    static void recordHit(void) {numHits++;};
+
+    static void resetStatistics(void);
+    static int getStatistics(double *stats); // returns number filled (5)
+    static void Print(OPS_Stream &s);
+
+  private:
+    static bool enabled;
+    static double budget;
+    static double bytesInUse;
+    static double peakBytes;
+    static long numBlocks;
+    static long numRefused;
+    static long numHits;
+};
+
+#endif
@@ -0,0 +1,176 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef SolidKernels_h
+#define SolidKernels_h
+
+// Description: fixed-size kernels for small-strain continuum elements.
+//
+// The kernels work directly on the shape function gradients, stored
+// node-contiguous as dN[dim][node] (the layout already used by shp3d),
+// and never form the (sparse) strain-displacement matrix B. All loop
+// bounds are compile time constants so the node loops are unrolled and
+// vectorized by the compiler, with no heap allocation or Matrix/Vector
+// temporaries in the element state determination.
+//
+// Strains are engineering strains in the usual OpenSees ordering:
+//   2d: eps11, eps22, 2*eps12
+//   3d: eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31
+//
+// Element vectors are ordered node by node (u1x u1y [u1z] u2x ...) and
+// element matrices are column-major, i.e. the storage used by Matrix, so
+// a Matrix built on the same array with Matrix(double *, int, int) sees
+// the result directly.
+
+#include <Matrix.h>
+
+template <int NEN, int NDM> struct SolidKernels;
+
+template <int NEN>
+struct SolidKernels<NEN, 3>
+{
+  enum { NDOF = 3*NEN, NSTRESS = 6 };
+
+  // eps = B u
+  static void
+  formStrain(const double dN[3][NEN], const double *u, double *eps)
+  {
+    double e[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    for (int a = 0; a < NEN; a++) {
+      const double dx = dN[0][a];
+      const double dy = dN[1][a];
+      const double dz = dN[2][a];
+      const double ux = u[3*a];
+      const double uy = u[3*a+1];
+      const double uz = u[3*a+2];
+      e[0] += dx*ux;
+      e[1] += dy*uy;
+      e[2] += dz*uz;
+      e[3] += dy*ux + dx*uy;
+      e[4] += dz*uy + dy*uz;
+      e[5] += dz*ux + dx*uz;
+    }
+    for (int k = 0; k < 6; k++)
+      eps[k] = e[k];
+  }
+
+  // f += w * B^T s
+  static void
+  addBTs(const double dN[3][NEN], const double *s, double w, double *f)
+  {
+    for (int a = 0; a < NEN; a++) {
+      const double dx = dN[0][a];
+      const double dy = dN[1][a];
+      const double dz = dN[2][a];
+      f[3*a]   += w*(dx*s[0] + dy*s[3] + dz*s[5]);
+      f[3*a+1] += w*(dy*s[1] + dx*s[3] + dz*s[4]);
+      f[3*a+2] += w*(dz*s[2] + dy*s[4] + dx*s[5]);
+    }
+  }
+
+  // K += w * B^T D B, K column-major NDOF x NDOF
+  //
+  // column (b,j) of K is B^T (D B_bj), so each column is a single addBTs
+  // on a contiguous block of K
+  static void
+  addBTDB(const double dN[3][NEN], const Matrix &D, double w, double *K)
+  {
+    double d[6][6];
+    for (int k = 0; k < 6; k++)
+      for (int l = 0; l < 6; l++)
+	d[k][l] = D(k,l);
+
+    double c[6];
+    for (int b = 0; b < NEN; b++) {
+      const double dx = dN[0][b];
+      const double dy = dN[1][b];
+      const double dz = dN[2][b];
+      for (int k = 0; k < 6; k++)
+	c[k] = d[k][0]*dx + d[k][3]*dy + d[k][5]*dz;
+      addBTs(dN, c, w, &K[(3*b)*NDOF]);
+      for (int k = 0; k < 6; k++)
+	c[k] = d[k][1]*dy + d[k][3]*dx + d[k][4]*dz;
+      addBTs(dN, c, w, &K[(3*b+1)*NDOF]);
+      for (int k = 0; k < 6; k++)
+	c[k] = d[k][2]*dz + d[k][4]*dy + d[k][5]*dx;
+      addBTs(dN, c, w, &K[(3*b+2)*NDOF]);
+    }
+  }
+};
+
+template <int NEN>
+struct SolidKernels<NEN, 2>
+{
+  enum { NDOF = 2*NEN, NSTRESS = 3 };
+
+  // eps = B u
+  static void
+  formStrain(const double dN[2][NEN], const double *u, double *eps)
+  {
+    double e[3] = {0.0, 0.0, 0.0};
+    for (int a = 0; a < NEN; a++) {
+      const double dx = dN[0][a];
+      const double dy = dN[1][a];
+      const double ux = u[2*a];
+      const double uy = u[2*a+1];
+      e[0] += dx*ux;
+      e[1] += dy*uy;
+      e[2] += dy*ux + dx*uy;
+    }
+    for (int k = 0; k < 3; k++)
+      eps[k] = e[k];
+  }
+
+  // f += w * B^T s
+  static void
+  addBTs(const double dN[2][NEN], const double *s, double w, double *f)
+  {
+    for (int a = 0; a < NEN; a++) {
+      const double dx = dN[0][a];
+      const double dy = dN[1][a];
+      f[2*a]   += w*(dx*s[0] + dy*s[2]);
+      f[2*a+1] += w*(dy*s[1] + dx*s[2]);
+    }
+  }
+
+  // K += w * B^T D B, K column-major NDOF x NDOF
+  static void
+  addBTDB(const double dN[2][NEN], const Matrix &D, double w, double *K)
+  {
+    double d[3][3];
+    for (int k = 0; k < 3; k++)
+      for (int l = 0; l < 3; l++)
+	d[k][l] = D(k,l);
+
+    double c[3];
+    for (int b = 0; b < NEN; b++) {
+      const double dx = dN[0][b];
+      const double dy = dN[1][b];
+      for (int k = 0; k < 3; k++)
+	c[k] = d[k][0]*dx + d[k][2]*dy;
+      addBTs(dN, c, w, &K[(2*b)*NDOF]);
+      for (int k = 0; k < 3; k++)
+	c[k] = d[k][1]*dy + d[k][2]*dx;
+      addBTs(dN, c, w, &K[(2*b+1)*NDOF]);
+    }
+  }
+};
+
+#endif
@@ -23,6 +23,7 @@
 // Description: This file contains the implementation of the SSPbrick class
 
 #include "SSPbrick.h"
+#include <SolidKernels.h>
 
 #include <elementAPI.h>
 #include <Information.h>
@@ -112,14 +113,14 @@ SSPbrick::SSPbrick(int tag, int Nd1, int Nd2, int Nd3, int Nd4, int Nd5, int Nd6
   :Element(tag,ELE_TAG_SSPbrick),
   	theMaterial(0),
 	mExternalNodes(SSPB_NUM_NODE),
-	mTangentStiffness(SSPB_NUM_DOF,SSPB_NUM_DOF),
-	mInternalForces(SSPB_NUM_DOF),
+	mTangentStiffness(mTangentData,SSPB_NUM_DOF,SSPB_NUM_DOF),
+	mInternalForces(mForceData,SSPB_NUM_DOF),
 	Q(SSPB_NUM_DOF),
 	mMass(SSPB_NUM_DOF,SSPB_NUM_DOF),
 	mNodeCrd(SSPB_NUM_DIM,SSPB_NUM_NODE),
 	mVol(0),
 	Bnot(6,SSPB_NUM_DOF),
-	Kstab(SSPB_NUM_DOF,SSPB_NUM_DOF),
+	Kstab(mKstabData,SSPB_NUM_DOF,SSPB_NUM_DOF),
 	xi(8),
 	et(8),
 	ze(8),
@@ -147,6 +148,13 @@ SSPbrick::SSPbrick(int tag, int Nd1, int Nd2, int Nd3, int Nd4, int Nd5, int Nd6
 	appliedB[1] = 0.0;
 	appliedB[2] = 0.0;
 
+	mTangentStiffness.Zero();
+	mInternalForces.Zero();
+	Kstab.Zero();
+	for (int i = 0; i < SSPB_NUM_DIM; i++)
+		for (int j = 0; j < SSPB_NUM_NODE; j++)
+			mDN[i][j] = 0.0;
+
 	// get copy of the material object
 	NDMaterial *theMatCopy = theMat.getCopy("ThreeDimensional");
 	if (theMatCopy != 0) {
@@ -169,14 +177,14 @@ SSPbrick::SSPbrick()
   :Element(0,ELE_TAG_SSPbrick),
   	theMaterial(0),
 	mExternalNodes(SSPB_NUM_NODE),
-	mTangentStiffness(SSPB_NUM_DOF,SSPB_NUM_DOF),
-	mInternalForces(SSPB_NUM_DOF),
+	mTangentStiffness(mTangentData,SSPB_NUM_DOF,SSPB_NUM_DOF),
+	mInternalForces(mForceData,SSPB_NUM_DOF),
 	Q(SSPB_NUM_DOF),
 	mMass(SSPB_NUM_DOF,SSPB_NUM_DOF),
 	mNodeCrd(SSPB_NUM_DIM,SSPB_NUM_NODE),
 	mVol(0),
 	Bnot(6,SSPB_NUM_DOF),
-	Kstab(SSPB_NUM_DOF,SSPB_NUM_DOF),
+	Kstab(mKstabData,SSPB_NUM_DOF,SSPB_NUM_DOF),
 	xi(8),
 	et(8),
 	ze(8),
@@ -195,6 +203,13 @@ SSPbrick::SSPbrick()
 	appliedB[1] = 0.0;
 	appliedB[2] = 0.0;
 
+	mTangentStiffness.Zero();
+	mInternalForces.Zero();
+	Kstab.Zero();
+	for (int i = 0; i < SSPB_NUM_DIM; i++)
+		for (int j = 0; j < SSPB_NUM_NODE; j++)
+			mDN[i][j] = 0.0;
+
 	mInitialize = false;
 }
 
@@ -403,45 +418,18 @@ SSPbrick::update(void)
 // this function updates variables for an incremental step n to n+1
 {
 	// get trial displacement
-	const Vector &mDisp_1 = theNodes[0]->getTrialDisp();
-	const Vector &mDisp_2 = theNodes[1]->getTrialDisp();
-	const Vector &mDisp_3 = theNodes[2]->getTrialDisp();
-	const Vector &mDisp_4 = theNodes[3]->getTrialDisp();
-	const Vector &mDisp_5 = theNodes[4]->getTrialDisp();
-	const Vector &mDisp_6 = theNodes[5]->getTrialDisp();
-	const Vector &mDisp_7 = theNodes[6]->getTrialDisp();
-	const Vector &mDisp_8 = theNodes[7]->getTrialDisp();
-	
-	// assemble displacement vector
-	Vector u(24);
-	u(0) =  mDisp_1(0);
-	u(1) =  mDisp_1(1);
-	u(2) =  mDisp_1(2);
-	u(3) =  mDisp_2(0);
-	u(4) =  mDisp_2(1);
-	u(5) =  mDisp_2(2);
-	u(6) =  mDisp_3(0);
-	u(7) =  mDisp_3(1);
-	u(8) =  mDisp_3(2);
-	u(9) =  mDisp_4(0);
-	u(10) = mDisp_4(1);
-	u(11) = mDisp_4(2);
-	u(12) = mDisp_5(0);
-	u(13) = mDisp_5(1);
-	u(14) = mDisp_5(2);
-	u(15) = mDisp_6(0);
-	u(16) = mDisp_6(1);
-	u(17) = mDisp_6(2);
-	u(18) = mDisp_7(0);
-	u(19) = mDisp_7(1);
-	u(20) = mDisp_7(2);
-	u(21) = mDisp_8(0);
-	u(22) = mDisp_8(1);
-	u(23) = mDisp_8(2);
+	double u[SSPB_NUM_DOF];
+	for (int i = 0; i < SSPB_NUM_NODE; i++) {
+		const Vector &mDisp = theNodes[i]->getTrialDisp();
+		u[3*i]   = mDisp(0);
+		u[3*i+1] = mDisp(1);
+		u[3*i+2] = mDisp(2);
+	}
 
 	// compute strain and send it to the material
-	Vector strain(6);
-	strain = Bnot*u;
+	double eps[6];
+	Vector strain(eps, 6);
+	SolidKernels<SSPB_NUM_NODE,SSPB_NUM_DIM>::formStrain(mDN, u, eps);
 	theMaterial->setTrialStrain(strain);
 
 	return 0;
@@ -454,9 +442,10 @@ SSPbrick::getTangentStiff(void)
 	// get material tangent
 	const Matrix &Cmat = theMaterial->getTangent();
 
-	// full element stiffness matrix
-	mTangentStiffness = Kstab;
-	mTangentStiffness.addMatrixTripleProduct(1.0, Bnot, Cmat, mVol);
+	// full element stiffness matrix  ->  K = Kstab + 8*Jo*Bnot'*C*Bnot
+	for (int i = 0; i < SSPB_NUM_DOF*SSPB_NUM_DOF; i++)
+		mTangentData[i] = mKstabData[i];
+	SolidKernels<SSPB_NUM_NODE,SSPB_NUM_DIM>::addBTDB(mDN, Cmat, mVol, mTangentData);
 	
 	return mTangentStiffness;
 }
@@ -598,50 +587,31 @@ SSPbrick::getResistingForce(void)
 // this function computes the resisting force vector for the element
 {
 	// get stress from the material
-	Vector mStress = theMaterial->getStress();
+	const Vector &mStress = theMaterial->getStress();
 
 	// get trial displacement
-	const Vector &mDisp_1 = theNodes[0]->getTrialDisp();
-	const Vector &mDisp_2 = theNodes[1]->getTrialDisp();
-	const Vector &mDisp_3 = theNodes[2]->getTrialDisp();
-	const Vector &mDisp_4 = theNodes[3]->getTrialDisp();
-	const Vector &mDisp_5 = theNodes[4]->getTrialDisp();
-	const Vector &mDisp_6 = theNodes[5]->getTrialDisp();
-	const Vector &mDisp_7 = theNodes[6]->getTrialDisp();
-	const Vector &mDisp_8 = theNodes[7]->getTrialDisp();
-	
-	// assemble displacement vector
-	Vector d(24);
-	d(0) =  mDisp_1(0);
-	d(1) =  mDisp_1(1);
-	d(2) =  mDisp_1(2);
-	d(3) =  mDisp_2(0);
-	d(4) =  mDisp_2(1);
-	d(5) =  mDisp_2(2);
-	d(6) =  mDisp_3(0);
-	d(7) =  mDisp_3(1);
-	d(8) =  mDisp_3(2);
-	d(9) =  mDisp_4(0);
-	d(10) = mDisp_4(1);
-	d(11) = mDisp_4(2);
-	d(12) = mDisp_5(0);
-	d(13) = mDisp_5(1);
-	d(14) = mDisp_5(2);
-	d(15) = mDisp_6(0);
-	d(16) = mDisp_6(1);
-	d(17) = mDisp_6(2);
-	d(18) = mDisp_7(0);
-	d(19) = mDisp_7(1);
-	d(20) = mDisp_7(2);
-	d(21) = mDisp_8(0);
-	d(22) = mDisp_8(1);
-	d(23) = mDisp_8(2);
+	double d[SSPB_NUM_DOF];
+	for (int i = 0; i < SSPB_NUM_NODE; i++) {
+		const Vector &mDisp = theNodes[i]->getTrialDisp();
+		d[3*i]   = mDisp(0);
+		d[3*i+1] = mDisp(1);
+		d[3*i+2] = mDisp(2);
+	}
 
 	// add stabilization force to internal force vector
-	mInternalForces = Kstab*d;
+	for (int i = 0; i < SSPB_NUM_DOF; i++)
+		mForceData[i] = 0.0;
+	for (int j = 0; j < SSPB_NUM_DOF; j++) {
+		const double *kCol = &mKstabData[j*SSPB_NUM_DOF];
+		for (int i = 0; i < SSPB_NUM_DOF; i++)
+			mForceData[i] += kCol[i]*d[j];
+	}
 
 	// add internal force from the stress  ->  fint = Kstab*d + 8*Jo*Bnot'*stress
-	mInternalForces.addMatrixTransposeVector(1.0, Bnot, mStress, mVol);
+	double sig[6];
+	for (int i = 0; i < 6; i++)
+		sig[i] = mStress(i);
+	SolidKernels<SSPB_NUM_NODE,SSPB_NUM_DIM>::addBTs(mDN, sig, mVol, mForceData);
 
 	// subtract body forces from internal force vector
 	Vector body(3);
@@ -861,6 +831,11 @@ SSPbrick::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBrok
     }
     cnt = cnt+24;
   }
+  for (int i = 0; i < SSPB_NUM_NODE; i++) {
+    mDN[0][i] = Bnot(0,3*i);
+    mDN[1][i] = Bnot(1,3*i+1);
+    mDN[2][i] = Bnot(2,3*i+2);
+  }
   
   cnt = 175;
   for (int i = 0; i < 24; i++) {
@@ -1245,6 +1220,10 @@ SSPbrick::GetStab(void)
 	Bnot.Zero();
 	Mben.Zero();
 	for (int i = 0; i < 8; i++) {
+		mDN[0][i] = dNmod(i,0);
+		mDN[1][i] = dNmod(i,1);
+		mDN[2][i] = dNmod(i,2);
+
 		Bnot(0,3*i)   = dNmod(i,0);
     	Bnot(1,3*i+1) = dNmod(i,1);
     	Bnot(2,3*i+2) = dNmod(i,2);
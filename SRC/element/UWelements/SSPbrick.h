@@ -126,6 +126,10 @@ class SSPbrick : public Element
 	
 	Matrix Bnot;                                        // mapping matrix for membrane modes
 	Matrix Kstab;                                       // stabilization stiffness matrix
+	double mKstabData[SSPB_NUM_DOF*SSPB_NUM_DOF];       // storage for Kstab
+	double mTangentData[SSPB_NUM_DOF*SSPB_NUM_DOF];     // storage for mTangentStiffness
+	double mForceData[SSPB_NUM_DOF];                    // storage for mInternalForces
+	double mDN[SSPB_NUM_DIM][SSPB_NUM_NODE];            // shape function gradients defining Bnot
 	Matrix mNodeCrd;                                    // nodal coordinate array
 	
 	Vector xi;                                          // xi evaluated at the nodes
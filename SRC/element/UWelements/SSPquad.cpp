@@ -27,6 +27,7 @@
 //                Acta Geotechnica, 7(4):297-311
 
 #include "SSPquad.h"
+#include <SolidKernels.h>
 
 #include <elementAPI.h>
 #include <Information.h>
@@ -240,13 +241,13 @@ SSPquad::SSPquad(int tag, int Nd1, int Nd2, int Nd3, int Nd4, NDMaterial &theMat
   :Element(tag,ELE_TAG_SSPquad),
   	theMaterial(0),
 	mExternalNodes(SSPQ_NUM_NODE),
-	mTangentStiffness(SSPQ_NUM_DOF,SSPQ_NUM_DOF),
-	mInternalForces(SSPQ_NUM_DOF),
+	mTangentStiffness(mTangentData,SSPQ_NUM_DOF,SSPQ_NUM_DOF),
+	mInternalForces(mForceData,SSPQ_NUM_DOF),
 	Q(SSPQ_NUM_DOF),
 	mMass(SSPQ_NUM_DOF,SSPQ_NUM_DOF),
 	mNodeCrd(2,4),
 	Mmem(3,SSPQ_NUM_DOF),
-	Kstab(SSPQ_NUM_DOF,SSPQ_NUM_DOF),
+	Kstab(mKstabData,SSPQ_NUM_DOF,SSPQ_NUM_DOF),
 	mThickness(thick),
 	applyLoad(0)
 {
@@ -263,6 +264,14 @@ SSPquad::SSPquad(int tag, int Nd1, int Nd2, int Nd3, int Nd4, NDMaterial &theMat
 	appliedB[0] = 0.0;
 	appliedB[1] = 0.0;
 
+	mTangentStiffness.Zero();
+	mInternalForces.Zero();
+	Kstab.Zero();
+	for (int i = 0; i < SSPQ_NUM_NODE; i++) {
+		mDN[0][i] = 0.0;
+		mDN[1][i] = 0.0;
+	}
+
 	// get copy of the material object
 	NDMaterial *theMatCopy = theMat.getCopy(type);
 	if (theMatCopy != 0) {
@@ -289,16 +298,23 @@ SSPquad::SSPquad()
   :Element(0,ELE_TAG_SSPquad),
   	theMaterial(0),
 	mExternalNodes(SSPQ_NUM_NODE),
-	mTangentStiffness(SSPQ_NUM_DOF,SSPQ_NUM_DOF),
-	mInternalForces(SSPQ_NUM_DOF),
+	mTangentStiffness(mTangentData,SSPQ_NUM_DOF,SSPQ_NUM_DOF),
+	mInternalForces(mForceData,SSPQ_NUM_DOF),
 	Q(SSPQ_NUM_DOF),
 	mMass(SSPQ_NUM_DOF,SSPQ_NUM_DOF),
 	mNodeCrd(2,4),
 	Mmem(3,SSPQ_NUM_DOF),
-	Kstab(SSPQ_NUM_DOF,SSPQ_NUM_DOF),
+	Kstab(mKstabData,SSPQ_NUM_DOF,SSPQ_NUM_DOF),
 	mThickness(0),
 	applyLoad(0)
 {
+	mTangentStiffness.Zero();
+	mInternalForces.Zero();
+	Kstab.Zero();
+	for (int i = 0; i < SSPQ_NUM_NODE; i++) {
+		mDN[0][i] = 0.0;
+		mDN[1][i] = 0.0;
+	}
 }
 
 // destructor
@@ -405,24 +421,17 @@ SSPquad::update(void)
 // this function updates variables for an incremental step n to n+1
 {
 	// get trial displacement
-	const Vector &mDisp_1 = theNodes[0]->getTrialDisp();
-	const Vector &mDisp_2 = theNodes[1]->getTrialDisp();
-	const Vector &mDisp_3 = theNodes[2]->getTrialDisp();
-	const Vector &mDisp_4 = theNodes[3]->getTrialDisp();
-	
-	// assemble displacement vector
-	Vector u(8);
-	u(0) = mDisp_1(0);
-	u(1) = mDisp_1(1);
-	u(2) = mDisp_2(0);
-	u(3) = mDisp_2(1);
-	u(4) = mDisp_3(0);
-	u(5) = mDisp_3(1);
-	u(6) = mDisp_4(0);
-	u(7) = mDisp_4(1);
-
-	Vector strain(3);
-	strain = Mmem*u;
+	double u[SSPQ_NUM_DOF];
+	for (int i = 0; i < SSPQ_NUM_NODE; i++) {
+		const Vector &mDisp = theNodes[i]->getTrialDisp();
+		u[2*i]   = mDisp(0);
+		u[2*i+1] = mDisp(1);
+	}
+
+	// compute strain and send it to the material
+	double eps[3];
+	Vector strain(eps, 3);
+	SolidKernels<SSPQ_NUM_NODE,2>::formStrain(mDN, u, eps);
 	theMaterial->setTrialStrain(strain);
 
 	return 0;
@@ -435,9 +444,10 @@ SSPquad::getTangentStiff(void)
 	// get material tangent
 	const Matrix &Cmat = theMaterial->getTangent();
 
-	// full element stiffness matrix
-	mTangentStiffness = Kstab;
-	mTangentStiffness.addMatrixTripleProduct(1.0, Mmem, Cmat, 4.0*J0*mThickness);
+	// full element stiffness matrix  ->  K = Kstab + 4*t*Jo*Mmem'*C*Mmem
+	for (int i = 0; i < SSPQ_NUM_DOF*SSPQ_NUM_DOF; i++)
+		mTangentData[i] = mKstabData[i];
+	SolidKernels<SSPQ_NUM_NODE,2>::addBTDB(mDN, Cmat, 4.0*J0*mThickness, mTangentData);
 	
 	return mTangentStiffness;
 }
@@ -557,29 +567,31 @@ SSPquad::getResistingForce(void)
 // this function computes the resisting force vector for the element
 {
 	// get stress from the material
-	Vector mStress = theMaterial->getStress();
+	const Vector &mStress = theMaterial->getStress();
 
 	// get trial displacement
-	const Vector &mDisp_1 = theNodes[0]->getTrialDisp();
-	const Vector &mDisp_2 = theNodes[1]->getTrialDisp();
-	const Vector &mDisp_3 = theNodes[2]->getTrialDisp();
-	const Vector &mDisp_4 = theNodes[3]->getTrialDisp();
-
-	Vector d(8);
-	d(0) = mDisp_1(0);
-	d(1) = mDisp_1(1);
-	d(2) = mDisp_2(0);
-	d(3) = mDisp_2(1);
-	d(4) = mDisp_3(0);
-	d(5) = mDisp_3(1);
-	d(6) = mDisp_4(0);
-	d(7) = mDisp_4(1);
+	double d[SSPQ_NUM_DOF];
+	for (int i = 0; i < SSPQ_NUM_NODE; i++) {
+		const Vector &mDisp = theNodes[i]->getTrialDisp();
+		d[2*i]   = mDisp(0);
+		d[2*i+1] = mDisp(1);
+	}
 	
 	// add stabilization force to internal force vector
-	mInternalForces = Kstab*d;
+	for (int i = 0; i < SSPQ_NUM_DOF; i++)
+		mForceData[i] = 0.0;
+	for (int j = 0; j < SSPQ_NUM_DOF; j++) {
+		const double *kCol = &mKstabData[j*SSPQ_NUM_DOF];
+		for (int i = 0; i < SSPQ_NUM_DOF; i++)
+			mForceData[i] += kCol[i]*d[j];
+	}
 
 	// add internal force from the stress  ->  fint = Kstab*d + 4*t*Jo*Mmem'*stress
-	mInternalForces.addMatrixTransposeVector(1.0, Mmem, mStress, 4.0*mThickness*J0);
+	double sig[3];
+	sig[0] = mStress(0);
+	sig[1] = mStress(1);
+	sig[2] = mStress(2);
+	SolidKernels<SSPQ_NUM_NODE,2>::addBTs(mDN, sig, 4.0*mThickness*J0, mForceData);
 
 	// subtract body forces from internal force vector
 	double xi[4];
@@ -950,6 +962,9 @@ SSPquad::GetStab(void)
 	Mmem.Zero();
 	Mben.Zero();
 	for (int i = 0; i < 4; i++) {
+		mDN[0][i] = dN(i,0);
+		mDN[1][i] = dN(i,1);
+
 		Mmem(0,2*i)   = dN(i,0);
 		Mmem(1,2*i+1) = dN(i,1);
 		Mmem(2,2*i)   = dN(i,1);
@@ -130,6 +130,10 @@ class SSPquad : public Element
 	
 	Matrix Mmem;                                        // mapping matrix for membrane modes
 	Matrix Kstab;                                       // stabilization stiffness matrix
+	double mKstabData[SSPQ_NUM_DOF*SSPQ_NUM_DOF];       // storage for Kstab
+	double mTangentData[SSPQ_NUM_DOF*SSPQ_NUM_DOF];     // storage for mTangentStiffness
+	double mForceData[SSPQ_NUM_DOF];                    // storage for mInternalForces
+	double mDN[2][SSPQ_NUM_NODE];                       // shape function gradients defining Mmem
 	Matrix mNodeCrd;                                    // nodal coordinate array
 };
 
@@ -35,6 +35,9 @@
 #include <ElementResponse.h>
 #include <TCP_Socket.h>
 #include <UDP_Socket.h>
+#ifndef _WIN32
+    #include <SharedMemoryChannel.h>
+#endif
 #ifdef SSL
     #include <TCP_SocketSSL.h>
 #endif
@@ -49,7 +52,7 @@ void* OPS_Adapter()
     int ndf = OPS_GetNDF();
     if (OPS_GetNumRemainingInputArgs() < 8) {
         opserr << "WARNING insufficient arguments\n";
-        opserr << "Want: element adapter eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -stif Kij ipPort <-ssl> <-udp> <-doRayleigh> <-mass Mij>\n";
+        opserr << "Want: element adapter eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -stif Kij ipPort <-ssl> <-udp> <-shm> <-doRayleigh> <-mass Mij>\n";
         return 0;
     }
     
@@ -147,7 +150,7 @@ void* OPS_Adapter()
     }
     
     // options
-    int ssl = 0, udp = 0;
+    int ssl = 0, udp = 0, shm = 0;
     int doRayleigh = 0;
     Matrix *mb = 0;
     if (OPS_GetNumRemainingInputArgs() < 1) {
@@ -157,10 +160,13 @@ void* OPS_Adapter()
     while (OPS_GetNumRemainingInputArgs() > 0) {
         type = OPS_GetString();
         if (strcmp(type, "-ssl") == 0) {
-            ssl = 1; udp = 0;
+            ssl = 1; udp = 0; shm = 0;
         }
         else if (strcmp(type, "-udp") == 0) {
-            udp = 1; ssl = 0;
+            udp = 1; ssl = 0; shm = 0;
+        }
+        else if (strcmp(type, "-shm") == 0) {
+            shm = 1; ssl = 0; udp = 0;
         }
         else if (strcmp(type, "-doRayleigh") == 0) {
             doRayleigh = 1;
@@ -188,7 +194,7 @@ void* OPS_Adapter()
     
     // create object
     Element *theEle = new Adapter(tag, nodes, dofs, kb, ipPort,
-        ssl, udp, doRayleigh, mb);
+        ssl, udp, doRayleigh, mb, shm);
     
     // cleanup dynamic memory
     if (dofs != 0)
@@ -203,11 +209,12 @@ void* OPS_Adapter()
 // responsible for allocating the necessary space needed
 // by each object and storing the tags of the end nodes.
 Adapter::Adapter(int tag, ID nodes, ID *dof, const Matrix &_kb,
-    int ipport, int _ssl, int _udp, int addRay, const Matrix *_mb)
+    int ipport, int _ssl, int _udp, int addRay, const Matrix *_mb,
+    int _shm)
     : Element(tag, ELE_TAG_Adapter),
     connectedExternalNodes(nodes), basicDOF(1), numExternalNodes(0),
     numDOF(0), numBasicDOF(0), kb(_kb), ipPort(ipport), ssl(_ssl),
-    udp(_udp), addRayleigh(addRay), mb(0), tPast(0.0),
+    udp(_udp), shm(_shm), addRayleigh(addRay), mb(0), tPast(0.0),
     theMatrix(1,1), theVector(1), theLoad(1), db(1), q(1),
     theChannel(0), rData(0), recvData(0), sData(0), sendData(0),
     ctrlDisp(0), ctrlVel(0), ctrlAccel(0), ctrlForce(0), ctrlTime(0),
@@ -260,7 +267,7 @@ Adapter::Adapter()
     : Element(0, ELE_TAG_Adapter),
     connectedExternalNodes(1), basicDOF(1), numExternalNodes(0),
     numDOF(0), numBasicDOF(0), kb(1,1), ipPort(0), ssl(0),
-    udp(0), addRayleigh(0), mb(0), tPast(0.0),
+    udp(0), shm(0), addRayleigh(0), mb(0), tPast(0.0),
     theMatrix(1,1), theVector(1), theLoad(1), db(1), q(1),
     theChannel(0), rData(0), recvData(0), sData(0), sendData(0),
     ctrlDisp(0), ctrlVel(0), ctrlAccel(0), ctrlForce(0), ctrlTime(0),
@@ -660,7 +667,7 @@ const Vector& Adapter::getResistingForceIncInertia()
 int Adapter::sendSelf(int commitTag, Channel &sChannel)
 {
     // send element parameters
-    static Vector data(11);
+    static Vector data(12);
     data(0) = this->getTag();
     data(1) = numExternalNodes;
     data(2) = ipPort;
@@ -672,6 +679,7 @@ int Adapter::sendSelf(int commitTag, Channel &sChannel)
     data(8) = betaK;
     data(9) = betaK0;
     data(10) = betaKc;
+    data(11) = shm;
     sChannel.sendVector(0, commitTag, data);
     
     // send the end nodes and dofs
@@ -700,7 +708,7 @@ int Adapter::recvSelf(int commitTag, Channel &rChannel,
         delete mb;
     
     // receive element parameters
-    static Vector data(11);
+    static Vector data(12);
     rChannel.recvVector(0, commitTag, data);
     this->setTag((int)data(0));
     numExternalNodes = (int)data(1);
@@ -712,6 +720,7 @@ int Adapter::recvSelf(int commitTag, Channel &rChannel,
     betaK = data(8);
     betaK0 = data(9);
     betaKc = data(10);
+    shm = (int)data(11);
     
     // initialize nodes and receive them
     connectedExternalNodes.resize(numExternalNodes);
@@ -1009,6 +1018,10 @@ int Adapter::setupConnection()
 #ifdef SSL
     else if (ssl)
         theChannel = new TCP_SocketSSL(ipPort);
+#endif
+#ifndef _WIN32
+    else if (shm)
+        theChannel = new SharedMemoryChannel(ipPort);
 #endif
     else
         theChannel = new TCP_Socket(ipPort);
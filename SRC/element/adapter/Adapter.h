@@ -60,7 +60,7 @@ public:
     // constructors
     Adapter(int tag, ID nodes, ID *dof, const Matrix &stif,
         int ipPort, int ssl = 0, int udp = 0,
-        int addRayleigh = 0, const Matrix *mass = 0);
+        int addRayleigh = 0, const Matrix *mass = 0, int shm = 0);
     Adapter();
     
     // destructor
@@ -122,6 +122,7 @@ private:
     int ipPort;                 // ipPort
     int ssl;                    // secure socket layer flag
     int udp;                    // udp socket flag
+    int shm;                    // shared memory channel flag
     int addRayleigh;            // flag to add Rayleigh damping
     Matrix *mb;                 // mass matrix in basic system
     double tPast;               // past time
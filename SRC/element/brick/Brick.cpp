@@ -40,6 +40,8 @@
 #include <ErrorHandler.h>
 #include <Brick.h>
 #include <shp3d.h>
+#include <SolidKernels.h>
+#include <ShapeFunctionCache.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 #include <Parameter.h>
@@ -109,8 +111,10 @@ void* OPS_Brick()
 //static data
 double  Brick::xl[3][8] ;
 
-Matrix  Brick::stiff(24,24) ;
-Vector  Brick::resid(24) ;
+double  Brick::stiffData[24*24] ;
+double  Brick::residData[24] ;
+Matrix  Brick::stiff(stiffData,24,24) ;
+Vector  Brick::resid(residData,24) ;
 Matrix  Brick::mass(24,24) ;
 
     
@@ -130,7 +134,7 @@ static Matrix B(6,3) ;
 //null constructor
 Brick::Brick( ) 
 :Element( 0, ELE_TAG_Brick ),
- connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+ connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), shpCache(0), initDisp(0)
 {
   B.Zero();
 
@@ -163,7 +167,7 @@ Brick::Brick(int tag,
 	     double b1, double b2, double b3,
        Damping *damping)
   :Element(tag, ELE_TAG_Brick),
-   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0), shpCache(0), initDisp(0)
 {
   B.Zero();
 
@@ -225,6 +229,11 @@ Brick::~Brick( )
   if (Ki != 0)
     delete Ki;
 
+  if (initDisp != 0)
+    delete [] initDisp;
+
+  ShapeFunctionCache::release( shpCache, 4*8*8 + 8 ) ;
+
   for (int i = 0; i < 8; i++)
   {
     if (theDamping[i])
@@ -258,6 +267,28 @@ void  Brick::setDomain( Domain *theDomain )
 
   this->DomainComponent::setDomain(theDomain);
 
+  //shape functions never change for this element, cache them if allowed
+  ShapeFunctionCache::release( shpCache, 4*8*8 + 8 ) ;
+  shpCache = 0 ;
+  bool haveNodes = true ;
+  for ( i = 0; i < 8; i++ )
+    if ( nodePointers[i] == 0 )
+      haveNodes = false ;
+  if ( haveNodes ) {
+    double *theCache = ShapeFunctionCache::allocate( 4*8*8 + 8 ) ;
+    if ( theCache != 0 ) {
+      static double Shape[4][8][8] ;
+      static double dvol[8] ;
+      this->shapeFunctions( Shape, dvol ) ;
+      double *shape = &Shape[0][0][0] ;
+      for ( int p = 0; p < 4*8*8; p++ )
+	theCache[p] = shape[p] ;
+      for ( int p = 0; p < 8; p++ )
+	theCache[4*8*8+p] = dvol[p] ;
+      shpCache = theCache ;
+    }
+  }
+
 }
 
 
@@ -478,79 +509,26 @@ const Matrix&  Brick::getInitialStiff( )
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
   static const int ndm = 3 ;
-  static const int ndf = 3 ; 
   static const int nstress = 6 ;
   static const int numberNodes = 8 ;
   static const int numberGauss = 8 ;
   static const int nShape = 4 ;
 
-  int i, j, k, p, q ;
-  int jj, kk ;
+  int i, p, q ;
 
   
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
   static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
   static Vector strain(nstress) ;  //strain
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
   static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
   static Matrix dd(nstress,nstress) ;  //material tangent
 
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
   
   //zero stiffness and residual 
   stiff.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  shapeFunctions( Shape, dvol ) ;
   
 
   //gauss loop 
@@ -567,42 +545,9 @@ const Matrix&  Brick::getInitialStiff( )
     if(theDamping[i]) dd *= theDamping[i]->getStiffnessMultiplier();
     dd *= dvol[i] ;
     
-    jj = 0;
-    for ( j = 0; j < numberNodes; j++ ) {
-
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++) 
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
-
-      //BJtranD = BJtran * dd ;
-      BJtranD.addMatrixProduct(0.0,  BJtran, dd, 1.0) ;
-      
-      kk = 0 ;
-      for ( k = 0; k < numberNodes; k++ ) {
-	
-	BK = computeB( k, shp ) ;
-	
-	
-	//stiffJK =  BJtranD * BK  ;
-	stiffJK.addMatrixProduct(0.0,  BJtranD, BK, 1.0) ;
-	
-	for ( p = 0; p < ndf; p++ )  {
-	  for ( q = 0; q < ndf; q++ )
-	    stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-	} //end for p
-
-	kk += ndf ;
-
-      } // end for k loop
+    //stiff += BT * dd * B
+    SolidKernels<numberNodes,ndm>::addBTDB( shp, dd, 1.0, stiffData ) ;
 
-      jj += ndf ;
-
-    } // end for j loop
   } //end for i gauss loop 
 
   Ki = new Matrix(stiff);
@@ -666,6 +611,53 @@ Brick::addLoad(ElementalLoad *theLoad, double loadFactor)
   return -1;
 }
 
+int
+Brick::getEquivalentLoad(ElementalLoad *theLoad, Vector &P)
+{
+  static const int numberNodes = 8 ;
+  static const int numberGauss = 8 ;
+  static const int ndf = 3 ;
+
+  int type;
+  const Vector &data = theLoad->getData(type, 1.0);
+
+  double bLoad[ndf];
+  if (type == LOAD_TAG_BrickSelfWeight) {
+    for (int p = 0; p < ndf; p++)
+      bLoad[p] = b[p];
+  } else if (type == LOAD_TAG_SelfWeight) {
+    for (int p = 0; p < ndf; p++)
+      bLoad[p] = data(p)*b[p];
+  } else
+    return -1;
+
+  // the body force formResidAndTangent() subtracts for appliedB = bLoad
+  static double dvol[numberGauss] ;
+  static double Shape[4][numberNodes][numberGauss] ;
+  shapeFunctions( Shape, dvol ) ;
+
+  P.Zero();
+  for (int i = 0; i < numberGauss; i++)
+    for (int j = 0; j < numberNodes; j++)
+      for (int p = 0; p < ndf; p++)
+	P(j*ndf + p) += dvol[i]*bLoad[p]*Shape[3][j][i];
+
+  return 0;
+}
+
+int
+Brick::addEquivalentLoad(const Vector &P, double fact)
+{
+  if (load == 0)
+    load = new Vector(24);
+
+  // the body force is in the load vector, keep b out of the residual
+  applyLoad = 1;
+  load->addVector(1.0, P, fact);
+
+  return 0;
+}
+
 int
 Brick::addInertiaLoadToUnbalance(const Vector &accel)
 {
@@ -698,7 +690,7 @@ Brick::addInertiaLoadToUnbalance(const Vector &accel)
   }
 
   // create the load vector if one does not exist
-  if (load == 0) 
+  if (load == 0)
     load = new Vector(numberNodes*ndf);
 
   // add -M * RV(accel) to the load vector
@@ -707,6 +699,23 @@ Brick::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+Brick::hasConstantMass(void)
+{
+  return true;
+}
+
+int
+Brick::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  if (load == 0)
+    load = new Vector(24);
+
+  load->addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 
 //get residual
 const Vector&  Brick::getResistingForce( ) 
@@ -753,7 +762,6 @@ const Vector&  Brick::getResistingForceIncInertia( )
 void   Brick::formInertiaTerms( int tangFlag ) 
 {
 
-  static const int ndm = 3 ;
 
   static const int ndf = 3 ; 
 
@@ -765,16 +773,12 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   static const int massIndex = nShape - 1 ;
 
-  double xsj ;  // determinant jacaobian matrix 
-
   double dvol[numberGauss] ; //volume element
 
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
   static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
-
   static Vector momentum(ndf) ;
 
   int i, j, k, p, q ;
@@ -786,39 +790,8 @@ void   Brick::formInertiaTerms( int tangFlag )
   //zero mass 
   mass.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  shapeFunctions( Shape, dvol ) ;
   
 
 
@@ -906,74 +879,38 @@ Brick::update(void)
 
   static const int nShape = 4 ;
 
-  int i, j, k, p, q ;
+  int i, j, p, q ;
   int success ;
   
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
   static double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static double eps[nstress] ;
 
-  static Vector strain(nstress) ;  //strain
+  static Vector strain(eps,nstress) ;  //strain
+
+  static double ul[numberNodes*ndf] ;  //nodal displacements
 
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
   static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
   
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  shapeFunctions( Shape, dvol ) ;
   
 
+  //nodal displacements
+  for ( j = 0; j < numberNodes; j++ ) {
+    const Vector &disp = nodePointers[j]->getTrialDisp( ) ;
+    for ( p = 0; p < ndf; p++ )
+      ul[j*ndf+p] = disp(p) ;
+  } // end for j
+
+  //strains are measured from the displacements at activation
+  if ( initDisp != 0 ) {
+    for ( j = 0; j < numberNodes*ndf; j++ )
+      ul[j] -= initDisp[j] ;
+  }
+
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
@@ -984,66 +921,8 @@ Brick::update(void)
     } // end for p
 
 
-    //zero the strains
-    strain.Zero( ) ;
-
-    // j-node loop to compute strain 
-    for ( j = 0; j < numberNodes; j++ )  {
-
-      /**************** fmk - unwinding for performance
-      //compute B matrix 
-      BJ = computeB( j, shp ) ;
-
-      //nodal displacements 
-      const Vector &ul = nodePointers[j]->getTrialDisp( ) ;
-
-      //compute the strain
-      //strain += (BJ*ul) ; 
-      strain.addMatrixVector(1.0,  BJ,ul,1.0 ) ;
-      ***************************************************/
-
-
-      //               | N,1      0     0    | 
-      //   B       =   |   0     N,2    0    |
-      //               |   0      0     N,3  |   (6x3)
-      //               | N,2     N,1     0   |
-      //               |   0     N,3    N,2  |
-      //               | N,3      0     N,1  |
-
-      //      B(0,0) = shp[0][node] ;
-      //      B(1,1) = shp[1][node] ;
-      //      B(2,2) = shp[2][node] ;
-      //      B(3,0) = shp[1][node] ;
-      //      B(3,1) = shp[0][node] ;
-      //      B(4,1) = shp[2][node] ;
-      //      B(4,2) = shp[1][node] ;
-      //      B(5,0) = shp[2][node] ;
-      //      B(5,2) = shp[0][node] ;
-
-      double b00 = shp[0][j];
-      double b11 = shp[1][j];
-      double b22 = shp[2][j];
-      double b30 = shp[1][j];
-      double b31 = shp[0][j];
-      double b41 = shp[2][j];
-      double b42 = shp[1][j];
-      double b50 = shp[2][j];
-      double b52 = shp[0][j];
-
-      const Vector &ul = nodePointers[j]->getTrialDisp();
-
-      double ul0 = ul(0);
-      double ul1 = ul(1);
-      double ul2 = ul(2);
-
-      strain(0) += b00 * ul0;
-      strain(1) += b11 * ul1;
-      strain(2) += b22 * ul2;
-      strain(3) += b30 * ul0 + b31 * ul1;
-      strain(4) += b41 * ul1 + b42 * ul2;
-      strain(5) += b50 * ul0 + b52 * ul2;
-
-    } // end for j
+    //compute the strain
+    SolidKernels<numberNodes,ndm>::formStrain( shp, ul, eps ) ;
     
     //send the strain to the material 
     success = materialPointers[i]->setTrialStrain( strain ) ;
@@ -1054,6 +933,31 @@ Brick::update(void)
 }
 
 
+//the element is activated stress free in the current configuration
+void
+Brick::onActivate(void)
+{
+  if ( nodePointers[0] == 0 )
+    return ;
+
+  if ( initDisp == 0 )
+    initDisp = new double[24] ;
+
+  for ( int j = 0; j < 8; j++ ) {
+    const Vector &disp = nodePointers[j]->getTrialDisp( ) ;
+    for ( int p = 0; p < 3; p++ )
+      initDisp[j*3+p] = disp(p) ;
+  }
+}
+
+
+void
+Brick::onDeactivate(void)
+{
+
+}
+
+
 //*********************************************************************
 //form residual and tangent
 void  Brick::formResidAndTangent( int tang_flag ) 
@@ -1073,24 +977,16 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   static const int nShape = 4 ;
 
-  int i, j, k, p, q ;
-
-
-  static double volume ;
+  int i, j, p, q ;
 
-  static double xsj ;  // determinant jacaobian matrix 
 
   static double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
-
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
   static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static double sig[nstress] ;  //stress + damping stress
 
   static Vector stress(nstress) ;  //stress
 
@@ -1098,60 +994,13 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   static Matrix dd(nstress,nstress) ;  //material tangent
 
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
   
   //zero stiffness and residual 
   stiff.Zero( ) ;
   resid.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
+  //shape functions and volume elements at the gauss points
+  shapeFunctions( Shape, dvol ) ;
   
 
   //gauss loop 
@@ -1184,109 +1033,92 @@ void  Brick::formResidAndTangent( int tang_flag )
     } //end if tang_flag
 
 
-    double stress0 = stress(0);
-    double stress1 = stress(1);
-    double stress2 = stress(2);
-    double stress3 = stress(3);
-    double stress4 = stress(4);
-    double stress5 = stress(5);
+    for ( p = 0; p < nstress; p++ )
+      sig[p] = stress(p) ;
 
-    //residual and tangent calculations node loops
-
-    int jj = 0 ;
-    for ( j = 0; j < numberNodes; j++ ) {
-
-      /* ************** fmk - unwinding for performance 
-      ************************************************* */
-
-      //               | N,1      0     0    | 
-      //   B       =   |   0     N,2    0    |
-      //               |   0      0     N,3  |   (6x3)
-      //               | N,2     N,1     0   |
-      //               |   0     N,3    N,2  |
-      //               | N,3      0     N,1  |
-
-      //      B(0,0) = shp[0][node] ;
-      //      B(1,1) = shp[1][node] ;
-      //      B(2,2) = shp[2][node] ;
-      //      B(3,0) = shp[1][node] ;
-      //      B(3,1) = shp[0][node] ;
-      //      B(4,1) = shp[2][node] ;
-      //      B(4,2) = shp[1][node] ;
-      //      B(5,0) = shp[2][node] ;
-      //      B(5,2) = shp[0][node] ;
-
-      double b00 = shp[0][j];
-      double b11 = shp[1][j];
-      double b22 = shp[2][j];
-      double b30 = shp[1][j];
-      double b31 = shp[0][j];
-      double b41 = shp[2][j];
-      double b42 = shp[1][j];
-      double b50 = shp[2][j];
-      double b52 = shp[0][j];
-
-      residJ(0) = b00 * stress0 + b30 * stress3 + b50 * stress5;
-      residJ(1) = b11 * stress1 + b31 * stress3 + b41 * stress4;
-      residJ(2) = b22 * stress2 + b42 * stress4 + b52 * stress5;
-
-      residJ(0) += b00 * dampingStress[0] + b30 * dampingStress[3] + b50 * dampingStress[5];
-      residJ(1) += b11 * dampingStress[1] + b31 * dampingStress[3] + b41 * dampingStress[4];
-      residJ(2) += b22 * dampingStress[2] + b42 * dampingStress[4] + b52 * dampingStress[5];
-      
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++) 
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
+    if (theDamping[i]) {
+      for ( p = 0; p < nstress; p++ )
+	sig[p] += dampingStress(p) ;
+    }
 
+    //residual
+    SolidKernels<numberNodes,ndm>::addBTs( shp, sig, 1.0, residData ) ;
 
-      //residual 
+    for ( j = 0; j < numberNodes; j++ ) {
       for ( p = 0; p < ndf; p++ ) {
-        resid( jj + p ) += residJ(p)  ;
 	if (applyLoad == 0)
-	  resid( jj + p ) -= dvol[i]*b[p]*shp[3][j];
+	  resid( j*ndf + p ) -= dvol[i]*b[p]*shp[3][j];
 	else
-	  resid( jj + p ) -= dvol[i]*appliedB[p]*shp[3][j];
+	  resid( j*ndf + p ) -= dvol[i]*appliedB[p]*shp[3][j];
       }
+    } // end for j
 
-      if ( tang_flag == 1 ) {
-
-	//BJtranD = BJtran * dd ;
-	BJtranD.addMatrixProduct(0.0,  BJtran,dd,1.0) ;
+    //tangent
+    if ( tang_flag == 1 )
+      SolidKernels<numberNodes,ndm>::addBTDB( shp, dd, 1.0, stiffData ) ;
 
-	int kk = 0 ;
-         for ( k = 0; k < numberNodes; k++ ) {
+  } //end for i gauss loop 
 
-            BK = computeB( k, shp ) ;
   
- 
-            //stiffJK =  BJtranD * BK  ;
-	    stiffJK.addMatrixProduct(0.0,  BJtranD,BK,1.0) ;
+  return ;
+}
 
-            for ( p = 0; p < ndf; p++ )  {
-               for ( q = 0; q < ndf; q++ )
-                  stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-            } //end for p
 
-            kk += ndf ;
-          } // end for k loop
+//************************************************************************
+//shape functions and volume elements at the gauss points
 
-      } // end if tang_flag 
+void  Brick::shapeFunctions( double Shape[4][8][8], double dvol[8] )
+{
+  static const int nShape = 4 ;
+  static const int numberNodes = 8 ;
+  static const int numberGauss = 8 ;
+  static const int shapeSize = nShape*numberNodes*numberGauss ;
+
+  //geometrically linear, so reuse what was computed in setDomain
+  if ( shpCache != 0 ) {
+    double *shape = &Shape[0][0][0] ;
+    for ( int p = 0; p < shapeSize; p++ )
+      shape[p] = shpCache[p] ;
+    for ( int p = 0; p < numberGauss; p++ )
+      dvol[p] = shpCache[shapeSize+p] ;
+    ShapeFunctionCache::recordHit( ) ;
+    return ;
+  }
 
-      jj += ndf ;
-    } // end for j loop
+  static double xsj ;  // determinant jacaobian matrix
+  static double gaussPoint[3] ;
+  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
+  //compute basis vectors and local nodal coordinates
+  computeBasis( ) ;
 
-  } //end for i gauss loop 
+  int count = 0 ;
+  for ( int i = 0; i < 2; i++ ) {
+    for ( int j = 0; j < 2; j++ ) {
+      for ( int k = 0; k < 2; k++ ) {
 
-  
-  return ;
-}
+        gaussPoint[0] = sg[i] ;
+	gaussPoint[1] = sg[j] ;
+	gaussPoint[2] = sg[k] ;
 
+	//get shape functions
+	shp3d( gaussPoint, xsj, shp, xl ) ;
+
+	//save shape functions
+	for ( int p = 0; p < nShape; p++ ) {
+	  for ( int q = 0; q < numberNodes; q++ )
+	    Shape[p][q][count] = shp[p][q] ;
+	} // end for p
+
+	//volume element to also be saved
+	dvol[count] = wg[count] * xsj ;
+
+	count++ ;
+
+      } //end for k
+    } //end for j
+  } // end for i
+}
 
 //************************************************************************
 //compute local coordinates and basis
@@ -1433,7 +1265,7 @@ int  Brick::sendSelf (int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector dData(7);
+  static Vector dData(32);
   dData(0) = alphaM;
   dData(1) = betaK;
   dData(2) = betaK0;
@@ -1442,6 +1274,11 @@ int  Brick::sendSelf (int commitTag, Channel &theChannel)
   dData(5) = b[1];
   dData(6) = b[2];
 
+  // the nodal displacements at activation, if it has been activated
+  dData(7) = (initDisp != 0) ? 1.0 : 0.0;
+  for (i = 0; i < 24; i++)
+    dData(8+i) = (initDisp != 0) ? initDisp[i] : 0.0;
+
   if (theChannel.sendVector(dataTag, commitTag, dData) < 0) {
     opserr << "Brick::sendSelf() - failed to send double data\n";
     return -1;
@@ -1488,7 +1325,7 @@ int  Brick::recvSelf (int commitTag,
 
   this->setTag(idData(24));
 
-  static Vector dData(7);
+  static Vector dData(32);
   if (theChannel.recvVector(dataTag, commitTag, dData) < 0) {
     opserr << "DispBeamColumn2d::sendSelf() - failed to recv double data\n";
     return -1;
@@ -1501,6 +1338,16 @@ int  Brick::recvSelf (int commitTag,
   b[1] = dData(5);
   b[2] = dData(6);
 
+  if (dData(7) != 0.0) {
+    if (initDisp == 0)
+      initDisp = new double[24];
+    for (int j = 0; j < 24; j++)
+      initDisp[j] = dData(8+j);
+  } else if (initDisp != 0) {
+    delete [] initDisp;
+    initDisp = 0;
+  }
+
 
   connectedExternalNodes(0) = idData(16);
   connectedExternalNodes(1) = idData(17);
@@ -95,6 +95,8 @@ class Brick : public Element {
 
     // update
     int update(void);
+    void onActivate(void);
+    void onDeactivate(void);
 
     //print out element data
     void Print( OPS_Stream &s, int flag ) ;
@@ -106,7 +108,11 @@ class Brick : public Element {
 
     void zeroLoad( ) ;
     int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int getEquivalentLoad(ElementalLoad *theLoad, Vector &P);
+    int addEquivalentLoad(const Vector &P, double fact);
     int addInertiaLoadToUnbalance(const Vector &accel);
+    bool hasConstantMass(void);
+    int addEffectiveInertiaLoad(const Vector &effLoad, double fact);
 
     //get residual
     const Vector &getResistingForce( ) ;
@@ -147,10 +153,15 @@ class Brick : public Element {
     Vector *load;
     Matrix *Ki;
 
+    double *shpCache ; //shape functions and volume elements, 0 if not cached
+    double *initDisp ; //nodal displacements at activation, 0 if never activated
+
     //
     // static attributes
     //
 
+    static double stiffData[24*24] ;
+    static double residData[24] ;
     static Matrix stiff ;
     static Vector resid ;
     static Matrix mass ;
@@ -178,6 +189,9 @@ class Brick : public Element {
     //compute coordinate system
     void computeBasis( ) ;
 
+    //shape functions and volume elements at the gauss points
+    void shapeFunctions( double Shape[4][8][8], double dvol[8] ) ;
+
     //compute B matrix
     const Matrix& computeB( int node, const double shp[4][8] ) ;
   
@@ -38,6 +38,7 @@
 #include <Twenty_Node_Brick.h>
 #include <shp3d.h>
 #include <shp3dv.h>
+#include <ShapeFunctionCache.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
@@ -113,7 +114,7 @@ double Twenty_Node_Brick::dvolu[27];
 //null constructor
 Twenty_Node_Brick::Twenty_Node_Brick( ) :
 Element( 0, ELE_TAG_Twenty_Node_Brick ),
-connectedExternalNodes(20), applyLoad(0), load(0), Ki(0)//, kc(0), rho(0)
+connectedExternalNodes(20), applyLoad(0), load(0), Ki(0), shgCache(0)//, kc(0), rho(0)
 {
 	for (int i=0; i<20; i++ ) {
 		nodePointers[i] = 0;
@@ -151,7 +152,7 @@ Twenty_Node_Brick::Twenty_Node_Brick(int tag,
 											   NDMaterial &theMaterial,
 											   double b1, double b2, double b3) :
 Element( tag, ELE_TAG_Twenty_Node_Brick ),
-connectedExternalNodes(20), applyLoad(0), load(0), Ki(0)//, kc(bulk), rho(rhof)
+connectedExternalNodes(20), applyLoad(0), load(0), Ki(0), shgCache(0)//, kc(bulk), rho(rhof)
 {
 	connectedExternalNodes(0) = node1 ;
 	connectedExternalNodes(1) = node2 ;
@@ -226,6 +227,8 @@ Twenty_Node_Brick::~Twenty_Node_Brick( )
 
 	if (Ki != 0)
 		delete Ki;
+
+	ShapeFunctionCache::release(shgCache, 4*20*27 + 27);
 }
 
 
@@ -237,6 +240,8 @@ void  Twenty_Node_Brick::setDomain( Domain *theDomain )
 	if (theDomain == 0) {
 		for ( i=0; i<nenu; i++ )
 			nodePointers[i] = 0;
+		ShapeFunctionCache::release(shgCache, 4*20*27 + 27);
+		shgCache = 0;
 		return;
 	}
 	//node pointers
@@ -254,6 +259,20 @@ void  Twenty_Node_Brick::setDomain( Domain *theDomain )
 		}
 	}
 	this->DomainComponent::setDomain(theDomain);
+
+	// global shape functions never change for this element, cache them if allowed
+	ShapeFunctionCache::release(shgCache, 4*20*27 + 27);
+	shgCache = 0;
+	double *theCache = ShapeFunctionCache::allocate(4*20*27 + 27);
+	if (theCache != 0) {
+		this->globalShapeFunctions();
+		double *shg = &shgu[0][0][0];
+		for (i = 0; i < 4*20*27; i++)
+			theCache[i] = shg[i];
+		for (i = 0; i < 27; i++)
+			theCache[4*20*27+i] = dvolu[i];
+		shgCache = theCache;
+	}
 }
 
 
@@ -428,9 +447,7 @@ Twenty_Node_Brick::update()
 {
 	int i, j, k, k1;
 	static double u[3][20];
-	static double xsj;
 	static Matrix B(6, 3);
-	double volume = 0.;
 
 	for (i = 0; i < nenu; i++) {
 	     const Vector &disp = nodePointers[i]->getTrialDisp();
@@ -443,16 +460,8 @@ Twenty_Node_Brick::update()
 
 	int ret = 0;
 
-	//compute basis vectors and local nodal coordinates
-	computeBasis( ) ;
-
-	for( i = 0; i < nintu; i++ ) {
-		// compute Jacobian and global shape functions
-		Jacobian3d(i, xsj, 0);
-		//volume element to also be saved
-		dvolu[i] = wu[i] * xsj ;
-		volume += dvolu[i];
-	} // end for i
+	// global shape functions and volume elements at the gauss points
+	globalShapeFunctions( ) ;
     //printf("volume = %f\n", volume);
 
 	// Loop over the integration points
@@ -563,9 +572,7 @@ const Matrix&  Twenty_Node_Brick::getStiff( int flag )
 
 
 
-	static double xsj ;  // determinant jacaobian matrix
 
-	double volume = 0.;
 
 	//-------------------------------------------------------
 
@@ -589,25 +596,8 @@ const Matrix&  Twenty_Node_Brick::getStiff( int flag )
 
 
 
-	//compute basis vectors and local nodal coordinates
-
-	computeBasis( ) ;
-
-
-
-	for( i = 0; i < nintu; i++ ) {
-
-		// compute Jacobian and global shape functions
-
-		Jacobian3d(i, xsj, 0);
-
-		//volume element to also be saved
-
-		dvolu[i] = wu[i] * xsj ;
-
-		volume += dvolu[i];
-
-	} // end for i
+	// global shape functions and volume elements at the gauss points
+	globalShapeFunctions( ) ;
 
     //printf("volume = %f\n", volume);
 
@@ -992,11 +982,9 @@ const Vector&  Twenty_Node_Brick::getResistingForce( )
 
 	int i, j, jk, k, k1;
 
-	double xsj;
 
 	static Matrix B(6, 3);
 
-	double volume = 0.;
 
 
 
@@ -1006,25 +994,8 @@ const Vector&  Twenty_Node_Brick::getResistingForce( )
 
 
 
-	//compute basis vectors and local nodal coordinates
-
-	computeBasis( ) ;
-
-	//gauss loop to compute and save shape functions
-
-	for( i = 0; i < nintu; i++ ) {
-
-		// compute Jacobian and global shape functions
-
-		Jacobian3d(i, xsj, 0);
-
-		//volume element to also be saved
-
-		dvolu[i] = wu[i] * xsj ;
-
-		volume += dvolu[i];
-
-	} // end for i
+	// global shape functions and volume elements at the gauss points
+	globalShapeFunctions( ) ;
 
 	//printf("volume = %f\n", volume);
 
@@ -1293,7 +1264,6 @@ void   Twenty_Node_Brick::formInertiaTerms( int tangFlag )
 
 {
 
-	static double xsj ;  // determinant jacaobian matrix
 
 	int i, j, k, ik, m, jk;
 
@@ -1307,23 +1277,8 @@ void   Twenty_Node_Brick::formInertiaTerms( int tangFlag )
 
 
 
-	//compute basis vectors and local nodal coordinates
-
-	computeBasis( ) ;
-
-	//gauss loop to compute and save shape functions
-
-	for( i = 0; i < nintu; i++ ) {
-
-		// compute Jacobian and global shape functions
-
-		Jacobian3d(i, xsj, 0);
-
-		//volume element to also be saved
-
-		dvolu[i] = wu[i] * xsj ;
-
-	} // end for i
+	// global shape functions and volume elements at the gauss points
+	globalShapeFunctions( ) ;
 
 
 
@@ -1385,6 +1340,34 @@ double Twenty_Node_Brick::mixtureRho(int i)
 
 
 
+void Twenty_Node_Brick::globalShapeFunctions( )
+{
+	// geometrically linear, so reuse what was computed in setDomain
+	if (shgCache != 0) {
+		double *shg = &shgu[0][0][0];
+		for (int i = 0; i < 4*20*27; i++)
+			shg[i] = shgCache[i];
+		for (int i = 0; i < 27; i++)
+			dvolu[i] = shgCache[4*20*27+i];
+		ShapeFunctionCache::recordHit();
+		return;
+	}
+
+	static double xsj;
+
+	//compute basis vectors and local nodal coordinates
+	computeBasis( ) ;
+
+	for (int i = 0; i < nintu; i++ ) {
+		// compute Jacobian and global shape functions
+		Jacobian3d(i, xsj, 0);
+		//volume element to also be saved
+		dvolu[i] = wu[i] * xsj ;
+	} // end for i
+}
+
+
+
 void   Twenty_Node_Brick::computeBasis( )
 
 {
@@ -172,8 +172,12 @@ private :
     //compute coordinate system
     void computeBasis( ) ;
 
+    //global shape functions (shgu) and volume elements (dvolu)
+    void globalShapeFunctions( ) ;
+
     Vector *load;
     Matrix *Ki;
+    double *shgCache; // shgu and dvolu for this element, 0 if not cached
 
 	// compute local shape functions
 	void compuLocalShapeFunction();
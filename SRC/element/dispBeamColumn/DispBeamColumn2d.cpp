@@ -985,6 +985,21 @@ DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
     return 0;
 }
 
+bool
+DispBeamColumn2d::hasConstantMass(void)
+{
+  // the consistent mass matrix follows the coordinate transformation
+  return cMass == 0;
+}
+
+int
+DispBeamColumn2d::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  Q.addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 const Vector&
 DispBeamColumn2d::getResistingForce()
 {
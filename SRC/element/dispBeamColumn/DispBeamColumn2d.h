@@ -83,6 +83,8 @@ class DispBeamColumn2d : public Element
     void zeroLoad();
     int addLoad(ElementalLoad *theLoad, double loadFactor);
     int addInertiaLoadToUnbalance(const Vector &accel);
+    bool hasConstantMass(void);
+    int addEffectiveInertiaLoad(const Vector &effLoad, double fact);
 
     const Vector &getResistingForce(void);
     const Vector &getDampingForce(void);
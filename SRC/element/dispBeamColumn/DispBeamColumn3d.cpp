@@ -1048,6 +1048,21 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+DispBeamColumn3d::hasConstantMass(void)
+{
+  // the consistent mass matrix follows the coordinate transformation
+  return cMass == 0;
+}
+
+int
+DispBeamColumn3d::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  Q.addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 const Vector&
 DispBeamColumn3d::getResistingForce()
 {
@@ -983,6 +983,21 @@ ElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+ElasticBeam2d::hasConstantMass(void)
+{
+  // the consistent mass matrix follows the coordinate transformation
+  return cMass == 0;
+}
+
+int
+ElasticBeam2d::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  Q.addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 const Vector &
 ElasticBeam2d::getResistingForceIncInertia()
 {	
@@ -1043,6 +1043,21 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+ElasticBeam3d::hasConstantMass(void)
+{
+  // the consistent mass matrix follows the coordinate transformation
+  return cMass == 0;
+}
+
+int
+ElasticBeam3d::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  Q.addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 
 
 const Vector &
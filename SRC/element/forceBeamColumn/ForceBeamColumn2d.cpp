@@ -1998,6 +1998,20 @@ ForceBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+ForceBeamColumn2d::hasConstantMass(void)
+{
+  return true;
+}
+
+int
+ForceBeamColumn2d::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  load.addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 const Vector &
 ForceBeamColumn2d::getResistingForceIncInertia()
 {	
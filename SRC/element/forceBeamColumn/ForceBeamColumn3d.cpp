@@ -1908,6 +1908,20 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
     return 0;
   }
 
+  bool
+  ForceBeamColumn3d::hasConstantMass(void)
+  {
+    return true;
+  }
+
+  int
+  ForceBeamColumn3d::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+  {
+    load.addVector(1.0, effLoad, fact);
+
+    return 0;
+  }
+
   const Vector &
   ForceBeamColumn3d::getResistingForceIncInertia()
   {	
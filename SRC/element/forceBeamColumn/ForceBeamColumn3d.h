@@ -110,6 +110,8 @@ class ForceBeamColumn3d: public Element
   void zeroLoad(void);	
   int addLoad(ElementalLoad *theLoad, double loadFactor);
   int addInertiaLoadToUnbalance(const Vector &accel);
+  bool hasConstantMass(void);
+  int addEffectiveInertiaLoad(const Vector &effLoad, double fact);
   
   const Vector &getResistingForce(void);
   const Vector &getDampingForce(void);
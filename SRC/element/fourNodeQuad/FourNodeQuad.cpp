@@ -29,6 +29,8 @@
 // Description: This file contains the class definition for FourNodeQuad.
 
 #include <FourNodeQuad.h>
+#include <SolidKernels.h>
+#include <ShapeFunctionCache.h>
 #include <Node.h>
 #include <NDMaterial.h>
 #include <Matrix.h>
@@ -293,7 +295,8 @@ FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
          Damping *damping)
 :Element (tag, ELE_TAG_FourNodeQuad), 
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), Ki(0)
+ Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), Ki(0), shpCache(0),
+ initDisp(0)
 {
 	pts[0][0] = -0.5773502691896258;
 	pts[0][1] = -0.5773502691896258;
@@ -370,7 +373,8 @@ FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
 FourNodeQuad::FourNodeQuad()
 :Element (0,ELE_TAG_FourNodeQuad),
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), Ki(0)
+ Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), Ki(0), shpCache(0),
+ initDisp(0)
 {
   pts[0][0] = -0.577350269189626;
   pts[0][1] = -0.577350269189626;
@@ -415,6 +419,11 @@ FourNodeQuad::~FourNodeQuad()
 
   if (Ki != 0)
     delete Ki;
+
+  if (initDisp != 0)
+    delete [] initDisp;
+
+  ShapeFunctionCache::release(shpCache, 4*13);
 }
 
 int
@@ -451,6 +460,8 @@ FourNodeQuad::setDomain(Domain *theDomain)
 	theNodes[1] = 0;
 	theNodes[2] = 0;
 	theNodes[3] = 0;
+	ShapeFunctionCache::release(shpCache, 4*13);
+	shpCache = 0;
 	return;
     }
 
@@ -484,6 +495,21 @@ FourNodeQuad::setDomain(Domain *theDomain)
     }
     this->DomainComponent::setDomain(theDomain);
 
+    // Shape functions never change for this element, cache them if allowed
+    ShapeFunctionCache::release(shpCache, 4*13);
+    shpCache = 0;
+    double *theCache = ShapeFunctionCache::allocate(4*13);
+    if (theCache != 0) {
+      for (int i = 0; i < 4; i++) {
+	double *cacheI = &theCache[13*i];
+	cacheI[12] = this->shapeFunction(pts[i][0], pts[i][1]);
+	for (int j = 0; j < 3; j++)
+	  for (int k = 0; k < 4; k++)
+	    cacheI[4*j+k] = shp[j][k];
+      }
+      shpCache = theCache;
+    }
+
     // Compute consistent nodal loads due to pressure
     this->setPressureLoadAtNodes();
     
@@ -591,6 +617,13 @@ FourNodeQuad::update()
 	u[0][3] = disp4(0);
 	u[1][3] = disp4(1);
 
+	// strains are measured from the displacements at activation
+	if (initDisp != 0)
+	  for (int i = 0; i < 4; i++) {
+	    u[0][i] -= initDisp[2*i];
+	    u[1][i] -= initDisp[2*i+1];
+	  }
+
 	static Vector eps(3);
 
 	int ret = 0;
@@ -599,7 +632,7 @@ FourNodeQuad::update()
 	for (int i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		this->shapeFunction(pts[i][0], pts[i][1]);
+		this->shapeFunction(i);
 
 		// Interpolate strains
 		//eps = B*u;
@@ -618,6 +651,29 @@ FourNodeQuad::update()
 	return ret;
 }
 
+void
+FourNodeQuad::onActivate(void)
+{
+  // the element is activated stress free in the current configuration
+  if (theNodes[0] == 0)
+    return;
+
+  if (initDisp == 0)
+    initDisp = new double[8];
+
+  for (int i = 0; i < 4; i++) {
+    const Vector &disp = theNodes[i]->getTrialDisp();
+    initDisp[2*i] = disp(0);
+    initDisp[2*i+1] = disp(1);
+  }
+}
+
+void
+FourNodeQuad::onDeactivate(void)
+{
+
+}
+
 
 const Matrix&
 FourNodeQuad::getTangentStiff()
@@ -627,13 +683,12 @@ FourNodeQuad::getTangentStiff()
 	K.Zero();
 
 	double dvol;
-	double DB[3][2];
 
 	// Loop over the integration points
 	for (int i = 0; i < 4; i++) {
 
 	  // Determine Jacobian for this integration point
-	  dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+	  dvol = this->shapeFunction(i);
 	  dvol *= (thickness*wts[i]);
 	  
 	  // Get the material tangent
@@ -642,38 +697,7 @@ FourNodeQuad::getTangentStiff()
 	  
 	  // Perform numerical integration
 	  //K = K + (B^ D * B) * intWt(i)*intWt(j) * detJ;
-	  //K.addMatrixTripleProduct(1.0, B, D, intWt(i)*intWt(j)*detJ);
-	  
-	  double D00 = D(0,0); double D01 = D(0,1); double D02 = D(0,2);
-	  double D10 = D(1,0); double D11 = D(1,1); double D12 = D(1,2);
-	  double D20 = D(2,0); double D21 = D(2,1); double D22 = D(2,2);
-
-	  //	  for (int beta = 0, ib = 0, colIb =0, colIbP1 = 8; 
-	  //   beta < 4; 
-	  //   beta++, ib += 2, colIb += 16, colIbP1 += 16) {
-	    
-	  for (int alpha = 0, ia = 0; alpha < 4; alpha++, ia += 2) {
-	    for (int beta = 0, ib = 0; beta < 4; beta++, ib += 2) {
-	      
-	      DB[0][0] = dvol * (D00 * shp[0][beta] + D02 * shp[1][beta]);
-	      DB[1][0] = dvol * (D10 * shp[0][beta] + D12 * shp[1][beta]);
-	      DB[2][0] = dvol * (D20 * shp[0][beta] + D22 * shp[1][beta]);
-	      DB[0][1] = dvol * (D01 * shp[1][beta] + D02 * shp[0][beta]);
-	      DB[1][1] = dvol * (D11 * shp[1][beta] + D12 * shp[0][beta]);
-	      DB[2][1] = dvol * (D21 * shp[1][beta] + D22 * shp[0][beta]);
-	      
-
-	      K(ia,ib) += shp[0][alpha]*DB[0][0] + shp[1][alpha]*DB[2][0];
-	      K(ia,ib+1) += shp[0][alpha]*DB[0][1] + shp[1][alpha]*DB[2][1];
-	      K(ia+1,ib) += shp[1][alpha]*DB[1][0] + shp[0][alpha]*DB[2][0];
-	      K(ia+1,ib+1) += shp[1][alpha]*DB[1][1] + shp[0][alpha]*DB[2][1];
-	      //	      matrixData[colIb   +   ia] += shp[0][alpha]*DB[0][0] + shp[1][alpha]*DB[2][0];
-	      //matrixData[colIbP1 +   ia] += shp[0][alpha]*DB[0][1] + shp[1][alpha]*DB[2][1];
-	      //matrixData[colIb   + ia+1] += shp[1][alpha]*DB[1][0] + shp[0][alpha]*DB[2][0];
-	      //matrixData[colIbP1 + ia+1] += shp[1][alpha]*DB[1][1] + shp[0][alpha]*DB[2][1];
-	      
-	    }
-	  }
+	  SolidKernels<4,2>::addBTDB(shp, D, dvol, matrixData);
 	}
 	
 	return K;
@@ -690,45 +714,21 @@ FourNodeQuad::getInitialStiff()
   K.Zero();
   
   double dvol;
-  double DB[3][2];
   
   // Loop over the integration points
   for (int i = 0; i < 4; i++) {
     
     // Determine Jacobian for this integration point
-    dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+    dvol = this->shapeFunction(i);
     dvol *= (thickness*wts[i]);
     
     // Get the material tangent
     D = theMaterial[i]->getInitialTangent();
     if(theDamping[i]) D *= theDamping[i]->getStiffnessMultiplier();
 
-    double D00 = D(0,0); double D01 = D(0,1); double D02 = D(0,2);
-    double D10 = D(1,0); double D11 = D(1,1); double D12 = D(1,2);
-    double D20 = D(2,0); double D21 = D(2,1); double D22 = D(2,2);
-    
     // Perform numerical integration
     //K = K + (B^ D * B) * intWt(i)*intWt(j) * detJ;
-    //K.addMatrixTripleProduct(1.0, B, D, intWt(i)*intWt(j)*detJ);
-    for (int beta = 0, ib = 0, colIb =0, colIbP1 = 8; 
-	 beta < 4; 
-	 beta++, ib += 2, colIb += 16, colIbP1 += 16) {
-      
-      for (int alpha = 0, ia = 0; alpha < 4; alpha++, ia += 2) {
-	
-	DB[0][0] = dvol * (D00 * shp[0][beta] + D02 * shp[1][beta]);
-	DB[1][0] = dvol * (D10 * shp[0][beta] + D12 * shp[1][beta]);
-	DB[2][0] = dvol * (D20 * shp[0][beta] + D22 * shp[1][beta]);
-	DB[0][1] = dvol * (D01 * shp[1][beta] + D02 * shp[0][beta]);
-	DB[1][1] = dvol * (D11 * shp[1][beta] + D12 * shp[0][beta]);
-	DB[2][1] = dvol * (D21 * shp[1][beta] + D22 * shp[0][beta]);
-	
-	matrixData[colIb   +   ia] += shp[0][alpha]*DB[0][0] + shp[1][alpha]*DB[2][0];
-	matrixData[colIbP1 +   ia] += shp[0][alpha]*DB[0][1] + shp[1][alpha]*DB[2][1];
-	matrixData[colIb   + ia+1] += shp[1][alpha]*DB[1][0] + shp[0][alpha]*DB[2][0];
-	matrixData[colIbP1 + ia+1] += shp[1][alpha]*DB[1][1] + shp[0][alpha]*DB[2][1];
-      }
-    }
+    SolidKernels<4,2>::addBTDB(shp, D, dvol, matrixData);
   }
 
   Ki = new Matrix(K);
@@ -760,7 +760,7 @@ FourNodeQuad::getMass()
 	for (i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		rhodvol = this->shapeFunction(pts[i][0], pts[i][1]);
+		rhodvol = this->shapeFunction(i);
 
 		// Element plus material density ... MAY WANT TO REMOVE ELEMENT DENSITY
 		rhodvol *= (rhoi[i]*thickness*wts[i]);
@@ -809,6 +809,43 @@ FourNodeQuad::addLoad(ElementalLoad *theLoad, double loadFactor)
 	return -1;
 }
 
+int
+FourNodeQuad::getEquivalentLoad(ElementalLoad *theLoad, Vector &P)
+{
+  int type;
+  const Vector &data = theLoad->getData(type, 1.0);
+
+  if (type != LOAD_TAG_SelfWeight)
+    return -1;
+
+  double bLoad0 = data(0)*b[0];
+  double bLoad1 = data(1)*b[1];
+
+  // the body force getResistingForce() subtracts for appliedB = bLoad
+  P.Zero();
+  for (int i = 0; i < 4; i++) {
+    double dvol = this->shapeFunction(i);
+    dvol *= (thickness*wts[i]);
+
+    for (int alpha = 0, ia = 0; alpha < 4; alpha++, ia += 2) {
+      P(ia) += dvol*(shp[2][alpha]*bLoad0);
+      P(ia+1) += dvol*(shp[2][alpha]*bLoad1);
+    }
+  }
+
+  return 0;
+}
+
+int
+FourNodeQuad::addEquivalentLoad(const Vector &P, double fact)
+{
+  // the body force is in Q, keep b out of the resisting force
+  applyLoad = 1;
+  Q.addVector(1.0, P, fact);
+
+  return 0;
+}
+
 int 
 FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
@@ -860,6 +897,20 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+FourNodeQuad::hasConstantMass(void)
+{
+  return true;
+}
+
+int
+FourNodeQuad::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  Q.addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 const Vector&
 FourNodeQuad::getResistingForce()
 {
@@ -872,7 +923,7 @@ FourNodeQuad::getResistingForce()
 	for (int i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+		dvol = this->shapeFunction(i);
 		dvol *= (thickness*wts[i]);
 
 		// Get material stress response
@@ -989,7 +1040,7 @@ FourNodeQuad::sendSelf(int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(11);
+  static Vector data(20);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = b[0];
@@ -1015,6 +1066,11 @@ FourNodeQuad::sendSelf(int commitTag, Channel &theChannel)
     data(10) = dbTag;
   }
 
+  // the nodal displacements at activation, if it has been activated
+  data(11) = (initDisp != 0) ? 1.0 : 0.0;
+  for (int i = 0; i < 8; i++)
+    data(12+i) = (initDisp != 0) ? initDisp[i] : 0.0;
+
   res += theChannel.sendVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuad::sendSelf() - " << this->getTag() << " failed to send Vector\n";
@@ -1085,7 +1141,7 @@ FourNodeQuad::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(11);
+  static Vector data(20);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuad::recvSelf() - failed to receive Vector\n";
@@ -1103,6 +1159,16 @@ FourNodeQuad::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(7);
   betaKc = data(8);
 
+  if (data(11) != 0.0) {
+    if (initDisp == 0)
+      initDisp = new double[8];
+    for (int i = 0; i < 8; i++)
+      initDisp[i] = data(12+i);
+  } else if (initDisp != 0) {
+    delete [] initDisp;
+    initDisp = 0;
+  }
+
   static ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
@@ -1635,6 +1701,21 @@ FourNodeQuad::updateParameter(int parameterID, Information &info)
   }
 }
 
+double FourNodeQuad::shapeFunction(int ip)
+{
+  // Geometrically linear element, so reuse what was computed in setDomain
+  if (shpCache != 0) {
+    const double *cacheI = &shpCache[13*ip];
+    for (int j = 0; j < 3; j++)
+      for (int k = 0; k < 4; k++)
+	shp[j][k] = cacheI[4*j+k];
+    ShapeFunctionCache::recordHit();
+    return cacheI[12];
+  }
+
+  return this->shapeFunction(pts[ip][0], pts[ip][1]);
+}
+
 double FourNodeQuad::shapeFunction(double xi, double eta)
 {
 	const Vector &nd1Crds = theNodes[0]->getCrds();
@@ -72,6 +72,8 @@ class FourNodeQuad : public Element
     int revertToLastCommit(void);
     int revertToStart(void);
     int update(void);
+    void onActivate(void);
+    void onDeactivate(void);
 
     // public methods to obtain stiffness, mass, damping and residual information    
     const Matrix &getTangentStiff(void);
@@ -80,7 +82,11 @@ class FourNodeQuad : public Element
 
     void zeroLoad();
     int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int getEquivalentLoad(ElementalLoad *theLoad, Vector &P);
+    int addEquivalentLoad(const Vector &P, double fact);
     int addInertiaLoadToUnbalance(const Vector &accel);
+    bool hasConstantMass(void);
+    int addEffectiveInertiaLoad(const Vector &effLoad, double fact);
 
     const Vector &getResistingForce(void);
     const Vector &getResistingForceIncInertia(void);            
@@ -138,10 +144,14 @@ class FourNodeQuad : public Element
 
     // private member functions - only objects of this class can call these
     double shapeFunction(double xi, double eta);
+    double shapeFunction(int ip); // at quadrature point ip, cached if possible
     void setPressureLoadAtNodes(void);
 
     Matrix *Ki;
     Damping *theDamping[4];
+
+    double *shpCache;  // shp and detJ at the quadrature points, 0 if not cached
+    double *initDisp;  // nodal displacements at activation, 0 if never activated
 };
 
 #endif
@@ -36,6 +36,9 @@
 #include <ElementResponse.h>
 #include <TCP_Socket.h>
 #include <UDP_Socket.h>
+#ifndef _WIN32
+    #include <SharedMemoryChannel.h>
+#endif
 #ifdef SSL
     #include <TCP_SocketSSL.h>
 #endif
@@ -51,7 +54,7 @@ void* OPS_GenericClient()
     int ndf = OPS_GetNDF();
     if (OPS_GetNumRemainingInputArgs() < 7) {
         opserr << "WARNING insufficient arguments\n";
-        opserr << "Want: element genericClient eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -server ipPort <ipAddr> <-ssl> <-udp> <-dataSize size> <-noRayleigh>\n";
+        opserr << "Want: element genericClient eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -server ipPort <ipAddr> <-ssl> <-udp> <-shm> <-dataSize size> <-noRayleigh> <-pipeline>\n";
         return 0;
     }
     
@@ -136,26 +139,32 @@ void* OPS_GenericClient()
     // options
     char* ipAddr = new char[10];
     strcpy(ipAddr, "127.0.0.1");
-    int ssl = 0, udp = 0;
+    int ssl = 0, udp = 0, shm = 0;
     int dataSize = 256;
     int doRayleigh = 1;
+    int pipeline = 0;
     
     while (OPS_GetNumRemainingInputArgs() > 0) {
         type = OPS_GetString();
         if (strcmp(type, "-ssl") != 0 &&
             strcmp(type, "-udp") != 0 &&
+            strcmp(type, "-shm") != 0 &&
             strcmp(type, "-dataSize") != 0 &&
             strcmp(type, "-noRayleigh") != 0 &&
-            strcmp(type, "-doRayleigh") != 0) {
+            strcmp(type, "-doRayleigh") != 0 &&
+            strcmp(type, "-pipeline") != 0) {
             delete[] ipAddr;
             ipAddr = new char[strlen(type) + 1];
             strcpy(ipAddr, type);
         }
         else if (strcmp(type, "-ssl") == 0) {
-            ssl = 1; udp = 0;
+            ssl = 1; udp = 0; shm = 0;
         }
         else if (strcmp(type, "-udp") == 0) {
-            udp = 1; ssl = 0;
+            udp = 1; ssl = 0; shm = 0;
+        }
+        else if (strcmp(type, "-shm") == 0) {
+            shm = 1; ssl = 0; udp = 0;
         }
         else if (strcmp(type, "-dataSize") == 0) {
             if (OPS_GetNumRemainingInputArgs() < 1) {
@@ -174,11 +183,14 @@ void* OPS_GenericClient()
         else if (strcmp(type, "-noRayleigh") == 0) {
             doRayleigh = 0;
         }
+        else if (strcmp(type, "-pipeline") == 0) {
+            pipeline = 1;
+        }
     }
     
     // create object
     Element *theEle = new GenericClient(tag, nodes, dofs, ipPort,
-        ipAddr, ssl, udp, dataSize, doRayleigh);
+        ipAddr, ssl, udp, dataSize, doRayleigh, shm, pipeline);
     
     // cleanup dynamic memory
     if (dofs != 0)
@@ -192,14 +204,17 @@ void* OPS_GenericClient()
 // responsible for allocating the necessary space needed
 // by each object and storing the tags of the end nodes.
 GenericClient::GenericClient(int tag, ID nodes, ID *dof, int _port,
-    char *machineinetaddr, int _ssl, int _udp, int datasize, int addRay)
+    char *machineinetaddr, int _ssl, int _udp, int datasize, int addRay,
+    int _shm, int _pipeline)
     : Element(tag, ELE_TAG_GenericClient),
     connectedExternalNodes(nodes), basicDOF(1), numExternalNodes(0),
     numDOF(0), numBasicDOF(0), port(_port), machineInetAddr(0), ssl(_ssl),
-    udp(_udp), dataSize(datasize), addRayleigh(addRay), theMatrix(1,1),
+    udp(_udp), shm(_shm), dataSize(datasize), addRayleigh(addRay),
+    pipeline(_pipeline), theMatrix(1,1),
     theVector(1), theLoad(1), theInitStiff(1,1), theMass(1,1),
     theChannel(0), sData(0), sendData(0), rData(0), recvData(0),
     db(0), vb(0), ab(0), t(0), qDaq(0), rMatrix(0),
+    forcePending(false), forceSaved(false), qSaved(1),
     dbCtrl(1), vbCtrl(1), abCtrl(1),
     initStiffFlag(false), massFlag(false)
 {
@@ -252,10 +267,12 @@ GenericClient::GenericClient()
     : Element(0, ELE_TAG_GenericClient),
     connectedExternalNodes(1), basicDOF(1), numExternalNodes(0),
     numDOF(0), numBasicDOF(0), port(0), machineInetAddr(0), ssl(0),
-    udp(0), dataSize(0), addRayleigh(0), theMatrix(1,1),
+    udp(0), shm(0), dataSize(0), addRayleigh(0),
+    pipeline(0), theMatrix(1,1),
     theVector(1), theLoad(1), theInitStiff(1,1), theMass(1,1),
     theChannel(0), sData(0), sendData(0), rData(0), recvData(0),
     db(0), vb(0), ab(0), t(0), qDaq(0), rMatrix(0),
+    forcePending(false), forceSaved(false), qSaved(1),
     dbCtrl(1), vbCtrl(1), abCtrl(1),
     initStiffFlag(false), massFlag(false)
 {
@@ -270,6 +287,7 @@ GenericClient::~GenericClient()
 {
     // terminate remote process
     if (theChannel != 0)  {
+        this->recvPendingForce();
         sData[0] = RemoteTest_DIE;
         theChannel->sendVector(0, 0, *sendData, 0);
     }
@@ -397,6 +415,7 @@ int GenericClient::commitState()
     int rValue = 0;
     
     // commit remote element
+    this->recvPendingForce();
     sData[0] = RemoteTest_commitState;
     rValue += theChannel->sendVector(0, 0, *sendData, 0);
     
@@ -461,10 +480,22 @@ int GenericClient::update()
         ndim += theDOF[i].Size();
     }
     
+    // forces of the last trial response are no longer needed
+    this->recvPendingForce();
+    forceSaved = false;
+    
     // set trial response at remote element
     sData[0] = RemoteTest_setTrialResponse;
     rValue += theChannel->sendVector(0, 0, *sendData, 0);
     
+    // request the resisting forces now, they are received
+    // in getResistingForce
+    if (pipeline)  {
+        sData[0] = RemoteTest_getForce;
+        rValue += theChannel->sendVector(0, 0, *sendData, 0);
+        forcePending = true;
+    }
+    
     return rValue;
 }
 
@@ -476,6 +507,7 @@ const Matrix& GenericClient::getTangentStiff()
     rMatrix->Zero();
     
     // get tangent stiffness from remote element
+    this->recvPendingForce();
     sData[0] = RemoteTest_getTangentStiff;
     theChannel->sendVector(0, 0, *sendData, 0);
     theChannel->recvVector(0, 0, *recvData, 0);
@@ -493,6 +525,7 @@ const Matrix& GenericClient::getInitialStiff()
         rMatrix->Zero();
         
         // get initial stiffness from remote element
+        this->recvPendingForce();
         sData[0] = RemoteTest_getInitialStiff;
         theChannel->sendVector(0, 0, *sendData, 0);
         theChannel->recvVector(0, 0, *recvData, 0);
@@ -517,6 +550,7 @@ const Matrix& GenericClient::getDamp()
     }
     
     // now add damping from remote element
+    this->recvPendingForce();
     sData[0] = RemoteTest_getDamp;
     theChannel->sendVector(0, 0, *sendData, 0);
     theChannel->recvVector(0, 0, *recvData, 0);
@@ -534,6 +568,7 @@ const Matrix& GenericClient::getMass()
         rMatrix->Zero();
         
         // get mass matrix from remote element
+        this->recvPendingForce();
         sData[0] = RemoteTest_getMass;
         theChannel->sendVector(0, 0, *sendData, 0);
         theChannel->recvVector(0, 0, *recvData, 0);
@@ -589,9 +624,17 @@ const Vector& GenericClient::getResistingForce()
     theVector.Zero();
     
     // get resisting forces from remote element
-    sData[0] = RemoteTest_getForce;
-    theChannel->sendVector(0, 0, *sendData, 0);
-    theChannel->recvVector(0, 0, *recvData, 0);
+    if (forcePending)  {
+        theChannel->recvVector(0, 0, *recvData, 0);
+        forcePending = false;
+    } else if (forceSaved)  {
+        *qDaq = qSaved;
+    } else  {
+        sData[0] = RemoteTest_getForce;
+        theChannel->sendVector(0, 0, *sendData, 0);
+        theChannel->recvVector(0, 0, *recvData, 0);
+    }
+    forceSaved = false;
     
     // save corresponding ctrl response for recorder
     dbCtrl = (*db);
@@ -684,7 +727,7 @@ const Vector& GenericClient::getBasicAccel()
 int GenericClient::sendSelf(int commitTag, Channel &sChannel)
 {
     // send element parameters
-    static Vector data(12);
+    static Vector data(14);
     data(0) = this->getTag();
     data(1) = numExternalNodes;
     data(2) = port;
@@ -697,6 +740,8 @@ int GenericClient::sendSelf(int commitTag, Channel &sChannel)
     data(9) = betaK;
     data(10) = betaK0;
     data(11) = betaKc;
+    data(12) = shm;
+    data(13) = pipeline;
     sChannel.sendVector(0, commitTag, data);
     
     // send the end nodes and dofs
@@ -724,7 +769,7 @@ int GenericClient::recvSelf(int commitTag, Channel &rChannel,
         delete[] machineInetAddr;
     
     // receive element parameters
-    static Vector data(12);
+    static Vector data(14);
     rChannel.recvVector(0, commitTag, data);
     this->setTag((int)data(0));
     numExternalNodes = (int)data(1);
@@ -738,6 +783,8 @@ int GenericClient::recvSelf(int commitTag, Channel &rChannel,
     betaK = data(9);
     betaK0 = data(10);
     betaKc = data(11);
+    shm = (int)data(12);
+    pipeline = (int)data(13);
     
     // initialize nodes and receive them
     connectedExternalNodes.resize(numExternalNodes);
@@ -1029,6 +1076,14 @@ int GenericClient::setupConnection()
         else
             theChannel = new TCP_SocketSSL(port, machineInetAddr);
     }
+#endif
+#ifndef _WIN32
+    else if (shm)  {
+        if (machineInetAddr == 0)
+            theChannel = new SharedMemoryChannel(port, "127.0.0.1");
+        else
+            theChannel = new SharedMemoryChannel(port, machineInetAddr);
+    }
 #endif
     else  {
         if (machineInetAddr == 0)
@@ -1087,5 +1142,24 @@ int GenericClient::setupConnection()
     // allocate memory for the receive matrix
     rMatrix = new Matrix(rData, numBasicDOF, numBasicDOF);
     
+    qSaved.resize(numBasicDOF);
+    
     return 0;
 }
+
+
+int GenericClient::recvPendingForce()
+{
+    // the response to a force request sent in update has to be
+    // received before any other request is sent, keep the forces
+    // as the receive data array is shared with the matrices
+    if (!forcePending)
+        return 0;
+    
+    int rValue = theChannel->recvVector(0, 0, *recvData, 0);
+    qSaved = *qDaq;
+    forcePending = false;
+    forceSaved = true;
+    
+    return rValue;
+}
@@ -29,6 +29,10 @@
 // GenericClient is a generic element defined by any number of nodes and 
 // the degrees of freedom at those nodes. The element communicates with 
 // OpenFresco through a tcp/ip connection.
+// With pipelining turned on, update() sends the force request right
+// after the trial response, so that all remote sites of a model work on
+// the trial step at the same time; getResistingForce() then only
+// receives the forces.
 
 #include <Element.h>
 #include <Matrix.h>
@@ -60,7 +64,7 @@ public:
     GenericClient(int tag, ID nodes, ID *dof,
           int port, char *machineInetAddr = 0,
           int ssl = 0, int udp = 0, int dataSize = 256,
-          int addRayleigh = 1);
+          int addRayleigh = 1, int shm = 0, int pipeline = 0);
     GenericClient();
     
     // destructor
@@ -129,8 +133,10 @@ private:
     char *machineInetAddr;      // ipAddress
     int ssl;                    // secure socket layer flag
     int udp;                    // udp socket flag
+    int shm;                    // shared memory channel flag
     int dataSize;               // data size of send/recv vectors
     int addRayleigh;            // flag to add Rayleigh damping
+    int pipeline;               // flag to request forces in update
     
     Matrix theMatrix;           // objects matrix
     Vector theVector;           // objects vector
@@ -152,6 +158,10 @@ private:
     Vector *qDaq;               // daq forces in basic system
     Matrix *rMatrix;            // receive matrix
     
+    bool forcePending;          // force request sent, not yet received
+    bool forceSaved;            // force received early and kept in qSaved
+    Vector qSaved;              // daq forces received ahead of use
+    
     Vector dbCtrl;              // ctrl displacements in basic system
     Vector vbCtrl;              // ctrl velocities in basic system
     Vector abCtrl;              // ctrl accelerations in basic system
@@ -162,6 +172,7 @@ private:
     Node **theNodes;
     
     int setupConnection();
+    int recvPendingForce();
 };
 
 #endif
@@ -54,7 +54,7 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
     if ((argc-eleArgStart) < 8)  {
         opserr << "WARNING insufficient arguments\n";
         printCommand(argc, argv);
-        opserr << "Want: element genericClient eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -server ipPort <ipAddr> <-ssl> <-udp> <-dataSize size> <-noRayleigh>\n";
+        opserr << "Want: element genericClient eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -server ipPort <ipAddr> <-ssl> <-udp> <-shm> <-dataSize size> <-noRayleigh> <-pipeline>\n";
         return TCL_ERROR;
     }
     
@@ -65,9 +65,10 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
     int tag, node, dof, ipPort, argi, i, j;
     int numNodes = 0, numDOFj = 0, numDOF = 0;
     char *ipAddr = 0;
-    int ssl = 0, udp = 0;
+    int ssl = 0, udp = 0, shm = 0;
     int dataSize = 256;
     int doRayleigh = 1;
+    int pipeline = 0;
     
     if (Tcl_GetInt(interp, argv[1+eleArgStart], &tag) != TCL_OK)  {
         opserr << "WARNING invalid genericClient eleTag\n";
@@ -151,9 +152,11 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
         if (argi < argc &&
             strcmp(argv[argi], "-doRayleigh") != 0 &&
             strcmp(argv[argi], "-noRayleigh") != 0 &&
+            strcmp(argv[argi], "-pipeline") != 0 &&
             strcmp(argv[argi], "-dataSize") != 0 &&
             strcmp(argv[argi], "-ssl") != 0 &&
-            strcmp(argv[argi], "-udp") != 0)  {
+            strcmp(argv[argi], "-udp") != 0 &&
+            strcmp(argv[argi], "-shm") != 0)  {
                 ipAddr = new char [strlen(argv[argi])+1];
                 strcpy(ipAddr,argv[argi]);
                 argi++;
@@ -164,10 +167,13 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
         }
         for (i = argi; i < argc; i++)  {
             if (strcmp(argv[i], "-ssl") == 0)  {
-                ssl = 1; udp = 0;
+                ssl = 1; udp = 0; shm = 0;
             }
             else if (strcmp(argv[i], "-udp") == 0)  {
-                udp = 1; ssl = 0;
+                udp = 1; ssl = 0; shm = 0;
+            }
+            else if (strcmp(argv[i], "-shm") == 0)  {
+                shm = 1; ssl = 0; udp = 0;
             }
             else if (strcmp(argv[i], "-dataSize") == 0)  {
                 if (Tcl_GetInt(interp, argv[i+1], &dataSize) != TCL_OK)  {
@@ -189,12 +195,14 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
             doRayleigh = 1;
         } else if (strcmp(argv[i], "-noRayleigh") == 0)  {
             doRayleigh = 0;
+        } else if (strcmp(argv[i], "-pipeline") == 0)  {
+            pipeline = 1;
         }
     }
     
     // now create the GenericClient
     theElement = new GenericClient(tag, nodes, dofs, ipPort, ipAddr,
-        ssl, udp, dataSize, doRayleigh);
+        ssl, udp, dataSize, doRayleigh, shm, pipeline);
     
     // cleanup dynamic memory
     if (dofs != 0)
@@ -1134,6 +1134,54 @@ ShellMITC4::addLoad(ElementalLoad *theLoad, double loadFactor)
   }
 }
 
+int
+ShellMITC4::getEquivalentLoad(ElementalLoad *theLoad, Vector &P)
+{
+  // with an updated basis the self weight follows the nodes
+  if (doUpdateBasis == true)
+    return -1;
+
+  int type;
+  const Vector &data = theLoad->getData(type, 1.0);
+
+  if (type != LOAD_TAG_SelfWeight)
+    return -1;
+
+  static const int numberGauss = 4 ;
+  static const int numberNodes = 4 ;
+  static const int ndf = 6 ;
+  static double shp[3][4] ;
+  double xsj ;
+
+  // minus the self weight formResidAndTangent() adds for appliedB = data
+  P.Zero();
+  for (int i = 0; i < numberGauss; i++) {
+    shape2d( sg[i], tg[i], xl, shp, xsj ) ;
+
+    double ddvol = wg[i] * xsj ;
+    double rhoH = materialPointers[i]->getRho() ;
+
+    for (int j = 0; j < numberNodes; j++) {
+      double temp = shp[2][j] * ddvol ;
+      for (int p = 0; p < 3; p++)
+	P( j*ndf+p ) -= temp * rhoH * data(p) ;
+    }
+  }
+
+  return 0;
+}
+
+int
+ShellMITC4::addEquivalentLoad(const Vector &P, double fact)
+{
+  if (load == 0)
+    load = new Vector(24);
+
+  load->addVector(1.0, P, fact);
+
+  return 0;
+}
+
 
 
 int 
@@ -1170,6 +1218,24 @@ ShellMITC4::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+ShellMITC4::hasConstantMass(void)
+{
+  // with an updated basis the mass matrix follows the nodes
+  return doUpdateBasis == false;
+}
+
+int
+ShellMITC4::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  if (load == 0)
+    load = new Vector(24);
+
+  load->addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 
 
 //get residual
@@ -100,7 +100,11 @@ class ShellMITC4 : public Element {
     // methods for applying loads
     void zeroLoad( void );	
     int addLoad( ElementalLoad *theLoad, double loadFactor );
+    int getEquivalentLoad(ElementalLoad *theLoad, Vector &P);
+    int addEquivalentLoad(const Vector &P, double fact);
     int addInertiaLoadToUnbalance( const Vector &accel );
+    bool hasConstantMass(void);
+    int addEffectiveInertiaLoad(const Vector &effLoad, double fact);
 
     //get residual
     const Vector &getResistingForce( ) ;
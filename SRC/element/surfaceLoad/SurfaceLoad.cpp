@@ -107,7 +107,9 @@ SurfaceLoad::SurfaceLoad(int tag, int Nd1, int Nd2, int Nd3, int Nd4, double pre
    dcrd1(SL_NUM_NDF),
    dcrd2(SL_NUM_NDF),
    dcrd3(SL_NUM_NDF),
-   dcrd4(SL_NUM_NDF)
+   dcrd4(SL_NUM_NDF),
+   myUnitForces(SL_NUM_DOF),
+   myForcesFormed(false)
 {
     myExternalNodes(0) = Nd1;
     myExternalNodes(1) = Nd2;
@@ -138,7 +140,9 @@ SurfaceLoad::SurfaceLoad()
    	dcrd1(SL_NUM_NDF),
    	dcrd2(SL_NUM_NDF),
    	dcrd3(SL_NUM_NDF),
-   	dcrd4(SL_NUM_NDF)
+   	dcrd4(SL_NUM_NDF),
+   	myUnitForces(SL_NUM_DOF),
+   	myForcesFormed(false)
 {
 }
 
@@ -188,6 +192,7 @@ SurfaceLoad::setDomain(Domain *theDomain)
     dcrd2 = theNodes[1]->getCrds();
     dcrd3 = theNodes[2]->getCrds();
     dcrd4 = theNodes[3]->getCrds();
+    myForcesFormed = false;
 
     // call the base class method
     this->DomainComponent::setDomain(theDomain);
@@ -296,21 +301,28 @@ SurfaceLoad::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 SurfaceLoad::getResistingForce()
 {
-	internalForces.Zero();
-
-	// loop over Gauss points
-	for(int i = 0; i < 4; i++) {
-		this->UpdateBase(GsPts[i][0],GsPts[i][1]);
-
-		// loop over nodes
-		for(int j = 0; j < 4; j++) {
-			// loop over dof
-			for(int k = 0; k < 3; k++) {
-				internalForces[j*3+k] = internalForces[j*3+k] - mLoadFactor*my_pressure*myNhat(k)*myNI(j);
+	// the base vectors use the initial coordinates, so the nodal forces
+	// of a unit pressure are integrated only once
+	if (myForcesFormed == false) {
+		myUnitForces.Zero();
+
+		// loop over Gauss points
+		for(int i = 0; i < 4; i++) {
+			this->UpdateBase(GsPts[i][0],GsPts[i][1]);
+
+			// loop over nodes
+			for(int j = 0; j < 4; j++) {
+				// loop over dof
+				for(int k = 0; k < 3; k++) {
+					myUnitForces[j*3+k] = myUnitForces[j*3+k] - myNhat(k)*myNI(j);
+				}
 			}
 		}
+		myForcesFormed = true;
 	}
 
+	internalForces.addVector(0.0, myUnitForces, mLoadFactor*my_pressure);
+
 	return internalForces;
 }
 
@@ -396,6 +408,7 @@ SurfaceLoad::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theB
   }
   for (int i = 0; i < SL_NUM_NODE; i++)
     myNI(i) = data(3+7*SL_NUM_NDF+i);
+  myForcesFormed = false;
 
   // SurfaceLoad now receives the tags of its four external nodes
   res = theChannel.recvID(dataTag, commitTag, myExternalNodes);
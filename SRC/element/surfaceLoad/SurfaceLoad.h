@@ -120,6 +120,9 @@ class SurfaceLoad : public Element
     static double GsPts[4][2];
 
 	double mLoadFactor;       // factor from load pattern
+
+    Vector myUnitForces;      // nodal forces of a unit pressure
+    bool myForcesFormed;      // true once myUnitForces is integrated
 };
 
 #endif
@@ -183,7 +183,7 @@ Truss::Truss(int tag, int dim,
   dimension(dim), numDOF(0),
   theLoad(0), theMatrix(0), theVector(0),
   L(0.0), A(a), rho(r), doRayleighDamping(damp),
-  cMass(cm), useInitialDisp(initDisp), initialDisp(0)
+  cMass(cm), useInitialDisp(initDisp), initialDisp(0), initDisp(0)
 {
     // get a copy of the material and check we obtained a valid copy
     theMaterial = theMat.getCopy();
@@ -225,7 +225,7 @@ Truss::Truss()
  dimension(0), numDOF(0),
  theLoad(0), theMatrix(0), theVector(0),
  L(0.0), A(0.0), rho(0.0), doRayleighDamping(0),
- cMass(0), useInitialDisp(false), initialDisp(0)
+ cMass(0), useInitialDisp(false), initialDisp(0), initDisp(0)
 {
     // ensure the connectedExternalNode ID is of correct size 
   if (connectedExternalNodes.Size() != 2) {
@@ -261,6 +261,8 @@ Truss::~Truss()
 	delete theLoadSens;
     if (initialDisp != 0)
       delete [] initialDisp;
+    if (initDisp != 0)
+      delete [] initDisp;
 }
 
 
@@ -522,6 +524,30 @@ Truss::update(void)
     return theMaterial->setTrialStrain(strain, rate);
 }
 
+void
+Truss::onActivate(void)
+{
+    // the truss is activated stress free: the strain is measured from
+    // the nodal displacements at activation, the -useInitialDisp
+    // displacements recorded in setDomain() are left as they are
+    if (theNodes[0] == 0 || L == 0.0)
+      return;
+
+    const Vector &disp1 = theNodes[0]->getTrialDisp();
+    const Vector &disp2 = theNodes[1]->getTrialDisp();
+
+    if (initDisp == 0)
+      initDisp = new double[3];
+    for (int i = 0; i < dimension; i++)
+      initDisp[i] = disp2(i)-disp1(i);
+}
+
+void
+Truss::onDeactivate(void)
+{
+
+}
+
 
 const Matrix &
 Truss::getTangentStiff(void)
@@ -705,6 +731,23 @@ Truss::addInertiaLoadToUnbalance(const Vector &accel)
   return 0;
 }
 
+bool
+Truss::hasConstantMass(void)
+{
+  return true;
+}
+
+int
+Truss::addEffectiveInertiaLoad(const Vector &effLoad, double fact)
+{
+  if (theLoad == 0)
+    return -1;
+
+  theLoad->addVector(1.0, effLoad, fact);
+
+  return 0;
+}
+
 
 int 
 Truss::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool somethingRandomInMotions)
@@ -877,7 +920,7 @@ Truss::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(13);
+  static Vector data(17);
   data(0) = this->getTag();
   data(1) = dimension;
   data(2) = numDOF;
@@ -896,6 +939,11 @@ Truss::sendSelf(int commitTag, Channel &theChannel)
     }
   }
 
+  // the relative nodal displacements at activation, if it has been activated
+  data(13) = (initDisp != 0) ? 1.0 : 0.0;
+  for (int i=0; i<3; i++)
+    data(14+i) = (initDisp != 0) ? initDisp[i] : 0.0;
+
   // NOTE: we do have to ensure that the material has a database
   // tag if we are sending to a database channel.
   if (matDbTag == 0) {
@@ -937,7 +985,7 @@ Truss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(13);
+  static Vector data(17);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr <<"WARNING Truss::recvSelf() - failed to receive Vector\n";
@@ -973,6 +1021,16 @@ Truss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
       }    
     }
   }
+
+  if (data(13) != 0.0) {
+    if (initDisp == 0)
+      initDisp = new double[3];
+    for (int i=0; i<3; i++)
+      initDisp[i] = data(14+i);
+  } else if (initDisp != 0) {
+    delete [] initDisp;
+    initDisp = 0;
+  }
   
   // truss now receives the tags of it's two external nodes
   res = theChannel.recvID(dataTag, commitTag, connectedExternalNodes);
@@ -1129,7 +1187,10 @@ Truss::computeCurrentStrain(void) const
     const Vector &disp2 = theNodes[1]->getTrialDisp();	
 
     double dLength = 0.0;
-    if (!useInitialDisp || initialDisp == 0)
+    if (initDisp != 0)
+      for (int i = 0; i < dimension; i++)
+	dLength += (disp2(i)-disp1(i)-initDisp[i])*cosX[i];
+    else if (!useInitialDisp || initialDisp == 0)
       for (int i = 0; i < dimension; i++)
 	dLength += (disp2(i)-disp1(i))*cosX[i];
     else
@@ -73,6 +73,8 @@ class Truss : public Element
     int revertToLastCommit(void);        
     int revertToStart(void);        
     int update(void);
+    void onActivate(void);
+    void onDeactivate(void);
     
     // public methods to obtain stiffness, mass, damping and residual information    
     const Matrix &getKi(void);
@@ -84,6 +86,8 @@ class Truss : public Element
     void zeroLoad(void);	
     int addLoad(ElementalLoad *theLoad, double loadFactor);
     int addInertiaLoadToUnbalance(const Vector &accel);
+    bool hasConstantMass(void);
+    int addEffectiveInertiaLoad(const Vector &effLoad, double fact);
 
     const Vector &getResistingForce(void);
     const Vector &getResistingForceIncInertia(void);            
@@ -135,6 +139,7 @@ class Truss : public Element
 
     Node *theNodes[2];
     double *initialDisp;
+    double *initDisp;       // relative nodal displacements at activation, 0 if never activated
 
 	
 // AddingSensitivity:BEGIN //////////////////////////////////////////
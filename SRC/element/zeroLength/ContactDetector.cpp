@@ -0,0 +1,428 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of ContactDetector
+// and of the contactSearch command.
+
+#include <ContactDetector.h>
+#include <ZeroLengthContact2D.h>
+#include <ZeroLengthContact3D.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+#include <MapOfTaggedObjects.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <math.h>
+#include <set>
+
+static MapOfTaggedObjects theContactDetectors;
+
+bool OPS_addContactDetector(ContactDetector *newComponent)
+{
+  return theContactDetectors.addComponent(newComponent);
+}
+
+ContactDetector *OPS_getContactDetector(int tag)
+{
+  TaggedObject *theResult = theContactDetectors.getComponentPtr(tag);
+  if (theResult == 0) {
+    opserr << "ContactDetector *getContactDetector(int tag) - none found with tag: " << tag << endln;
+    return 0;
+  }
+  return (ContactDetector *)theResult;
+}
+
+void OPS_clearAllContactDetector(void)
+{
+  theContactDetectors.clearAll();
+}
+
+static int
+OPS_ContactDetectorNodes(ID &nodes, bool range)
+{
+  int numdata = 1;
+  if (range) {
+    int idata[2];
+    numdata = 2;
+    if (OPS_GetIntInput(&numdata, idata) < 0)
+      return -1;
+    for (int i=idata[0]; i<=idata[1]; i++)
+      nodes[nodes.Size()] = i;
+    return 0;
+  }
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    int nodeTag;
+    if (OPS_GetIntInput(&numdata, &nodeTag) < 0) {
+      OPS_ResetCurrentInputArg(-1);
+      break;
+    }
+    nodes[nodes.Size()] = nodeTag;
+  }
+  return 0;
+}
+
+// contactSearch tag? -master nodes? / -masterRange start? end?
+//                    -slave nodes? / -slaveRange start? end?
+//                    -radius r? <-release factor?> -eleTag startTag?
+//                    -contact Kn? Kt? mu? <-c c?> <-dir dir?> <-normal nx? ny?>
+// contactSearch tag?
+//   updates the active contact elements and returns how many are active
+int OPS_ContactSearch()
+{
+  if (OPS_GetNumRemainingInputArgs() < 1) {
+    opserr << "WARNING insufficient args: contactSearch tag? <-master nodes? -slave nodes? -radius r? -eleTag startTag? -contact Kn? Kt? mu? ...>\n";
+    return -1;
+  }
+
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return -1;
+
+  int tag;
+  int numdata = 1;
+  if (OPS_GetIntInput(&numdata, &tag) < 0) {
+    opserr << "WARNING contactSearch - invalid tag\n";
+    return -1;
+  }
+
+  ContactDetector *theDetector = (ContactDetector *)theContactDetectors.getComponentPtr(tag);
+
+  if (OPS_GetNumRemainingInputArgs() > 0) {
+
+    if (theDetector != 0) {
+      opserr << "WARNING contactSearch - detector with tag " << tag << " already exists\n";
+      return -1;
+    }
+
+    ID masterNodes(0, 32);
+    ID slaveNodes(0, 32);
+    double radius = 0.0;
+    double releaseFactor = 1.5;
+    int startTag = -1;
+    double props[3] = {0.0, 0.0, 0.0};
+    bool haveProps = false;
+    double c = 0.0;
+    int dir = -1;
+    Vector normal(0);
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+      const char *opt = OPS_GetString();
+
+      if (strcmp(opt, "-master") == 0 || strcmp(opt, "-masterRange") == 0) {
+	if (OPS_ContactDetectorNodes(masterNodes, strcmp(opt, "-masterRange") == 0) < 0) {
+	  opserr << "WARNING contactSearch - invalid " << opt << endln;
+	  return -1;
+	}
+      } else if (strcmp(opt, "-slave") == 0 || strcmp(opt, "-slaveRange") == 0) {
+	if (OPS_ContactDetectorNodes(slaveNodes, strcmp(opt, "-slaveRange") == 0) < 0) {
+	  opserr << "WARNING contactSearch - invalid " << opt << endln;
+	  return -1;
+	}
+      } else if (strcmp(opt, "-radius") == 0) {
+	if (OPS_GetDoubleInput(&numdata, &radius) < 0) {
+	  opserr << "WARNING contactSearch - invalid -radius\n";
+	  return -1;
+	}
+      } else if (strcmp(opt, "-release") == 0) {
+	if (OPS_GetDoubleInput(&numdata, &releaseFactor) < 0) {
+	  opserr << "WARNING contactSearch - invalid -release\n";
+	  return -1;
+	}
+      } else if (strcmp(opt, "-eleTag") == 0) {
+	if (OPS_GetIntInput(&numdata, &startTag) < 0) {
+	  opserr << "WARNING contactSearch - invalid -eleTag\n";
+	  return -1;
+	}
+      } else if (strcmp(opt, "-contact") == 0) {
+	int num = 3;
+	if (OPS_GetDoubleInput(&num, props) < 0) {
+	  opserr << "WARNING contactSearch - invalid -contact Kn? Kt? mu?\n";
+	  return -1;
+	}
+	haveProps = true;
+      } else if (strcmp(opt, "-c") == 0) {
+	if (OPS_GetDoubleInput(&numdata, &c) < 0) {
+	  opserr << "WARNING contactSearch - invalid -c\n";
+	  return -1;
+	}
+      } else if (strcmp(opt, "-dir") == 0) {
+	if (OPS_GetIntInput(&numdata, &dir) < 0) {
+	  opserr << "WARNING contactSearch - invalid -dir\n";
+	  return -1;
+	}
+      } else if (strcmp(opt, "-normal") == 0) {
+	double n[2];
+	int num = 2;
+	if (OPS_GetDoubleInput(&num, n) < 0) {
+	  opserr << "WARNING contactSearch - invalid -normal nx? ny?\n";
+	  return -1;
+	}
+	normal.resize(2);
+	normal(0) = n[0];
+	normal(1) = n[1];
+      } else {
+	opserr << "WARNING contactSearch - unknown option " << opt << endln;
+	return -1;
+      }
+    }
+
+    int ndm = OPS_GetNDM();
+    if (masterNodes.Size() == 0 || slaveNodes.Size() == 0) {
+      opserr << "WARNING contactSearch - no master or no slave nodes given\n";
+      return -1;
+    }
+    if (radius <= 0.0 || releaseFactor < 1.0) {
+      opserr << "WARNING contactSearch - need -radius > 0 and -release >= 1\n";
+      return -1;
+    }
+    if (startTag < 0 || haveProps == false) {
+      opserr << "WARNING contactSearch - -eleTag and -contact are required\n";
+      return -1;
+    }
+    if (ndm == 2 && normal.Size() != 2) {
+      opserr << "WARNING contactSearch - -normal nx? ny? is required in 2d\n";
+      return -1;
+    }
+    if (ndm == 3 && dir < 0) {
+      opserr << "WARNING contactSearch - -dir is required in 3d\n";
+      return -1;
+    }
+    if (ndm != 2 && ndm != 3) {
+      opserr << "WARNING contactSearch - only 2d and 3d models are supported\n";
+      return -1;
+    }
+
+    theDetector = new ContactDetector(tag, ndm, masterNodes, slaveNodes, radius,
+				      releaseFactor, startTag, props[0], props[1],
+				      props[2], c, dir, normal);
+    if (OPS_addContactDetector(theDetector) == false) {
+      opserr << "WARNING contactSearch - could not add detector " << tag << endln;
+      delete theDetector;
+      return -1;
+    }
+  }
+
+  if (theDetector == 0) {
+    opserr << "WARNING contactSearch - no detector with tag " << tag << endln;
+    return -1;
+  }
+
+  if (theDetector->update(*theDomain) < 0)
+    return -1;
+
+  int numActive = theDetector->getNumActive();
+  if (OPS_SetIntOutput(&numdata, &numActive, true) < 0) {
+    opserr << "WARNING contactSearch - failed to set output\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+ContactDetector::ContactDetector(int tag, int nDim, const ID &master, const ID &slave,
+				 double r, double release, int startEleTag,
+				 double kn, double kt, double fric, double cohesion,
+				 int direction, const Vector &n)
+  :TaggedObject(tag), masterNodes(master), slaveNodes(slave),
+   radius(r), releaseFactor(release), nextEleTag(startEleTag),
+   Kn(kn), Kt(kt), mu(fric), c(cohesion), dir(direction), normal(n),
+   ndm(nDim)
+{
+
+}
+
+ContactDetector::~ContactDetector()
+{
+  // the contact elements belong to the Domain
+}
+
+long long
+ContactDetector::cellKey(const double *x) const
+{
+  long long key = 0;
+  for (int i=0; i<ndm; i++) {
+    long long ic = (long long)floor(x[i]/radius);
+    key = (key << 21) | (ic & 0x1FFFFF);
+  }
+  return key;
+}
+
+int
+ContactDetector::getPosition(Domain &theDomain, int nodeTag, double *x)
+{
+  Node *theNode = theDomain.getNode(nodeTag);
+  if (theNode == 0) {
+    opserr << "WARNING ContactDetector::update - node " << nodeTag << " does not exist\n";
+    return -1;
+  }
+
+  const Vector &crds = theNode->getCrds();
+  const Vector &disp = theNode->getTrialDisp();
+  for (int i=0; i<ndm; i++) {
+    x[i] = crds(i);
+    if (i < disp.Size())
+      x[i] += disp(i);
+  }
+  return 0;
+}
+
+int
+ContactDetector::update(Domain &theDomain)
+{
+  int numChanges = 0;
+  double x[3], y[3];
+
+  // broad phase: bin the master nodes
+  int numMaster = masterNodes.Size();
+  masterPos.resize(3*numMaster);
+  grid.clear();
+  for (int i=0; i<numMaster; i++) {
+    if (this->getPosition(theDomain, masterNodes(i), &masterPos[3*i]) < 0)
+      return -1;
+    grid[this->cellKey(&masterPos[3*i])].push_back(i);
+  }
+
+  // release the pairs that have moved apart
+  std::set<int> paired;
+  std::map<std::pair<int, int>, int>::iterator it = activePairs.begin();
+  while (it != activePairs.end()) {
+    Element *theEle = theDomain.getElement(it->second);
+    bool keep = theEle != 0;
+    if (keep) {
+      if (this->getPosition(theDomain, it->first.first, x) < 0 ||
+	  this->getPosition(theDomain, it->first.second, y) < 0)
+	return -1;
+      double d2 = 0.0;
+      for (int i=0; i<ndm; i++)
+	d2 += (x[i]-y[i])*(x[i]-y[i]);
+      double dMax = releaseFactor*radius;
+      if (d2 > dMax*dMax) {
+	theEle->deactivate();
+	numChanges++;
+	keep = false;
+      }
+    } else
+      contactElements.erase(it->first);
+    if (keep) {
+      paired.insert(it->first.first);
+      ++it;
+    } else
+      activePairs.erase(it++);
+  }
+
+  // narrow phase: closest master node within the radius of each free slave
+  int numSlave = slaveNodes.Size();
+  for (int s=0; s<numSlave; s++) {
+    int slaveTag = slaveNodes(s);
+    if (paired.find(slaveTag) != paired.end())
+      continue;
+    if (this->getPosition(theDomain, slaveTag, x) < 0)
+      return -1;
+
+    long long ic[3] = {0, 0, 0};
+    for (int i=0; i<ndm; i++)
+      ic[i] = (long long)floor(x[i]/radius);
+
+    int closest = -1;
+    double dMin2 = radius*radius;
+    int kMax = (ndm == 3) ? 1 : 0;
+    for (int di=-1; di<=1; di++)
+      for (int dj=-1; dj<=1; dj++)
+	for (int dk=-kMax; dk<=kMax; dk++) {
+	  double cell[3];
+	  cell[0] = (ic[0]+di+0.5)*radius;
+	  cell[1] = (ic[1]+dj+0.5)*radius;
+	  cell[2] = (ic[2]+dk+0.5)*radius;
+	  std::unordered_map<long long, std::vector<int> >::iterator bin = grid.find(this->cellKey(cell));
+	  if (bin == grid.end())
+	    continue;
+	  for (size_t m=0; m<bin->second.size(); m++) {
+	    int im = bin->second[m];
+	    if (masterNodes(im) == slaveTag)
+	      continue;
+	    const double *xm = &masterPos[3*im];
+	    double d2 = 0.0;
+	    for (int i=0; i<ndm; i++)
+	      d2 += (x[i]-xm[i])*(x[i]-xm[i]);
+	    if (d2 <= dMin2) {
+	      dMin2 = d2;
+	      closest = im;
+	    }
+	  }
+	}
+
+    if (closest < 0)
+      continue;
+
+    int masterTag = masterNodes(closest);
+    std::pair<int, int> thePair(slaveTag, masterTag);
+
+    // a pair that was in contact before keeps its element
+    std::map<std::pair<int, int>, int>::iterator known = contactElements.find(thePair);
+    if (known != contactElements.end()) {
+      Element *theEle = theDomain.getElement(known->second);
+      if (theEle != 0) {
+	if (theEle->isActive() == false)
+	  theEle->activate();
+	activePairs[thePair] = known->second;
+	numChanges++;
+	continue;
+      }
+      contactElements.erase(known);
+    }
+
+    while (theDomain.getElement(nextEleTag) != 0)
+      nextEleTag++;
+
+    // the nodes are only within the search radius, not coincident, so the
+    // length check of the contact elements is switched off
+    Element *theEle = 0;
+    if (ndm == 2)
+      theEle = new ZeroLengthContact2D(nextEleTag, slaveTag, masterTag, Kn, Kt, mu, normal, false);
+    else
+      theEle = new ZeroLengthContact3D(nextEleTag, slaveTag, masterTag, dir, Kn, Kt, mu, c, 0.0, 0.0, false);
+
+    if (theDomain.addElement(theEle) == false) {
+      opserr << "WARNING ContactDetector::update - could not add contact element between nodes "
+	     << slaveTag << " and " << masterTag << endln;
+      delete theEle;
+      return -1;
+    }
+
+    contactElements[thePair] = nextEleTag;
+    activePairs[thePair] = nextEleTag;
+    nextEleTag++;
+    numChanges++;
+  }
+
+  return numChanges;
+}
+
+void
+ContactDetector::Print(OPS_Stream &s, int flag)
+{
+  s << "ContactDetector: " << this->getTag() << endln;
+  s << "  master nodes: " << masterNodes.Size() << ", slave nodes: " << slaveNodes.Size() << endln;
+  s << "  radius: " << radius << ", release factor: " << releaseFactor << endln;
+  s << "  contact elements: " << (int)contactElements.size()
+    << ", active: " << (int)activePairs.size() << endln;
+}
@@ -0,0 +1,96 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ContactDetector_h
+#define ContactDetector_h
+
+// Description: This file contains the class definition for
+// ContactDetector. A ContactDetector watches a set of slave nodes and a
+// set of master nodes and keeps node-to-node contact elements
+// (ZeroLengthContact2D in 2d, ZeroLengthContact3D in 3d) only between the
+// pairs that are close in the current (trial) configuration:
+//   - broad phase: the master nodes are binned in a uniform hash grid
+//     with cells of the size of the search radius, so a slave node only
+//     looks at the 3^ndm cells around it
+//   - narrow phase: the closest master node within the search radius is
+//     paired with the slave node
+// An active pair is released once the nodes are further apart than
+// releaseFactor*radius. The element of a released pair is deactivated, not
+// removed, and is activated again when the pair comes back into contact, so
+// the Domain (and with it the DOF numbering and the structure of the system
+// of equations) is flagged as changed only when a new pair is first created.
+
+#include <TaggedObject.h>
+#include <ID.h>
+#include <Vector.h>
+
+#include <map>
+#include <vector>
+#include <unordered_map>
+
+class Domain;
+
+class ContactDetector: public TaggedObject
+{
+  public:
+    ContactDetector(int tag, int ndm, const ID &masterNodes, const ID &slaveNodes,
+		    double radius, double releaseFactor, int startEleTag,
+		    double Kn, double Kt, double mu, double c, int dir,
+		    const Vector &normal);
+    ~ContactDetector();
+
+    // returns the number of elements added, activated or deactivated, <0 on error
+    int update(Domain &theDomain);
+    int getNumActive(void) const {return (int)activePairs.size();};
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+  private:
+    long long cellKey(const double *x) const;
+    int getPosition(Domain &theDomain, int nodeTag, double *x);
+
+    ID masterNodes;
+    ID slaveNodes;
+    double radius;
+    double releaseFactor;
+    int nextEleTag;
+
+    // contact element properties
+    double Kn, Kt, mu, c;
+    int dir;
+    Vector normal;
+
+    int ndm;
+
+    // hash grid of the master nodes, rebuilt at every update
+    std::unordered_map<long long, std::vector<int> > grid;
+    std::vector<double> masterPos;
+
+    // (slave node, master node) -> contact element tag, for all the
+    // elements created and for the active ones
+    std::map<std::pair<int, int>, int> contactElements;
+    std::map<std::pair<int, int>, int> activePairs;
+};
+
+extern bool OPS_addContactDetector(ContactDetector *newComponent);
+extern ContactDetector *OPS_getContactDetector(int tag);
+extern void OPS_clearAllContactDetector(void);
+
+#endif
@@ -107,10 +107,11 @@ void* OPS_ZeroLengthContact2D()
 ZeroLengthContact2D::ZeroLengthContact2D(int tag,
 					 int Nd1, int Nd2,
 					 double Knormal, double Ktangent,
-					 double frictionRatio,  const Vector& normal )
+					 double frictionRatio,  const Vector& normal,
+					 bool check)
   :Element(tag,ELE_TAG_ZeroLengthContact2D),
    connectedExternalNodes(numberNodes),
-   N(2*numberNodes), T(2*numberNodes), ContactNormal(2)
+   N(2*numberNodes), T(2*numberNodes), ContactNormal(2), checkLength(check)
 {
     // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 2)
@@ -145,7 +146,7 @@ ZeroLengthContact2D::ZeroLengthContact2D(int tag,
 ZeroLengthContact2D::ZeroLengthContact2D(void)
   :Element(0,ELE_TAG_ZeroLengthContact2D),
   connectedExternalNodes(numberNodes),
-  N(2*numberNodes), T(2*numberNodes), ContactNormal(2)
+  N(2*numberNodes), T(2*numberNodes), ContactNormal(2), checkLength(true)
 {
 
   //opserr<<this->getTag()<< " new ZeroLengthContact2D::null constructor" <<endln;
@@ -265,7 +266,7 @@ ZeroLengthContact2D::setDomain(Domain *theDomain)
     vm = (v1<v2) ? v2 : v1;
 
 
-    if (L > LENTOL*vm)
+    if (checkLength && L > LENTOL*vm)
       opserr << "WARNING ZeroLengthContact2D::setDomain(): Element " << this->getTag() << " has L= " << L <<
 	", which is greater than the tolerance\n";
 
@@ -399,6 +400,24 @@ ZeroLengthContact2D::revertToStart()
 
 }
 
+void
+ZeroLengthContact2D::onActivate()
+{
+  // an activated element starts out of contact, as a new one would
+  ContactFlag = 0;
+  gap_n = 0;
+  lambda = 0;
+  pressure = 0;
+  stickPt = 0;
+  xi = 0;
+}
+
+void
+ZeroLengthContact2D::onDeactivate()
+{
+  // nothing to release, the state is reset on activation
+}
+
 
 
 
@@ -660,12 +679,13 @@ ZeroLengthContact2D::sendSelf(int commitTag, Channel &theChannel)
 
   int dbTag = this->getDbTag();
 
-  static ID idData(5);
+  static ID idData(6);
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);  
   idData(3) = numDOF;
   idData(4) = ContactFlag;
+  idData(5) = checkLength ? 1 : 0;
 
   res += theChannel.sendID(dbTag, commitTag, idData);
   if (res < 0) {
@@ -701,7 +721,7 @@ ZeroLengthContact2D::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
 
   int dbTag = this->getDbTag();
 
-  static ID idData(5);
+  static ID idData(6);
   res += theChannel.recvID(dbTag, commitTag, idData);
   if (res < 0) {
     opserr << "ZeroLengthContact2D::recvSelf -- failed to receive ID data" << endln;
@@ -713,6 +733,7 @@ ZeroLengthContact2D::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   connectedExternalNodes(1) = idData(2);
   numDOF = idData(3);
   ContactFlag = idData(4);
+  checkLength = (idData(5) != 0);
 
   static Vector data(10);
   res += theChannel.recvVector(dbTag, commitTag, data);
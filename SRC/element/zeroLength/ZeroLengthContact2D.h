@@ -105,7 +105,7 @@ class ZeroLengthContact2D: public Element
   // Constructor
   ZeroLengthContact2D(int tag, int Nd1, int Nd2,
           double Kn, double Kt, double fRatio,
-          const Vector& normal);
+          const Vector& normal, bool checkLength = true);
 
   // Null constructor
   ZeroLengthContact2D();
@@ -124,6 +124,8 @@ class ZeroLengthContact2D: public Element
   int revertToLastCommit(void);
   int revertToStart(void);
   int update(void);
+  void onActivate(void);
+  void onDeactivate(void);
 
   // public methods to obtain stiffness, mass, damping and residual information
   const Matrix &getTangentStiff(void);
@@ -183,6 +185,7 @@ class ZeroLengthContact2D: public Element
 
   int ContactFlag;                    // 0: not contact; 1: stick; 2: slide
   int numDOF;	                        // number of dof for ZeroLength
+  bool checkLength;                   // warn in setDomain() if the nodes are not coincident
 
   // detect the contact and set flag
   int contactDetect();
@@ -126,11 +126,12 @@ void* OPS_ZeroLengthContact3D()
 ZeroLengthContact3D::ZeroLengthContact3D(int tag,
 					 int Nd1, int Nd2, 
 					 int direction, double Knormal, double Ktangent, 
-					 double frictionRatio, double c, double origX, double origY )
+					 double frictionRatio, double c, double origX, double origY,
+					 bool check)
   :Element(tag,ELE_TAG_ZeroLengthContact3D),     
    connectedExternalNodes(numberNodes),
    directionID(direction), N(3*numberNodes), T1(3*numberNodes), T2(3*numberNodes),
-   Ki(0), load(0), origin(2), stickPt(2), xi(2)
+   checkLength(check), Ki(0), load(0), origin(2), stickPt(2), xi(2)
 {
   
   if ( direction < 0 || direction > 3 ) {
@@ -171,7 +172,7 @@ ZeroLengthContact3D::ZeroLengthContact3D(void)
   :Element(0,ELE_TAG_ZeroLengthContact3D),     
    connectedExternalNodes(numberNodes),
    N(3*numberNodes), T1(3*numberNodes), T2(3*numberNodes),
-   Ki(0), load(0), origin(2), stickPt(2),  xi(2)
+   checkLength(true), Ki(0), load(0), origin(2), stickPt(2),  xi(2)
 {
   
   // ensure the connectedExternalNode ID is of correct size 
@@ -277,7 +278,7 @@ ZeroLengthContact3D::setDomain(Domain *theDomain)
     
     vm = (v1<v2) ? v2 : v1;
 
-    if (L > LENTOL*vm)
+    if (checkLength && L > LENTOL*vm)
       opserr << "WARNING ZeroLengthContact3D::setDomain(): Element " << this->getTag() << " has L= " << L << 
 	", which is greater than the tolerance\n";
         
@@ -332,6 +333,22 @@ ZeroLengthContact3D::revertToStart()
 	return 0;
 }
 
+void
+ZeroLengthContact3D::onActivate()
+{
+  // an activated element starts out of contact, as a new one would
+  ContactFlag = 0;
+  gap_n = 0;
+  stickPt.Zero();
+  xi.Zero();
+}
+
+void
+ZeroLengthContact3D::onDeactivate()
+{
+  // nothing to release, the state is reset on activation
+}
+
 
 // calculate stress-strain relation -- M. Frank
 /*
@@ -436,7 +453,7 @@ ZeroLengthContact3D::sendSelf(int commitTag, Channel &theChannel)
     int res = 0;
     int dataTag = this->getDbTag();
 
-    static Vector data(12);
+    static Vector data(13);
     data(0)  = this->getTag();
     data(1)  = directionID;
     data(2)  = Kn;
@@ -449,6 +466,7 @@ ZeroLengthContact3D::sendSelf(int commitTag, Channel &theChannel)
     data(9)  = origin(1);
     data(10) = stickPt(0);
     data(11) = stickPt(1);
+    data(12) = checkLength ? 1.0 : 0.0;
 
     res = theChannel.sendVector(dataTag, commitTag, data);
     if (res < 0) {
@@ -471,7 +489,7 @@ ZeroLengthContact3D::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
     int res;
     int dataTag = this->getDbTag();
 
-    static Vector data(12);
+    static Vector data(13);
     res = theChannel.recvVector(dataTag, commitTag, data);
     if (res < 0) {
         opserr << "WARNING ZeroLengthContact3D::recvSelf() - failed to receive Vector\n";
@@ -490,6 +508,7 @@ ZeroLengthContact3D::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
     origin(1)   = data(9);
     stickPt(0)  = data(10);
     stickPt(1)  = data(11);
+    checkLength = (data(12) != 0.0);
 
     res = theChannel.recvID(dataTag, commitTag, connectedExternalNodes);
     if (res < 0) {
@@ -121,7 +121,7 @@ class ZeroLengthContact3D: public Element
   ZeroLengthContact3D(int tag,
 		      int Nd1, int Nd2,
 		      int direction, double Kn, double Kt, double fRatio, double c,
-		      double originX, double originY);
+		      double originX, double originY, bool checkLength = true);
 
   // Null constructor
   ZeroLengthContact3D();
@@ -140,6 +140,8 @@ class ZeroLengthContact3D: public Element
   int revertToLastCommit(void);
   int revertToStart(void);
   //int update(void);
+  void onActivate(void);
+  void onDeactivate(void);
   
   // public methods to obtain stiffness, mass, damping and residual information
   const Matrix &getTangentStiff(void);
@@ -200,6 +202,7 @@ class ZeroLengthContact3D: public Element
   
   int ContactFlag;                    // 0: not contact; 1: stick; 2: slide
   int numDOF;	                        // number of dof for ZeroLength
+  bool checkLength;                   // warn in setDomain() if the nodes are not coincident
   
   // detect the contact and set flag
   int contactDetect();
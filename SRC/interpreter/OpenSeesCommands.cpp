@@ -59,6 +59,7 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <LimitCurve.h>
 #include <DamageModel.h>
 #include <FrictionModel.h>
+#include <ContactDetector.h>
 #include <HystereticBackbone.h>
 #include <StiffnessDegradation.h>
 #include <StrengthDegradation.h>
@@ -970,6 +971,9 @@ OpenSeesCommands::wipe()
     // wipe friction model
     OPS_clearAllFrictionModel();
 
+    // wipe contact detectors
+    OPS_clearAllContactDetector();
+
     // wipe HystereticBackbone
     OPS_clearAllHystereticBackbone();
     OPS_clearAllStiffnessDegradation();
@@ -482,6 +482,16 @@ int OPS_ShallowFoundationGen();
 int OPS_Pressure_Constraint();
 int OPS_DomainModalProperties();
 int OPS_ResponseSpectrumAnalysis();
+int OPS_materialDriver();
+int OPS_setQuiescentTolerance();
+int OPS_ElementDeactivate();
+int OPS_ElementActivate();
+int OPS_Profile();
+int OPS_NumbererCache();
+int OPS_SolutionStrategy();
+int OPS_HarmonicAnalysis();
+int OPS_ContactSearch();
+int OPS_shapeFunctionCache();
 
 void* OPS_TimeSeriesIntegrator();
 
@@ -0,0 +1,322 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: the materialDriver command. It drives copies of one or
+// more materials along a whole load path in a single call and returns
+// their response histories, so calibrations and parameter sweeps do not
+// pay the cost of one interpreter call per increment:
+//
+//   materialDriver uniaxial $matTags $strains <-dt $dt> <-tangent> <-parallel>
+//   materialDriver nD $matTags $control $path <-type $type> <-tangent>
+//                  <-tol $tol> <-maxIter $maxIter> <-parallel>
+//
+// $matTags, $strains, $control and $path are lists. A uniaxial material
+// is driven through $strains, with strain rates (e_i - e_i-1)/$dt if
+// -dt is given. An nD material is copied with getCopy($type), default
+// ThreeDimensional, and has n stress and strain components. Component j
+// is strain controlled if $control(j) is 1, else stress controlled, and
+// $path holds the n target values of each step. The strains of the
+// stress controlled components are found with Newton iterations on the
+// material tangent, e.g. a drained triaxial test controls the axial
+// strain and the lateral stresses.
+//
+// The result is one list per material holding, step after step, the
+// stress (and the tangent with -tangent) of a uniaxial material, or the
+// n strains and n stresses (and the n x n tangent, by rows) of an nD
+// material. The list of a material that fails stops at the failing
+// step. With -parallel the materials are run in OpenMP threads; this is
+// only safe for materials that do not use static work storage.
+
+#include <elementAPI.h>
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// drives theMaterial along the strain path, returns the number of steps done
+static int
+driveUniaxial(UniaxialMaterial *theMaterial, const Vector &strains, double dt,
+	      bool tangent, std::vector<double> &result)
+{
+  int numSteps = strains.Size();
+  result.reserve(numSteps * (tangent ? 2 : 1));
+
+  double lastStrain = theMaterial->getStrain();
+  for (int i = 0; i < numSteps; i++) {
+    double strain = strains(i);
+    double strainRate = (dt > 0.0) ? (strain - lastStrain) / dt : 0.0;
+    if (theMaterial->setTrialStrain(strain, strainRate) < 0)
+      return i;
+    if (theMaterial->commitState() < 0)
+      return i;
+    lastStrain = strain;
+
+    result.push_back(theMaterial->getStress());
+    if (tangent)
+      result.push_back(theMaterial->getTangent());
+  }
+
+  return numSteps;
+}
+
+// drives theMaterial along the mixed stress/strain path, returns the
+// number of steps done
+static int
+driveND(NDMaterial *theMaterial, const Vector &control, const Vector &path,
+	bool tangent, double tol, int maxIter, std::vector<double> &result)
+{
+  int n = control.Size();
+  int numSteps = path.Size() / n;
+  result.reserve(numSteps * (2 * n + (tangent ? n * n : 0)));
+
+  // the stress controlled components
+  int numStress = 0;
+  std::vector<int> stressComp(n);
+  for (int j = 0; j < n; j++)
+    if (control(j) == 0.0)
+      stressComp[numStress++] = j;
+
+  Vector strain(theMaterial->getStrain());
+  Matrix Kuu(numStress, numStress);
+  Vector Ru(numStress);
+  Vector dEu(numStress);
+
+  for (int i = 0; i < numSteps; i++) {
+    int step = i * n;
+    for (int j = 0; j < n; j++)
+      if (control(j) != 0.0)
+	strain(j) = path(step + j);
+
+    // iterate on the strains of the stress controlled components
+    bool converged = false;
+    for (int iter = 0; iter < maxIter && converged == false; iter++) {
+      if (theMaterial->setTrialStrain(strain) < 0)
+	return i;
+      if (numStress == 0) {
+	converged = true;
+	break;
+      }
+
+      const Vector &stress = theMaterial->getStress();
+      double norm = 0.0;
+      for (int k = 0; k < numStress; k++) {
+	Ru(k) = path(step + stressComp[k]) - stress(stressComp[k]);
+	norm += Ru(k) * Ru(k);
+      }
+      if (sqrt(norm) <= tol) {
+	converged = true;
+	break;
+      }
+
+      const Matrix &K = theMaterial->getTangent();
+      for (int k = 0; k < numStress; k++)
+	for (int l = 0; l < numStress; l++)
+	  Kuu(k, l) = K(stressComp[k], stressComp[l]);
+      if (Kuu.Solve(Ru, dEu) < 0)
+	return i;
+      for (int k = 0; k < numStress; k++)
+	strain(stressComp[k]) += dEu(k);
+    }
+
+    if (converged == false || theMaterial->commitState() < 0)
+      return i;
+
+    const Vector &stress = theMaterial->getStress();
+    for (int j = 0; j < n; j++)
+      result.push_back(strain(j));
+    for (int j = 0; j < n; j++)
+      result.push_back(stress(j));
+    if (tangent) {
+      const Matrix &K = theMaterial->getTangent();
+      for (int j = 0; j < n; j++)
+	for (int k = 0; k < n; k++)
+	  result.push_back(K(j, k));
+    }
+  }
+
+  return numSteps;
+}
+
+static int
+getMaterialTags(std::vector<int> &tags)
+{
+  Vector data;
+  int size = 0;
+  if (OPS_GetDoubleListInput(&size, &data) < 0 || size < 1) {
+    opserr << "WARNING materialDriver - could not read the list of material tags\n";
+    return -1;
+  }
+
+  tags.resize(size);
+  for (int i = 0; i < size; i++) {
+    tags[i] = (int)data(i);
+    if (tags[i] != data(i)) {
+      opserr << "WARNING materialDriver - invalid material tag " << data(i) << endln;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int OPS_materialDriver()
+{
+  if (OPS_GetNumRemainingInputArgs() < 3) {
+    opserr << "WARNING materialDriver uniaxial $matTags $strains <-dt $dt> <-tangent> <-parallel>\n";
+    opserr << "   or materialDriver nD $matTags $control $path <-type $type> <-tangent> <-tol $tol> <-maxIter $maxIter> <-parallel>\n";
+    return -1;
+  }
+
+  const char *type = OPS_GetString();
+  bool isUniaxial = false;
+  if (strcmp(type, "uniaxial") == 0 || strcmp(type, "Uniaxial") == 0)
+    isUniaxial = true;
+  else if (strcmp(type, "nD") != 0 && strcmp(type, "ND") != 0) {
+    opserr << "WARNING materialDriver - unknown material type " << type << ", want uniaxial or nD\n";
+    return -1;
+  }
+
+  std::vector<int> tags;
+  if (getMaterialTags(tags) < 0)
+    return -1;
+  int numMat = (int)tags.size();
+
+  Vector control, path;
+  int size = 0;
+  if (isUniaxial == false && OPS_GetDoubleListInput(&size, &control) < 0) {
+    opserr << "WARNING materialDriver nD - could not read the control list\n";
+    return -1;
+  }
+  if (OPS_GetDoubleListInput(&size, &path) < 0) {
+    opserr << "WARNING materialDriver - could not read the load path\n";
+    return -1;
+  }
+
+  double dt = 0.0;
+  double tol = 1.0e-8;
+  int maxIter = 25;
+  bool tangent = false;
+  bool parallel = false;
+  const char *ndType = "ThreeDimensional";
+  int numData = 1;
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *opt = OPS_GetString();
+    if (strcmp(opt, "-tangent") == 0)
+      tangent = true;
+    else if (strcmp(opt, "-parallel") == 0)
+      parallel = true;
+    else if (strcmp(opt, "-dt") == 0) {
+      if (OPS_GetDoubleInput(&numData, &dt) < 0) {
+	opserr << "WARNING materialDriver - invalid dt\n";
+	return -1;
+      }
+    } else if (strcmp(opt, "-tol") == 0) {
+      if (OPS_GetDoubleInput(&numData, &tol) < 0) {
+	opserr << "WARNING materialDriver - invalid tol\n";
+	return -1;
+      }
+    } else if (strcmp(opt, "-maxIter") == 0) {
+      if (OPS_GetIntInput(&numData, &maxIter) < 0) {
+	opserr << "WARNING materialDriver - invalid maxIter\n";
+	return -1;
+      }
+    } else if (strcmp(opt, "-type") == 0) {
+      ndType = OPS_GetString();
+    } else {
+      opserr << "WARNING materialDriver - unknown option " << opt << endln;
+      return -1;
+    }
+  }
+
+  // the materials are driven on copies, so the ones in the model are
+  // left untouched and each one can be driven again from its start
+  std::vector<UniaxialMaterial *> uniCopies(isUniaxial ? numMat : 0, (UniaxialMaterial *)0);
+  std::vector<NDMaterial *> ndCopies(isUniaxial ? 0 : numMat, (NDMaterial *)0);
+  int res = 0;
+  for (int i = 0; i < numMat && res == 0; i++) {
+    if (isUniaxial) {
+      UniaxialMaterial *theMaterial = OPS_getUniaxialMaterial(tags[i]);
+      if (theMaterial == 0) {
+	opserr << "WARNING materialDriver - uniaxial material " << tags[i] << " not found\n";
+	res = -1;
+      } else if ((uniCopies[i] = theMaterial->getCopy()) == 0) {
+	opserr << "WARNING materialDriver - failed to copy uniaxial material " << tags[i] << endln;
+	res = -1;
+      }
+    } else {
+      NDMaterial *theMaterial = OPS_getNDMaterial(tags[i]);
+      if (theMaterial == 0) {
+	opserr << "WARNING materialDriver - nD material " << tags[i] << " not found\n";
+	res = -1;
+      } else if ((ndCopies[i] = theMaterial->getCopy(ndType)) == 0) {
+	opserr << "WARNING materialDriver - failed to copy nD material " << tags[i] << " as " << ndType << endln;
+	res = -1;
+      } else if (ndCopies[i]->getStrain().Size() != control.Size() ||
+		 path.Size() % control.Size() != 0) {
+	opserr << "WARNING materialDriver - nD material " << tags[i] << " has " << ndCopies[i]->getStrain().Size();
+	opserr << " components, the control list and each step of the path need as many\n";
+	res = -1;
+      }
+    }
+  }
+
+  std::vector<std::vector<double> > results(numMat);
+  std::vector<int> numDone(numMat, 0);
+  if (res == 0) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(parallel)
+#endif
+    for (int i = 0; i < numMat; i++) {
+      if (isUniaxial)
+	numDone[i] = driveUniaxial(uniCopies[i], path, dt, tangent, results[i]);
+      else
+	numDone[i] = driveND(ndCopies[i], control, path, tangent, tol, maxIter, results[i]);
+    }
+
+    int numSteps = isUniaxial ? path.Size() : path.Size() / control.Size();
+    for (int i = 0; i < numMat; i++)
+      if (numDone[i] < numSteps)
+	opserr << "WARNING materialDriver - material " << tags[i] << " failed at step " << numDone[i] + 1 << endln;
+  }
+
+  for (int i = 0; i < (int)uniCopies.size(); i++)
+    if (uniCopies[i] != 0)
+      delete uniCopies[i];
+  for (int i = 0; i < (int)ndCopies.size(); i++)
+    if (ndCopies[i] != 0)
+      delete ndCopies[i];
+
+  if (res < 0)
+    return res;
+
+  if (OPS_SetDoubleListsOutput(results) < 0) {
+    opserr << "WARNING materialDriver - failed to set the results\n";
+    return -1;
+  }
+
+  return 0;
+}
@@ -1177,6 +1177,66 @@ int OPS_domainChange()
     return 0;
 }
 
+static int OPS_ElementActivation(bool activate)
+{
+    // elementActivate|elementDeactivate eleTag1 eleTag2 ...
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    int numEle = OPS_GetNumRemainingInputArgs();
+    ID eleTags(numEle);
+    if (numEle > 0 && OPS_GetIntInput(&numEle, &eleTags(0)) < 0) {
+	opserr << "WARNING element" << (activate ? "Activate" : "Deactivate") << " eleTags - could not read eleTags\n";
+	return -1;
+    }
+
+    // the elements are switched without a domain change, so the
+    // numbering and the structure of the SOE are kept
+    if (activate)
+	return theDomain->activateElements(eleTags);
+    else
+	return theDomain->deactivateElements(eleTags);
+}
+
+int OPS_ElementActivate()
+{
+    return OPS_ElementActivation(true);
+}
+
+int OPS_ElementDeactivate()
+{
+    return OPS_ElementActivation(false);
+}
+
+int OPS_setQuiescentTolerance()
+{
+    // setQuiescentTolerance tol
+    //
+    // in a static analysis, skips the state determination of elements whose
+    // nodes have all moved less than tol since the last full update. Only
+    // displacements are tracked, so nothing is skipped under a transient
+    // integrator, where velocities and time also change the element state.
+    // Domain::commit() updates the skipped elements before committing, but
+    // that state is not checked again for equilibrium; tol <= 0 turns
+    // skipping off
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING setQuiescentTolerance tol - not enough arguments to command\n";
+	return -1;
+    }
+
+    double tol;
+    int numdata = 1;
+    if (OPS_GetDoubleInput(&numdata, &tol) < 0) {
+	opserr << "WARNING setQuiescentTolerance tol - could not read tol\n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    return theDomain->setQuiescentTolerance(tol);
+}
+
 int OPS_record()
 {
     Domain* theDomain = OPS_GetDomain();
@@ -81,6 +81,9 @@ void* OPS_NodeRecorder();
 void* OPS_EnvelopeNodeRecorder();
 void* OPS_ElementRecorder();
 void* OPS_EnvelopeElementRecorder();
+void* OPS_ElementRecorderRainflow();
+void* OPS_NodeStatisticsRecorder();
+void* OPS_ElementStatisticsRecorder();
 void* OPS_PVDRecorder();
 void* OPS_AlgorithmRecorder();
 void* OPS_RemoveRecorder();
@@ -115,6 +118,9 @@ namespace {
         recordersMap.insert(std::make_pair("EnvelopeNode", &OPS_EnvelopeNodeRecorder));
         recordersMap.insert(std::make_pair("Element", &OPS_ElementRecorder));
         recordersMap.insert(std::make_pair("EnvelopeElement", &OPS_EnvelopeElementRecorder));
+	recordersMap.insert(std::make_pair("ElementRainflow", &OPS_ElementRecorderRainflow));
+	recordersMap.insert(std::make_pair("NodeStatistics", &OPS_NodeStatisticsRecorder));
+	recordersMap.insert(std::make_pair("ElementStatistics", &OPS_ElementStatisticsRecorder));
 	recordersMap.insert(std::make_pair("PVD", &OPS_PVDRecorder));
 	recordersMap.insert(std::make_pair("BgPVD", &OPS_PVDRecorder));
 	recordersMap.insert(std::make_pair("Remove", &OPS_RemoveRecorder));
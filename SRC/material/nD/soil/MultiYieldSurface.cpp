@@ -17,16 +17,23 @@
 
 // YieldSurface class methods
 MultiYieldSurface::MultiYieldSurface():
-theSize(0.0), theCenter(6), plastShearModulus(0.0)
+theSize(0.0), theCenter(centerData,6), plastShearModulus(0.0)
 {
-
+  for (int i=0; i<6; i++) centerData[i] = 0.0;
 }
 
 MultiYieldSurface::MultiYieldSurface(const Vector & theCenter_init, 
                                      double theSize_init, double plas_modul):
-theSize(theSize_init), theCenter(theCenter_init), plastShearModulus(plas_modul)
+theSize(theSize_init), theCenter(centerData,6), plastShearModulus(plas_modul)
 {
+  this->setCenter(theCenter_init);
+}
 
+MultiYieldSurface::MultiYieldSurface(const MultiYieldSurface & other):
+theSize(other.theSize), theCenter(centerData,6), 
+plastShearModulus(other.plastShearModulus)
+{
+  for (int i=0; i<6; i++) centerData[i] = other.centerData[i];
 }
 
 MultiYieldSurface::~MultiYieldSurface()
@@ -34,11 +41,21 @@ MultiYieldSurface::~MultiYieldSurface()
 
 }
 
+MultiYieldSurface & 
+MultiYieldSurface::operator= (const MultiYieldSurface & other)
+{
+  theSize = other.theSize;
+  for (int i=0; i<6; i++) centerData[i] = other.centerData[i];
+  plastShearModulus = other.plastShearModulus;
+
+  return *this;
+}
+
 void MultiYieldSurface::setData(const Vector & theCenter_init, 
                                 double theSize_init, double plas_modul)
 {
   theSize = theSize_init;
-  theCenter = theCenter_init;
+  this->setCenter(theCenter_init);
   plastShearModulus = plas_modul;
 }
 
@@ -49,7 +66,7 @@ void MultiYieldSurface::setCenter(const Vector & newCenter)
     exit(-1);
   }
 
-  theCenter = newCenter;
+  for (int i=0; i<6; i++) centerData[i] = newCenter(i);
 }
 
 
@@ -29,7 +29,9 @@ public:
   MultiYieldSurface();
   MultiYieldSurface(const Vector & center_init, double size_init, 
                     double plas_modul); 
+  MultiYieldSurface(const MultiYieldSurface & other);
   ~MultiYieldSurface();
+  MultiYieldSurface & operator= (const MultiYieldSurface & other);
 	void setData(const Vector & center_init, double size_init, 
                double plas_modul); 
   const Vector & center() const {return theCenter; }
@@ -43,7 +45,12 @@ public:
 protected:
 
 private:
+  // the center is kept in-place (theCenter only wraps centerData, so it
+  // must never be assigned a Vector of another size) so that an array
+  // of surfaces is one contiguous block instead of one heap block per
+  // center
   double theSize;
+  double centerData[6];
   Vector theCenter;  
   double plastShearModulus;
 
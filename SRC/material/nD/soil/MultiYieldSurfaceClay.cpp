@@ -275,6 +275,7 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay (int tag, int nd,
 
 	theSurfaces = new MultiYieldSurface[numberOfYieldSurf+1]; //first surface not used, pointer array??
     committedSurfaces = new MultiYieldSurface[numberOfYieldSurf+1]; 
+	dirtySurfaces = numberOfYieldSurf;
 	activeSurfaceNum = committedActiveSurf = 0; 
 
   setUpSurfaces(gredu);  // residualPress is calculated inside.
@@ -290,7 +291,7 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay (int tag, int nd,
 MultiYieldSurfaceClay::MultiYieldSurfaceClay () 
  : NDMaterial(0,ND_TAG_MultiYieldSurfaceClay), 
    currentStress(), trialStress(), currentStrain(), 
-  strainRate(), theSurfaces(0), committedSurfaces(0)
+  strainRate(), theSurfaces(0), committedSurfaces(0), dirtySurfaces(0)
 {
   //does nothing
   // === update to plastic now ==== 2009 July
@@ -313,6 +314,7 @@ MultiYieldSurfaceClay::MultiYieldSurfaceClay (const MultiYieldSurfaceClay & a)
 
   committedActiveSurf = a.committedActiveSurf;
   activeSurfaceNum = a.activeSurfaceNum; 
+  dirtySurfaces = a.dirtySurfaces;
 
 // for sensitivity
 	
@@ -664,7 +666,9 @@ const Vector & MultiYieldSurfaceClay::getStress (void)
   }
 
   else {
-    for (i=1; i<=numOfSurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    // only the surfaces moved since the last commit need to be reset
+    for (i=1; i<=dirtySurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    dirtySurfaces = 0;
     activeSurfaceNum = committedActiveSurf;
     subStrainRate = strainRate;
 	// output strainRate for debug
@@ -790,7 +794,8 @@ int MultiYieldSurfaceClay::commitState (void)
 //	opserr<<"committedActiveSurface is:"<<activeSurfaceNum<<endln;
 
 
-    for (int i=1; i<=numOfSurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    for (int i=1; i<=dirtySurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    dirtySurfaces = 0;
   }
 
   return 0;
@@ -1033,6 +1038,7 @@ int MultiYieldSurfaceClay::recvSelf(int commitTag, Channel &theChannel,
     temp(5) = data(k+7);
     committedSurfaces[i+1].setData(temp, data(k), data(k+1));
   }
+  dirtySurfaces = numOfSurfaces;
   
   loadStagex[matN] = loadStage;
   ndmx[matN] = ndm;
@@ -1372,6 +1378,7 @@ void MultiYieldSurfaceClay::setUpSurfaces (double * gredu)
   residualPressx[matN] = residualPress;
   frictionAnglex[matN] = frictionAngle;
   cohesionx[matN] = cohesion;
+  dirtySurfaces = numOfSurfaces;
 }
 
 
@@ -1448,6 +1455,7 @@ void MultiYieldSurfaceClay::initSurfaceUpdate()
 	  newCenter = devia * (1. - committedSurfaces[i].size() / Ms);
 	  committedSurfaces[i].setCenter(newCenter); 
 	}
+	if (activeSurfaceNum > dirtySurfaces) dirtySurfaces = activeSurfaceNum;
 }
 
 
@@ -1476,6 +1484,7 @@ void MultiYieldSurfaceClay::paramScaling(void)
 	  size = committedSurfaces[i].size() * conHeig;
 	  committedSurfaces[i] =  MultiYieldSurface(temp,size,plastModul);
 	}
+	dirtySurfaces = numOfSurfaces;
 
 }
 
@@ -1824,6 +1833,7 @@ void MultiYieldSurfaceClay::updateActiveSurface(void)
 	//center += temp * X;
 	center.addVector(1.0, temp, X);
 	theSurfaces[activeSurfaceNum].setCenter(center);
+	if (activeSurfaceNum > dirtySurfaces) dirtySurfaces = activeSurfaceNum;
 }      
 
 
@@ -1847,6 +1857,7 @@ void MultiYieldSurfaceClay::updateInnerSurface(void)
 
 		theSurfaces[i].setCenter(newcenter);
 	}
+	if (activeSurfaceNum-1 > dirtySurfaces) dirtySurfaces = activeSurfaceNum-1;
 }
 
 
@@ -2178,6 +2189,7 @@ void MultiYieldSurfaceClay::updateInnerSurfaceSensitivity(void)
 		newcenter += devia;
 
 		theSurfaces[ii].setCenter(newcenter);
+		if (ii > dirtySurfaces) dirtySurfaces = ii;
 
 //        opserr << "step2. updateInnerSurfaceSensitivity, theSurfaces "<<ii<<" is:"<< endln;
 //        opserr << newcenter<< endln;	
@@ -2608,6 +2620,7 @@ void MultiYieldSurfaceClay::updateActiveSurfaceSensitivity(void)
 
 	center.addVector(1.0, temp, X);
 	theSurfaces[activeSurfaceNum].setCenter(center);
+	if (activeSurfaceNum > dirtySurfaces) dirtySurfaces = activeSurfaceNum;
 
 	// ----------sensitivity part --------------------------
 
@@ -133,6 +133,7 @@ private:
 	double refBulkModulus;
 	MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used  
 	MultiYieldSurface * committedSurfaces;  
+	int    dirtySurfaces;  // theSurfaces[i] == committedSurfaces[i] for i > dirtySurfaces
 	int    activeSurfaceNum;  
 	int    committedActiveSurf;
 	T2Vector currentStress;
@@ -397,6 +397,7 @@ PressureDependMultiYield::PressureDependMultiYield (int tag, int nd,
 
   theSurfaces = new MultiYieldSurface[numOfSurfaces+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numOfSurfaces+1];
+  dirtySurfaces = numOfSurfaces;
 
   setUpSurfaces(gredu);  // residualPress and stressRatioPT are calculated inside.
 }
@@ -408,7 +409,7 @@ PressureDependMultiYield::PressureDependMultiYield ()
   strainRate(), reversalStress(), PPZPivot(),
   PPZCenter(), lockStress(), reversalStressCommitted(),
   PPZPivotCommitted(), PPZCenterCommitted(),
-  lockStressCommitted(), theSurfaces(0), committedSurfaces(0)
+  lockStressCommitted(), theSurfaces(0), committedSurfaces(0), dirtySurfaces(0)
 {
   //does nothing
 }
@@ -432,6 +433,7 @@ PressureDependMultiYield::PressureDependMultiYield (const PressureDependMultiYie
   modulusFactor = a.modulusFactor;
   activeSurfaceNum = a.activeSurfaceNum;
   committedActiveSurf = a.committedActiveSurf;
+  dirtySurfaces = a.dirtySurfaces;
   pressureDCommitted     = a.pressureDCommitted;
   onPPZCommitted = a.onPPZCommitted;
   PPZSizeCommitted      = a.PPZSizeCommitted;
@@ -752,7 +754,9 @@ PressureDependMultiYield::getStress (void)
     trialStress.setData(workV6);
   }
   else {
-    for (i=1; i<=numOfSurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    // only the surfaces moved since the last commit need to be reset
+    for (i=1; i<=dirtySurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    dirtySurfaces = 0;
     activeSurfaceNum = committedActiveSurf;
     pressureD = pressureDCommitted;
     reversalStress = reversalStressCommitted;
@@ -845,7 +849,8 @@ PressureDependMultiYield::commitState (void)
 
   if (loadStage==1) {
     committedActiveSurf = activeSurfaceNum;
-    for (int i=1; i<=numOfSurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    for (int i=1; i<=dirtySurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    dirtySurfaces = 0;
     pressureDCommitted = pressureD;
     reversalStressCommitted = reversalStress;
     onPPZCommitted = onPPZ;
@@ -1158,6 +1163,7 @@ PressureDependMultiYield::recvSelf(int commitTag, Channel &theChannel,
 
   theSurfaces = new MultiYieldSurface[numOfSurfaces+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numOfSurfaces+1];
+  dirtySurfaces = numOfSurfaces;
 
   for(i = 0; i < numOfSurfaces; i++) {
     int k = 70 + i*8;
@@ -1684,6 +1690,7 @@ PressureDependMultiYield::setUpSurfaces (double * gredu)
   cohesionx[matN] = cohesion;
   phaseTransfAnglex[matN] = phaseTransfAngle;
   stressRatioPTx[matN] = stressRatioPT;
+  dirtySurfaces = numOfSurfaces;
 }
 
 double
@@ -1768,6 +1775,7 @@ PressureDependMultiYield::initSurfaceUpdate(void)
     committedSurfaces[i].setCenter(workV6);
     theSurfaces[i] = committedSurfaces[i];
   }
+  if (committedActiveSurf > dirtySurfaces) dirtySurfaces = committedActiveSurf;
   activeSurfaceNum = committedActiveSurf;
 }
 
@@ -2379,6 +2387,7 @@ PressureDependMultiYield::updateActiveSurface(void)
 
   center.addVector(1.0, workV6, -X);
   theSurfaces[activeSurfaceNum].setCenter(center);
+  if (activeSurfaceNum > dirtySurfaces) dirtySurfaces = activeSurfaceNum;
 }
 
 void
@@ -2406,6 +2415,7 @@ PressureDependMultiYield::updateInnerSurface(void)
 		workV6 /= conHeig;
 		theSurfaces[i].setCenter(workV6);
 	}
+	if (activeSurfaceNum-1 > dirtySurfaces) dirtySurfaces = activeSurfaceNum-1;
 }
 
 int
@@ -156,6 +156,7 @@ private:
      int e2p;
      MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used  
      MultiYieldSurface * committedSurfaces;  
+     int    dirtySurfaces;  // theSurfaces[i] == committedSurfaces[i] for i > dirtySurfaces
      int    activeSurfaceNum;  
      int    committedActiveSurf;
      double modulusFactor;
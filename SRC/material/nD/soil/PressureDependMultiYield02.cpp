@@ -423,6 +423,7 @@ PressureDependMultiYield02::PressureDependMultiYield02 (int tag, int nd,
 
   theSurfaces = new MultiYieldSurface[numOfSurfaces+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numOfSurfaces+1];
+  dirtySurfaces = numOfSurfaces;
 
   mGredu = gredu;
   setUpSurfaces(gredu);  // residualPress and stressRatioPT are calculated inside.
@@ -433,7 +434,7 @@ PressureDependMultiYield02::PressureDependMultiYield02 ()
  : NDMaterial(0,ND_TAG_PressureDependMultiYield02),
    currentStress(), trialStress(), currentStrain(),
   strainRate(), PPZPivot(), PPZCenter(), PivotStrainRate(6), PivotStrainRateCommitted(6),
-  PPZPivotCommitted(), PPZCenterCommitted(), theSurfaces(0), committedSurfaces(0)
+  PPZPivotCommitted(), PPZCenterCommitted(), theSurfaces(0), committedSurfaces(0), dirtySurfaces(0)
 {
   //does nothing
 }
@@ -456,6 +457,7 @@ PressureDependMultiYield02::PressureDependMultiYield02 (const PressureDependMult
   modulusFactor = a.modulusFactor;
   activeSurfaceNum = a.activeSurfaceNum;
   committedActiveSurf = a.committedActiveSurf;
+  dirtySurfaces = a.dirtySurfaces;
   pressureDCommitted     = a.pressureDCommitted;
   onPPZCommitted = a.onPPZCommitted;
   PPZSizeCommitted      = a.PPZSizeCommitted;
@@ -814,7 +816,9 @@ const Vector & PressureDependMultiYield02::getStress (void)
     trialStress.setData(workV6);
   }
   else {
-    for (i=1; i<=numOfSurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    // only the surfaces moved since the last commit need to be reset
+    for (i=1; i<=dirtySurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    dirtySurfaces = 0;
     activeSurfaceNum = committedActiveSurf;
     pressureD = pressureDCommitted;
     onPPZ = onPPZCommitted;
@@ -920,7 +924,8 @@ int PressureDependMultiYield02::commitState (void)
 
   if (loadStage==1) {
     committedActiveSurf = activeSurfaceNum;
-    for (int i=1; i<=numOfSurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    for (int i=1; i<=dirtySurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    dirtySurfaces = 0;
     pressureDCommitted = pressureD;
     onPPZCommitted = onPPZ;
     PPZSizeCommitted = PPZSize;
@@ -1300,6 +1305,7 @@ int PressureDependMultiYield02::recvSelf(int commitTag, Channel &theChannel,
 
   theSurfaces = new MultiYieldSurface[numOfSurfaces+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numOfSurfaces+1];
+  dirtySurfaces = numOfSurfaces;
 
   for(i = 0; i < numOfSurfaces; i++) {
     int k = 62 + i*8;
@@ -1845,6 +1851,7 @@ void PressureDependMultiYield02::setUpSurfaces (double * gredu)
   cohesionx[matN] = cohesion;
   phaseTransfAnglex[matN] = phaseTransfAngle;
   stressRatioPTx[matN] = stressRatioPT;
+  dirtySurfaces = numOfSurfaces;
 }
 
 
@@ -1929,6 +1936,7 @@ void PressureDependMultiYield02::initSurfaceUpdate(void)
     committedSurfaces[i].setCenter(workV6);
     theSurfaces[i] = committedSurfaces[i];
   }
+  if (committedActiveSurf > dirtySurfaces) dirtySurfaces = committedActiveSurf;
   activeSurfaceNum = committedActiveSurf;
 }
 
@@ -2577,6 +2585,7 @@ void PressureDependMultiYield02::updateActiveSurface(void)
 
   center.addVector(1.0, workV6, -X);
   theSurfaces[activeSurfaceNum].setCenter(center);
+  if (activeSurfaceNum > dirtySurfaces) dirtySurfaces = activeSurfaceNum;
 }
 
 
@@ -2604,6 +2613,7 @@ void PressureDependMultiYield02::updateInnerSurface(void)
 		workV6 /= conHeig;
 		theSurfaces[i].setCenter(workV6);
 	}
+	if (activeSurfaceNum-1 > dirtySurfaces) dirtySurfaces = activeSurfaceNum-1;
 }
 
 
@@ -458,6 +458,7 @@ PressureDependMultiYield03::PressureDependMultiYield03 (int tag, int nd,
 
   theSurfaces = new MultiYieldSurface[numOfSurfaces+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numOfSurfaces+1];
+  dirtySurfaces = numOfSurfaces;
 
   mGredu = gredu;
   setUpSurfaces(gredu);  // residualPress and stressRatioPT are calculated inside.
@@ -468,7 +469,7 @@ PressureDependMultiYield03::PressureDependMultiYield03 ()
  : NDMaterial(0,ND_TAG_PressureDependMultiYield03),
    currentStress(), trialStress(), currentStrain(),
   strainRate(), PPZPivot(), PPZCenter(), PivotStrainRate(6), PivotStrainRateCommitted(6),
-  PPZPivotCommitted(), PPZCenterCommitted(), theSurfaces(0), committedSurfaces(0)
+  PPZPivotCommitted(), PPZCenterCommitted(), theSurfaces(0), committedSurfaces(0), dirtySurfaces(0)
 {
   //does nothing
 }
@@ -492,6 +493,7 @@ PressureDependMultiYield03::PressureDependMultiYield03 (const PressureDependMult
   modulusFactor = a.modulusFactor;
   activeSurfaceNum = a.activeSurfaceNum;
   committedActiveSurf = a.committedActiveSurf;
+  dirtySurfaces = a.dirtySurfaces;
   pressureDCommitted     = a.pressureDCommitted;
   onPPZCommitted = a.onPPZCommitted;
   PPZSizeCommitted      = a.PPZSizeCommitted;
@@ -870,7 +872,9 @@ const Vector & PressureDependMultiYield03::getStress (void)
     trialStress.setData(workV6);
   }
   else {
-    for (i=1; i<=numOfSurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    // only the surfaces moved since the last commit need to be reset
+    for (i=1; i<=dirtySurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    dirtySurfaces = 0;
     activeSurfaceNum = committedActiveSurf;
     pressureD = pressureDCommitted;
     onPPZ = onPPZCommitted;
@@ -976,7 +980,8 @@ int PressureDependMultiYield03::commitState (void)
 
   if (loadStage==1) {
     committedActiveSurf = activeSurfaceNum;
-    for (int i=1; i<=numOfSurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    for (int i=1; i<=dirtySurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    dirtySurfaces = 0;
     pressureDCommitted = pressureD;
     onPPZCommitted = onPPZ;
     PPZSizeCommitted = PPZSize;
@@ -1338,6 +1343,7 @@ int PressureDependMultiYield03::recvSelf(int commitTag, Channel &theChannel,
 
   theSurfaces = new MultiYieldSurface[numOfSurfaces+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numOfSurfaces+1];
+  dirtySurfaces = numOfSurfaces;
 
   for(i = 0; i < numOfSurfaces; i++) {
     int k = 62 + i*8;
@@ -1940,6 +1946,7 @@ void PressureDependMultiYield03::setUpSurfaces (double * gredu)
   cohesionx[matN] = cohesion;
   phaseTransfAnglex[matN] = phaseTransfAngle;
   stressRatioPTx[matN] = stressRatioPT;
+  dirtySurfaces = numOfSurfaces;
 }
 
 
@@ -2024,6 +2031,7 @@ void PressureDependMultiYield03::initSurfaceUpdate(void)
     committedSurfaces[i].setCenter(workV6);
     theSurfaces[i] = committedSurfaces[i];
   }
+  if (committedActiveSurf > dirtySurfaces) dirtySurfaces = committedActiveSurf;
   activeSurfaceNum = committedActiveSurf;
 }
 
@@ -2719,6 +2727,7 @@ void PressureDependMultiYield03::updateActiveSurface(void)
 
   center.addVector(1.0, workV6, -X);
   theSurfaces[activeSurfaceNum].setCenter(center);
+  if (activeSurfaceNum > dirtySurfaces) dirtySurfaces = activeSurfaceNum;
 }
 
 
@@ -2746,6 +2755,7 @@ void PressureDependMultiYield03::updateInnerSurface(void)
 		workV6 /= conHeig;
 		theSurfaces[i].setCenter(workV6);
 	}
+	if (activeSurfaceNum-1 > dirtySurfaces) dirtySurfaces = activeSurfaceNum-1;
 }
 
 
@@ -241,6 +241,7 @@ PressureIndependMultiYield::PressureIndependMultiYield (int tag, int nd,
 
   theSurfaces = new MultiYieldSurface[numberOfYieldSurf+1]; //first surface not used
   committedSurfaces = new MultiYieldSurface[numberOfYieldSurf+1];
+  dirtySurfaces = numberOfYieldSurf;
   activeSurfaceNum = committedActiveSurf = 0;
 
   mGredu = gredu;
@@ -251,7 +252,7 @@ PressureIndependMultiYield::PressureIndependMultiYield (int tag, int nd,
 PressureIndependMultiYield::PressureIndependMultiYield ()
  : NDMaterial(0,ND_TAG_PressureIndependMultiYield),
    currentStress(), trialStress(), currentStrain(),
-  strainRate(), theSurfaces(0), committedSurfaces(0)
+  strainRate(), theSurfaces(0), committedSurfaces(0), dirtySurfaces(0)
 {
   //does nothing
 }
@@ -271,6 +272,7 @@ PressureIndependMultiYield::PressureIndependMultiYield (const PressureIndependMu
 
   committedActiveSurf = a.committedActiveSurf;
   activeSurfaceNum = a.activeSurfaceNum;
+  dirtySurfaces = a.dirtySurfaces;
 
   theSurfaces = new MultiYieldSurface[numOfSurfaces+1];  //first surface not used
   committedSurfaces = new MultiYieldSurface[numOfSurfaces+1];
@@ -508,7 +510,9 @@ const Vector & PressureIndependMultiYield::getStress (void)
   }
 
   else {
-    for (i=1; i<=numOfSurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    // only the surfaces moved since the last commit need to be reset
+    for (i=1; i<=dirtySurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    dirtySurfaces = 0;
     activeSurfaceNum = committedActiveSurf;
     subStrainRate = strainRate;
     setTrialStress(currentStress);
@@ -570,7 +574,8 @@ int PressureIndependMultiYield::commitState (void)
 
   if (loadStage==1) {
     committedActiveSurf = activeSurfaceNum;
-    for (int i=1; i<=numOfSurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    for (int i=1; i<=dirtySurfaces; i++) committedSurfaces[i] = theSurfaces[i];
+    dirtySurfaces = 0;
   }
 
   return 0;
@@ -819,6 +824,7 @@ int PressureIndependMultiYield::recvSelf(int commitTag, Channel &theChannel,
     temp(5) = data(k+7);
     committedSurfaces[i+1].setData(temp, data(k), data(k+1));
   }
+  dirtySurfaces = numOfSurfaces;
 
   int *temp1, *temp2, *temp11;
   double *temp3, *temp6, *temp7, *temp8, *temp9, *temp10, *temp12;
@@ -1245,6 +1251,7 @@ void PressureIndependMultiYield::setUpSurfaces (double * gredu)
 	residualPressx[matN] = residualPress;
 	frictionAnglex[matN] = frictionAngle;
 	cohesionx[matN] = cohesion;
+	dirtySurfaces = numOfSurfaces;
 }
 
 
@@ -1313,6 +1320,7 @@ void PressureIndependMultiYield::initSurfaceUpdate()
 	  newCenter = devia * (1. - committedSurfaces[i].size() / Ms);
 	  committedSurfaces[i].setCenter(newCenter);
 	}
+	if (committedActiveSurf > dirtySurfaces) dirtySurfaces = committedActiveSurf;
 }
 
 
@@ -1340,6 +1348,7 @@ void PressureIndependMultiYield::paramScaling(void)
 	  size = committedSurfaces[i].size() * conHeig;
 	  committedSurfaces[i] =  MultiYieldSurface(temp,size,plastModul);
 	}
+	dirtySurfaces = numOfSurfaces;
 
 }
 
@@ -1560,6 +1569,7 @@ void PressureIndependMultiYield::updateActiveSurface(void)
 	//center += temp * X;
 	center.addVector(1.0, temp, X);
 	theSurfaces[activeSurfaceNum].setCenter(center);
+	if (activeSurfaceNum > dirtySurfaces) dirtySurfaces = activeSurfaceNum;
 }
 
 
@@ -1583,6 +1593,7 @@ void PressureIndependMultiYield::updateInnerSurface(void)
 
 		theSurfaces[i].setCenter(newcenter);
 	}
+	if (activeSurfaceNum-1 > dirtySurfaces) dirtySurfaces = activeSurfaceNum-1;
 }
 
 
@@ -84,6 +84,7 @@ class ID
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
     friend class MPI_Channel;
+    friend class SharedMemoryChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
     
@@ -149,6 +149,7 @@ class Matrix
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
     friend class MPI_Channel;
+    friend class SharedMemoryChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
 
@@ -120,6 +120,7 @@ class Vector
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;    
     friend class MPI_Channel;
+    friend class SharedMemoryChannel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
     
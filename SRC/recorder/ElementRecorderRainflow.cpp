@@ -0,0 +1,509 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation of
+// ElementRecorderRainflow.
+
+#include <ElementRecorderRainflow.h>
+#include <SummaryRecorderArgs.h>
+#include <RainflowCounter.h>
+#include <Domain.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+#include <elementAPI.h>
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+// recorder ElementRainflow <-file $f|-xml $f|-binary $f|-csv $f> <-precision $p>
+//    -ele $tags | -eleRange $start $end | -region $tag
+//    -SN $K $m | -CoffinManson $E0 $m
+//    <-bins $numBins $maxRange> <-gate $gate> <-dof $cols>
+//    $responseArgs
+//
+// e.g. recorder ElementRainflow -file fat.out -ele 1 -CoffinManson 0.191 -0.458
+//         -dof 2 section 1 fiber 0.0 0.0 stressStrain
+void*
+OPS_ElementRecorderRainflow()
+{
+    if (OPS_GetNumRemainingInputArgs() < 5) {
+        opserr << "WARNING: recorder ElementRainflow ";
+        opserr << "-ele <list elements> -file <fileName> -SN K m|-CoffinManson E0 m response\n";
+        return 0;
+    }
+
+    SummaryRecorderArgs args("ElementRainflow", false);
+
+    const char** data = 0;
+    int nargrem = 0;
+
+    int curveType = -1;
+    double curve[2] = {0.0, 0.0};
+    int numBins = 0;
+    double maxRange = 0.0;
+    double gate = 0.0;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+
+        const char* option = OPS_GetString();
+
+        int res = args.parse(option);
+        if (res < 0) {
+            if (data != 0)
+                delete [] data;
+            return 0;
+        }
+        if (res > 0)
+            continue;
+
+        if (strcmp(option, "-SN") == 0 || strcmp(option, "-CoffinManson") == 0) {
+            int num = 2;
+            if (OPS_GetNumRemainingInputArgs() < 2 || OPS_GetDoubleInput(&num, curve) < 0) {
+                opserr << "WARNING: recorder ElementRainflow - failed to read " << option << " parameters\n";
+                return 0;
+            }
+            if (strcmp(option, "-SN") == 0)
+                curveType = RainflowCounter::SN;
+            else
+                curveType = RainflowCounter::CoffinManson;
+        }
+        else if (strcmp(option, "-bins") == 0) {
+            int num = 1;
+            if (OPS_GetNumRemainingInputArgs() < 2 || OPS_GetIntInput(&num, &numBins) < 0 ||
+                OPS_GetDoubleInput(&num, &maxRange) < 0) {
+                opserr << "WARNING: recorder ElementRainflow - failed to read -bins numBins maxRange\n";
+                return 0;
+            }
+        }
+        else if (strcmp(option, "-gate") == 0) {
+            int num = 1;
+            if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDoubleInput(&num, &gate) < 0) {
+                opserr << "WARNING: recorder ElementRainflow - failed to read gate\n";
+                return 0;
+            }
+        }
+        else {
+            // first unknown string then is assumed to start
+            // element response request
+            nargrem = 1 + OPS_GetNumRemainingInputArgs();
+            data = new const char *[nargrem];
+            data[0] = option;
+            for (int i = 1; i < nargrem; i++)
+                data[i] = OPS_GetString();
+        }
+    }
+
+    if (curveType < 0) {
+        opserr << "WARNING: recorder ElementRainflow - a fatigue curve (-SN or -CoffinManson) is required\n";
+        if (data != 0)
+            delete [] data;
+        return 0;
+    }
+
+    if (nargrem == 0) {
+        opserr << "WARNING: recorder ElementRainflow - no response requested\n";
+        return 0;
+    }
+
+    Domain* domain = OPS_GetDomain();
+    if (domain == 0) {
+        delete [] data;
+        return 0;
+    }
+
+    ElementRecorderRainflow* recorder = new ElementRecorderRainflow(&args.tags,
+        data, nargrem, *domain, *args.createStream(), curveType, curve[0], curve[1],
+        numBins, maxRange, gate, &args.dofs);
+
+    delete [] data;
+
+    return recorder;
+}
+
+
+ElementRecorderRainflow::ElementRecorderRainflow()
+  :Recorder(RECORDER_TAGS_ElementRecorderRainflow),
+   eleTags(0), theDofs(0), theResponses(), theDomain(0),
+   theHandler(0), curveType(0), curveA(0.0), curveB(0.0),
+   numBins(0), maxRange(0.0), gate(0.0), numChannels(0), theCounters(0),
+   initializationDone(false), responseArgs(0), numArgs(0)
+{
+
+}
+
+
+ElementRecorderRainflow::ElementRecorderRainflow(const ID *ele,
+						 const char **argv,
+						 int argc,
+						 Domain &theDom,
+						 OPS_Stream &theOutputHandler,
+						 int type,
+						 double a,
+						 double b,
+						 int nBins,
+						 double maxR,
+						 double g,
+						 const ID *indexValues)
+  :Recorder(RECORDER_TAGS_ElementRecorderRainflow),
+   eleTags(0), theDofs(0), theResponses(), theDomain(&theDom),
+   theHandler(&theOutputHandler), curveType(type), curveA(a), curveB(b),
+   numBins(nBins), maxRange(maxR), gate(g), numChannels(0), theCounters(0),
+   initializationDone(false), responseArgs(0), numArgs(0)
+{
+  if (ele != 0)
+    eleTags = *ele;
+
+  if (indexValues != 0)
+    theDofs = *indexValues;
+
+  //
+  // create a copy of the response request
+  //
+
+  responseArgs = new char *[argc];
+  for (int i=0; i<argc; i++) {
+    responseArgs[i] = new char[strlen(argv[i])+1];
+    strcpy(responseArgs[i], argv[i]);
+  }
+  numArgs = argc;
+}
+
+
+ElementRecorderRainflow::~ElementRecorderRainflow()
+{
+  //
+  // write the summary
+  //
+
+  if (theHandler != 0 && initializationDone == true) {
+    theHandler->tag("Data");
+    Vector row(numChannels);
+    int numRows = this->getNumRows();
+    for (int r=0; r<numRows; r++) {
+      for (int c=0; c<numChannels; c++)
+	row(c) = this->getValue(r, c);
+      theHandler->write(row);
+    }
+    theHandler->endTag(); // Data
+  }
+
+  if (theHandler != 0)
+    delete theHandler;
+
+  if (theCounters != 0)
+    delete [] theCounters;
+
+  for (int i=0; i<numArgs; i++)
+    delete [] responseArgs[i];
+  if (responseArgs != 0)
+    delete [] responseArgs;
+}
+
+
+int
+ElementRecorderRainflow::record(int commitTag, double timeStamp)
+{
+  if (initializationDone == false) {
+    if (this->initialize() != 0) {
+      opserr << "ElementRecorderRainflow::record() - failed to initialize\n";
+      return -1;
+    }
+  }
+
+  int result = theResponses.getResponses();
+
+  for (int i=0; i<numChannels; i++)
+    if (theResponses.isValid(i))
+      theCounters[i].addPoint(theResponses.getValue(i));
+
+  return result;
+}
+
+
+int
+ElementRecorderRainflow::restart(void)
+{
+  for (int i=0; i<numChannels; i++)
+    theCounters[i].reset();
+  return 0;
+}
+
+
+int
+ElementRecorderRainflow::flush(void)
+{
+  if (theHandler != 0)
+    return theHandler->flush();
+  return 0;
+}
+
+
+int
+ElementRecorderRainflow::setDomain(Domain &theDom)
+{
+  theDomain = &theDom;
+  return 0;
+}
+
+
+double
+ElementRecorderRainflow::getRecordedValue(int clmnId, int rowOffset, bool reset)
+{
+  if (initializationDone == false || clmnId < 0 || clmnId >= numChannels)
+    return 0.0;
+  if (rowOffset < 0 || rowOffset >= this->getNumRows())
+    return 0.0;
+
+  double res = this->getValue(rowOffset, clmnId);
+  if (reset)
+    theCounters[clmnId].reset();
+
+  return res;
+}
+
+
+int
+ElementRecorderRainflow::getNumRows(void) const
+{
+  return 3 + numBins;
+}
+
+
+double
+ElementRecorderRainflow::getValue(int row, int channel) const
+{
+  const RainflowCounter &theCounter = theCounters[channel];
+
+  switch (row) {
+  case 0: return theCounter.getDamage();
+  case 1: return theCounter.getNumCycles();
+  case 2: return theCounter.getMaxRange();
+  default:
+    break;
+  }
+
+  row -= 3;
+  if (row < numBins) {
+    static Vector counts(0);
+    theCounter.getHistogram(counts);
+    return counts(row);
+  }
+
+  return 0.0;
+}
+
+
+int
+ElementRecorderRainflow::sendSelf(int commitTag, Channel &theChannel)
+{
+  if (theChannel.isDatastore() == 1) {
+    opserr << "ElementRecorderRainflow::sendSelf() - does not send data to a datastore\n";
+    return -1;
+  }
+
+  initializationDone = false;
+
+  static ID idData(7);
+  idData(0) = eleTags.Size();
+  idData(1) = numArgs;
+
+  int msgLength = 0;
+  for (int i=0; i<numArgs; i++)
+    msgLength += strlen(responseArgs[i])+1;
+  idData(2) = msgLength;
+
+  idData(3) = (theHandler != 0) ? theHandler->getClassTag() : 0;
+  idData(4) = curveType;
+  idData(5) = theDofs.Size();
+  idData(6) = numBins;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "ElementRecorderRainflow::sendSelf() - failed to send idData\n";
+    return -1;
+  }
+
+  static Vector dData(4);
+  dData(0) = curveA;
+  dData(1) = curveB;
+  dData(2) = maxRange;
+  dData(3) = gate;
+  if (theChannel.sendVector(0, commitTag, dData) < 0) {
+    opserr << "ElementRecorderRainflow::sendSelf() - failed to send dData\n";
+    return -1;
+  }
+
+  if (eleTags.Size() != 0 && theChannel.sendID(0, commitTag, eleTags) < 0) {
+    opserr << "ElementRecorderRainflow::sendSelf() - failed to send eleTags\n";
+    return -1;
+  }
+
+  if (theDofs.Size() != 0 && theChannel.sendID(0, commitTag, theDofs) < 0) {
+    opserr << "ElementRecorderRainflow::sendSelf() - failed to send dofs\n";
+    return -1;
+  }
+
+  //
+  // send all the response args as a single char array
+  //
+
+  char *allResponseArgs = new char[msgLength];
+  char *currentLoc = allResponseArgs;
+  for (int j=0; j<numArgs; j++) {
+    strcpy(currentLoc, responseArgs[j]);
+    currentLoc += strlen(responseArgs[j])+1;
+  }
+
+  Message theMessage(allResponseArgs, msgLength);
+  if (theChannel.sendMsg(0, commitTag, theMessage) < 0) {
+    opserr << "ElementRecorderRainflow::sendSelf() - failed to send message\n";
+    delete [] allResponseArgs;
+    return -1;
+  }
+  delete [] allResponseArgs;
+
+  if (theHandler == 0 || theHandler->sendSelf(commitTag, theChannel) < 0) {
+    opserr << "ElementRecorderRainflow::sendSelf() - failed to send the DataOutputHandler\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+ElementRecorderRainflow::recvSelf(int commitTag, Channel &theChannel,
+				  FEM_ObjectBroker &theBroker)
+{
+  if (theChannel.isDatastore() == 1) {
+    opserr << "ElementRecorderRainflow::recvSelf() - does not recv data from a datastore\n";
+    return -1;
+  }
+
+  if (responseArgs != 0) {
+    for (int i=0; i<numArgs; i++)
+      delete [] responseArgs[i];
+    delete [] responseArgs;
+    responseArgs = 0;
+  }
+
+  static ID idData(7);
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "ElementRecorderRainflow::recvSelf() - failed to recv idData\n";
+    return -1;
+  }
+
+  int numEle = idData(0);
+  numArgs = idData(1);
+  int msgLength = idData(2);
+  curveType = idData(4);
+  int numDOF = idData(5);
+  numBins = idData(6);
+
+  static Vector dData(4);
+  if (theChannel.recvVector(0, commitTag, dData) < 0) {
+    opserr << "ElementRecorderRainflow::recvSelf() - failed to recv dData\n";
+    return -1;
+  }
+  curveA = dData(0);
+  curveB = dData(1);
+  maxRange = dData(2);
+  gate = dData(3);
+
+  eleTags.resize(numEle);
+  if (numEle != 0 && theChannel.recvID(0, commitTag, eleTags) < 0) {
+    opserr << "ElementRecorderRainflow::recvSelf() - failed to recv eleTags\n";
+    return -1;
+  }
+
+  theDofs.resize(numDOF);
+  if (numDOF != 0 && theChannel.recvID(0, commitTag, theDofs) < 0) {
+    opserr << "ElementRecorderRainflow::recvSelf() - failed to recv dofs\n";
+    return -1;
+  }
+
+  char *allResponseArgs = new char[msgLength];
+  Message theMessage(allResponseArgs, msgLength);
+  if (theChannel.recvMsg(0, commitTag, theMessage) < 0) {
+    opserr << "ElementRecorderRainflow::recvSelf() - failed to recv message\n";
+    delete [] allResponseArgs;
+    return -1;
+  }
+
+  responseArgs = new char *[numArgs];
+  char *currentLoc = allResponseArgs;
+  for (int j=0; j<numArgs; j++) {
+    int argLength = strlen(currentLoc)+1;
+    responseArgs[j] = new char[argLength];
+    strcpy(responseArgs[j], currentLoc);
+    currentLoc += argLength;
+  }
+  delete [] allResponseArgs;
+
+  if (theHandler != 0)
+    delete theHandler;
+
+  theHandler = theBroker.getPtrNewStream(idData(3));
+  if (theHandler == 0) {
+    opserr << "ElementRecorderRainflow::recvSelf() - failed to get a data output handler\n";
+    return -1;
+  }
+
+  if (theHandler->recvSelf(commitTag, theChannel, theBroker) < 0) {
+    opserr << "ElementRecorderRainflow::recvSelf() - failed to recv the DataOutputHandler\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+ElementRecorderRainflow::initialize(void)
+{
+  if (theDomain == 0) {
+    opserr << "ElementRecorderRainflow::initialize() - no domain has been set\n";
+    return -1;
+  }
+
+  theResponses.setResponses(*theDomain, eleTags, theDofs,
+			    (const char **)responseArgs, numArgs, *theHandler);
+  numChannels = theResponses.getNumChannels();
+
+  if (theCounters != 0)
+    delete [] theCounters;
+  theCounters = 0;
+
+  if (numChannels > 0) {
+    theCounters = new RainflowCounter[numChannels];
+    for (int i=0; i<numChannels; i++) {
+      theCounters[i].setCurve(curveType, curveA, curveB);
+      theCounters[i].setHistogram(numBins, maxRange);
+      theCounters[i].setGate(gate);
+    }
+  }
+
+  initializationDone = true;
+  return 0;
+}
@@ -0,0 +1,103 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ElementRecorderRainflow_h
+#define ElementRecorderRainflow_h
+
+// Description: This file contains the class definition for
+// ElementRecorderRainflow. The recorder streams every component of an
+// element response (typically a fiber or material strain, obtained through
+// the element's setResponse()) through a RainflowCounter and, when it is
+// destroyed, writes only the fatigue summary for each component:
+//   row 1: Miner's damage
+//   row 2: number of cycles
+//   row 3: largest cycle range
+//   row 4..: cycle count in each histogram bin (if -bins is given)
+// The open residue of each signal is counted as half cycles.
+
+#include <Recorder.h>
+#include <ElementResponseSet.h>
+#include <OPS_Globals.h>
+#include <ID.h>
+
+class Domain;
+class RainflowCounter;
+
+class ElementRecorderRainflow: public Recorder
+{
+  public:
+    ElementRecorderRainflow();
+    ElementRecorderRainflow(const ID *eleID,
+			    const char **argv,
+			    int argc,
+			    Domain &theDomain,
+			    OPS_Stream &theOutputHandler,
+			    int curveType,
+			    double curveA,
+			    double curveB,
+			    int numBins = 0,
+			    double maxRange = 0.0,
+			    double gate = 0.0,
+			    const ID *dof =0);
+
+    ~ElementRecorderRainflow();
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+    int flush(void);
+
+    int setDomain(Domain &theDomain);
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+    double getRecordedValue(int clmnId, int rowOffset, bool reset);
+
+  protected:
+
+  private:
+    int initialize(void);
+    int getNumRows(void) const;
+    double getValue(int row, int channel) const;
+
+    ID eleTags;   // empty: every element that answers the request
+    ID theDofs;   // empty: every component of the responses
+
+    ElementResponseSet theResponses;
+
+    Domain *theDomain;
+    OPS_Stream *theHandler;
+
+    int curveType;
+    double curveA;
+    double curveB;
+    int numBins;
+    double maxRange;
+    double gate;
+
+    int numChannels;
+    RainflowCounter *theCounters;
+
+    bool initializationDone;
+    char **responseArgs;
+    int numArgs;
+};
+
+
+#endif
@@ -0,0 +1,187 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation of
+// ElementResponseSet.
+
+#include <ElementResponseSet.h>
+#include <Domain.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <Response.h>
+#include <Information.h>
+#include <OPS_Stream.h>
+
+ElementResponseSet::ElementResponseSet()
+  :theResponses(0), numResponses(0), numResponseChannels(0), theDofs(0),
+   numChannels(0), theValues(0), validValues(0)
+{
+
+}
+
+
+ElementResponseSet::~ElementResponseSet()
+{
+  this->clearAll();
+}
+
+
+void
+ElementResponseSet::clearAll(void)
+{
+  if (theResponses != 0) {
+    for (int i=0; i<numResponses; i++)
+      if (theResponses[i] != 0)
+	delete theResponses[i];
+    delete [] theResponses;
+  }
+
+  theResponses = 0;
+  numResponses = 0;
+  numChannels = 0;
+}
+
+
+int
+ElementResponseSet::setResponses(Domain &theDomain, const ID &eleTags,
+				 const ID &dofs, const char **argv, int argc,
+				 OPS_Stream &theHandler)
+{
+  this->clearAll();
+
+  theDofs = dofs;
+  int numDOF = theDofs.Size();
+
+  ID responseOrder(0,64);
+
+  if (eleTags.Size() != 0) {
+
+    numResponses = eleTags.Size();
+
+    ID xmlOrder(0,64);
+    int eleCount = 0;
+    for (int i=0; i<numResponses; i++)
+      if (theDomain.getElement(eleTags(i)) != 0)
+	xmlOrder[eleCount++] = i+1;
+
+    theHandler.setOrder(xmlOrder);
+
+    theResponses = new Response *[numResponses];
+    numResponseChannels.resize(numResponses);
+    for (int i=0; i<numResponses; i++) {
+      theResponses[i] = 0;
+      numResponseChannels(i) = 0;
+
+      Element *theEle = theDomain.getElement(eleTags(i));
+      if (theEle == 0)
+	continue;
+
+      theResponses[i] = theEle->setResponse(argv, argc, theHandler);
+      if (theResponses[i] == 0)
+	continue;
+
+      int dataSize = theResponses[i]->getInformation().getData().Size();
+      int numCols = (numDOF == 0) ? dataSize : numDOF;
+      numResponseChannels(i) = numCols;
+      for (int j=0; j<numCols; j++)
+	responseOrder[numChannels++] = i+1;
+    }
+
+  } else {
+
+    // no element list: every element that answers the request
+    int capacity = 64;
+    theResponses = new Response *[capacity];
+    numResponseChannels = ID(0,64);
+
+    ElementIter &theElements = theDomain.getElements();
+    Element *theEle;
+    while ((theEle = theElements()) != 0) {
+      Response *theResponse = theEle->setResponse(argv, argc, theHandler);
+      if (theResponse == 0)
+	continue;
+
+      if (numResponses == capacity) {
+	Response **theNextResponses = new Response *[2*capacity];
+	for (int i=0; i<numResponses; i++)
+	  theNextResponses[i] = theResponses[i];
+	delete [] theResponses;
+	theResponses = theNextResponses;
+	capacity *= 2;
+      }
+      theResponses[numResponses] = theResponse;
+
+      int dataSize = theResponse->getInformation().getData().Size();
+      int numCols = (numDOF == 0) ? dataSize : numDOF;
+      numResponseChannels[numResponses++] = numCols;
+      for (int j=0; j<numCols; j++)
+	responseOrder[numChannels++] = numResponses;
+    }
+  }
+
+  theHandler.setOrder(responseOrder);
+
+  theValues.resize(numChannels);
+  theValues.Zero();
+  validValues.resize(numChannels);
+  validValues.Zero();
+
+  return 0;
+}
+
+
+int
+ElementResponseSet::getResponses(void)
+{
+  int result = 0;
+  int loc = 0;
+  int numDOF = theDofs.Size();
+
+  for (int i=0; i<numResponses; i++) {
+    if (theResponses[i] == 0)
+      continue;
+
+    int numCols = numResponseChannels(i);
+
+    int res = theResponses[i]->getResponse();
+    if (res < 0) {
+      result += res;
+      for (int j=0; j<numCols; j++)
+	validValues(loc+j) = 0;
+      loc += numCols;
+      continue;
+    }
+
+    const Vector &eleData = theResponses[i]->getInformation().getData();
+    int dataSize = eleData.Size();
+
+    for (int j=0; j<numCols; j++) {
+      int index = (numDOF == 0) ? j : theDofs(j);
+      if (index >= 0 && index < dataSize) {
+	theValues(loc+j) = eleData(index);
+	validValues(loc+j) = 1;
+      } else
+	validValues(loc+j) = 0;
+    }
+    loc += numCols;
+  }
+
+  return result;
+}
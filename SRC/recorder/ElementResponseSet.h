@@ -0,0 +1,74 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef ElementResponseSet_h
+#define ElementResponseSet_h
+
+// Description: This file contains the class definition for
+// ElementResponseSet. An ElementResponseSet holds the Response objects a
+// recorder obtains from the elements for one response request and gathers
+// their data, one value per channel, at each record. A channel is one
+// component of one element response, or one of the requested components
+// when a dof list is given. It is used by the recorders that reduce every
+// channel over the analysis (ElementRecorderRainflow, StatisticsRecorder).
+
+#include <ID.h>
+#include <Vector.h>
+
+class Domain;
+class Response;
+class OPS_Stream;
+
+class ElementResponseSet
+{
+  public:
+    ElementResponseSet();
+    ~ElementResponseSet();
+
+    // asks the elements in eleTags, or every element that answers the
+    // request if eleTags is empty, for the response given by argv; dofs
+    // selects the components of each response, all of them if empty
+    int setResponses(Domain &theDomain, const ID &eleTags, const ID &dofs,
+		     const char **argv, int argc, OPS_Stream &theHandler);
+
+    // updates the data of every response; returns the sum of the
+    // negative results of the elements
+    int getResponses(void);
+
+    int getNumChannels(void) const {return numChannels;}
+    double getValue(int channel) const {return theValues(channel);}
+    // false if the element failed to give its response or the requested
+    // component is not in its data
+    bool isValid(int channel) const {return validValues(channel) != 0;}
+
+  private:
+    void clearAll(void);
+
+    Response **theResponses;
+    int numResponses;
+    ID numResponseChannels;
+    ID theDofs;
+
+    int numChannels;
+    Vector theValues;
+    ID validValues;
+};
+
+#endif
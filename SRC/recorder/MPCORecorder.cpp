@@ -385,6 +385,8 @@ private:
 		MPCO_LIBLOADER_LOAD_SYM(H5Pclose);
 		MPCO_LIBLOADER_LOAD_SYM(H5Pset_link_creation_order);
 		MPCO_LIBLOADER_LOAD_SYM(H5Pset_libver_bounds);
+		MPCO_LIBLOADER_LOAD_SYM(H5Pset_chunk);
+		MPCO_LIBLOADER_LOAD_SYM(H5Pset_deflate);
 		MPCO_LIBLOADER_LOAD_SYM(H5Fcreate);
 		MPCO_LIBLOADER_LOAD_SYM(H5Fflush);
 		MPCO_LIBLOADER_LOAD_SYM(H5Fclose);
@@ -401,6 +403,7 @@ private:
 		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_FILE_CREATE_ID_g);
 		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_FILE_ACCESS_ID_g);
 		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_GROUP_CREATE_ID_g);
+		MPCO_LIBLOADER_LOAD_SYM(H5P_CLS_DATASET_CREATE_ID_g);
 	}
 	~LibraryLoader() {
 		if (loaded) {
@@ -443,6 +446,8 @@ public:
 	herr_t (*ptr_H5Pclose)(hid_t plist_id);
 	herr_t (*ptr_H5Pset_link_creation_order)(hid_t plist_id, unsigned crt_order_flags);
 	herr_t (*ptr_H5Pset_libver_bounds)(hid_t plist_id, H5F_libver_t low, H5F_libver_t high);
+	herr_t (*ptr_H5Pset_chunk)(hid_t plist_id, int ndims, const hsize_t dim[]);
+	herr_t (*ptr_H5Pset_deflate)(hid_t plist_id, unsigned level);
 	hid_t  (*ptr_H5Fcreate)(const char *filename, unsigned flags, hid_t create_plist, hid_t access_plist);
 	herr_t (*ptr_H5Fflush)(hid_t object_id, H5F_scope_t scope);
 	herr_t (*ptr_H5Fclose)(hid_t file_id);
@@ -459,6 +464,7 @@ public:
 	hid_t *ptr_H5P_CLS_FILE_CREATE_ID_g;
 	hid_t *ptr_H5P_CLS_FILE_ACCESS_ID_g;
 	hid_t *ptr_H5P_CLS_GROUP_CREATE_ID_g;
+	hid_t *ptr_H5P_CLS_DATASET_CREATE_ID_g;
 };
 
 /*
@@ -497,6 +503,8 @@ macros for loaded HDF5 functions
 #define H5Pclose (*LibraryLoader::instance().ptr_H5Pclose)
 #define H5Pset_link_creation_order (*LibraryLoader::instance().ptr_H5Pset_link_creation_order)
 #define H5Pset_libver_bounds (*LibraryLoader::instance().ptr_H5Pset_libver_bounds)
+#define H5Pset_chunk (*LibraryLoader::instance().ptr_H5Pset_chunk)
+#define H5Pset_deflate (*LibraryLoader::instance().ptr_H5Pset_deflate)
 
 #define H5Fcreate (*LibraryLoader::instance().ptr_H5Fcreate)
 #define H5Fflush (*LibraryLoader::instance().ptr_H5Fflush)
@@ -525,6 +533,8 @@ macros for loaded HDF5 global variables
 #define H5P_FILE_ACCESS (H5OPEN H5P_CLS_FILE_ACCESS_ID_g)
 #define H5P_CLS_GROUP_CREATE_ID_g (*LibraryLoader::instance().ptr_H5P_CLS_GROUP_CREATE_ID_g)
 #define H5P_GROUP_CREATE (H5OPEN H5P_CLS_GROUP_CREATE_ID_g)
+#define H5P_CLS_DATASET_CREATE_ID_g (*LibraryLoader::instance().ptr_H5P_CLS_DATASET_CREATE_ID_g)
+#define H5P_DATASET_CREATE (H5OPEN H5P_CLS_DATASET_CREATE_ID_g)
 
 /*
 some other useful things defined in HDF5 headers
@@ -1069,6 +1079,31 @@ namespace h5 {
 			status = H5Sclose(space);
 			return dset;
 		}
+		hid_t createAndWriteChunkedd2(hid_t obj, const char *name, const double *data, hsize_t rows, hsize_t cols, int compression)
+		{
+			// create the dataspace
+			hsize_t dim[2] = { rows, cols };
+			hid_t space = H5Screate_simple(2, dim, NULL);
+			// chunk whole rows, about 256 KiB per chunk, and compress them
+			hsize_t chunk_rows = 32768 / (cols > 0 ? cols : 1);
+			if (chunk_rows < 1) chunk_rows = 1;
+			if (chunk_rows > rows) chunk_rows = rows;
+			hsize_t chunk[2] = { chunk_rows, cols };
+			hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+			if (H5Pset_chunk(dcpl, 2, chunk) < 0 || H5Pset_deflate(dcpl, (unsigned)compression) < 0) {
+				// the filter is not available, write a contiguous dataset
+				H5Pclose(dcpl);
+				dcpl = H5P_DEFAULT;
+			}
+			// create the dataset and write data to it.
+			hid_t dset = H5Dcreate(obj, name, H5T_IEEE_F64LE, space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+			H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+			// close and release resources
+			if (dcpl != H5P_DEFAULT)
+				H5Pclose(dcpl);
+			H5Sclose(space);
+			return dset;
+		}
 		hid_t createAndWritei1(hid_t obj, const char *name, const int *data, hsize_t data_size)
 		{
 			// error flags
@@ -1135,6 +1170,16 @@ namespace h5 {
 			}
 			return HID_INVALID;
 		}
+		hid_t createAndWriteStep(hid_t obj, const char *name, const std::vector<double> &data, size_t rows, size_t cols, int compression)
+		{
+			// step results are the bulk of the file: optionally store them chunked and compressed
+			if (compression <= 0)
+				return createAndWrite(obj, name, data, rows, cols);
+			if (data.size() > 0 && data.size() == rows*cols) {
+				return createAndWriteChunkedd2(obj, name, &data[0], rows, cols, compression);
+			}
+			return HID_INVALID;
+		}
 		hid_t createAndWrite(hid_t obj, const char *name, int data)
 		{
 			return createAndWritei1(obj, name, &data, 1);
@@ -1423,6 +1468,18 @@ namespace mpco {
 		clock_t m_t1;
 	};
 
+	/*
+	a step result kept in memory until the staging buffer is written
+	*/
+	struct StagedStep {
+		std::string name;
+		std::vector<double> data;
+		size_t rows;
+		size_t cols;
+		int step_id;
+		double time;
+	};
+
 	/*
 	holds current information
 	*/
@@ -1444,6 +1501,11 @@ namespace mpco {
 			// time step info
 			, current_time_step_id(0)
 			, current_time_step(0.0)
+			// output options
+			, compression_level(0)
+			, buffer_steps(1)
+			, num_buffered_records(0)
+			, staged_steps()
 			// misc
 			, eigen_first_initialization_done(false)
 			, record_eigen_on_this_step(false)
@@ -1465,6 +1527,11 @@ namespace mpco {
 		// time step info
 		int current_time_step_id;
 		double current_time_step;
+		// output options
+		int compression_level; // deflate level (0 = contiguous, uncompressed) for step results
+		int buffer_steps; // number of recorded steps kept in memory before they are written (1 = write every step)
+		int num_buffered_records; // recorded steps currently kept in memory
+		std::vector<StagedStep> staged_steps; // step results waiting to be written
 		// misc
 		bool eigen_first_initialization_done;
 		bool record_eigen_on_this_step;
@@ -1472,6 +1539,56 @@ namespace mpco {
 		Vector eigen_last_values;
 	};
 
+	/*
+	writes the dataset of a step result with its STEP and TIME attributes
+	*/
+	inline int writeStepNow(ProcessInfo &info, const std::string &name, const std::vector<double> &data,
+		size_t rows, size_t cols, int step_id, double time)
+	{
+		hid_t h_dset_data = h5::dataset::createAndWriteStep(info.h_file_id, name.c_str(), data, rows, cols, info.compression_level);
+		if (h_dset_data < 0)
+			return -1;
+		herr_t status = h5::attribute::write(h_dset_data, "STEP", step_id);
+		status = h5::attribute::write(h_dset_data, "TIME", time);
+		status = h5::dataset::close(h_dset_data);
+		return status < 0 ? -1 : 0;
+	}
+
+	/*
+	writes a step result, or keeps it in the staging buffer if more than
+	one step is buffered. data is taken over in that case
+	*/
+	inline int writeStep(ProcessInfo &info, const std::string &name, std::vector<double> &data, size_t rows, size_t cols)
+	{
+		if (info.buffer_steps <= 1)
+			return writeStepNow(info, name, data, rows, cols, info.current_time_step_id, info.current_time_step);
+		info.staged_steps.push_back(StagedStep());
+		StagedStep &item = info.staged_steps.back();
+		item.name = name;
+		item.data.swap(data);
+		item.rows = rows;
+		item.cols = cols;
+		item.step_id = info.current_time_step_id;
+		item.time = info.current_time_step;
+		return 0;
+	}
+
+	/*
+	writes all the step results of the staging buffer, in the order they were recorded
+	*/
+	inline int writeStagedSteps(ProcessInfo &info)
+	{
+		int retval = 0;
+		for (size_t i = 0; i < info.staged_steps.size(); i++) {
+			const StagedStep &item = info.staged_steps[i];
+			if (writeStepNow(info, item.name, item.data, item.rows, item.cols, item.step_id, item.time) < 0)
+				retval = -1;
+		}
+		info.staged_steps.clear();
+		info.num_buffered_records = 0;
+		return retval;
+	}
+
 }
 
 /*utilities for node results*/
@@ -1546,10 +1663,8 @@ namespace mpco {
 				std::stringstream ss_dset_name;
 				ss_dset_name << m_result_name << "/DATA/STEP_" << info.current_time_step_id;
 				std::string dset_name = ss_dset_name.str();
-				hid_t h_dset_data = h5::dataset::createAndWrite(info.h_file_id, dset_name.c_str(), buffer_data, nodes.size(), m_num_components);
-				status = h5::attribute::write(h_dset_data, "STEP", info.current_time_step_id);
-				status = h5::attribute::write(h_dset_data, "TIME", info.current_time_step);
-				status = h5::dataset::close(h_dset_data);
+				if (mpco::writeStep(info, dset_name, buffer_data, nodes.size(), m_num_components) < 0)
+					retval = -1;
 				/*
 				return
 				*/
@@ -2171,7 +2286,7 @@ namespace mpco {
 					std::stringstream ss_dset_name;
 					ss_dset_name << "MODE_" << k;
 					std::string dset_name = ss_dset_name.str();
-					hid_t h_dset_data = h5::dataset::createAndWrite(h_gp_step, dset_name.c_str(), buffer, nodes.size(), m_num_components);
+					hid_t h_dset_data = h5::dataset::createAndWriteStep(h_gp_step, dset_name.c_str(), buffer, nodes.size(), m_num_components, info.compression_level);
 					status = h5::attribute::write(h_dset_data, "MODE", k);
 					status = h5::attribute::write(h_dset_data, "LAMBDA", lambda);
 					status = h5::attribute::write(h_dset_data, "OMEGA", omega);
@@ -4488,6 +4603,12 @@ MPCORecorder::~MPCORecorder()
 		*/
 		herr_t status;
 		/*
+		write the steps still in the staging buffer
+		*/
+		if (mpco::writeStagedSteps(m_data->info) < 0) {
+			opserr << "MPCORecorder Error: cannot write the buffered steps on destructor\n";
+		}
+		/*
 		close file
 		*/
 		status = h5::file::close(m_data->info.h_file_id);
@@ -4606,6 +4727,13 @@ int MPCORecorder::record(int commitTag, double timeStamp)
 		}
 	}
 	if (rebuild_model) {
+		/*
+		the buffered steps belong to the previous model stage
+		*/
+		if (mpco::writeStagedSteps(m_data->info) < 0) {
+			opserr << "MPCRecorder Error: cannot write the buffered steps\n";
+			return -1;
+		}
 		retval = writeModel();
 		if (retval) {
 			opserr << "MPCRecorder Error: cannot write model\n";
@@ -4629,6 +4757,19 @@ int MPCORecorder::record(int commitTag, double timeStamp)
 		return retval;
 	}
 	/*
+	with a staging buffer, write the buffered steps and flush the file
+	only once every buffer_steps recorded steps
+	*/
+	if (m_data->info.buffer_steps > 1) {
+		m_data->info.num_buffered_records++;
+		if (m_data->info.num_buffered_records < m_data->info.buffer_steps)
+			return retval;
+		if (mpco::writeStagedSteps(m_data->info) < 0) {
+			opserr << "MPCORecorder Error: cannot write the buffered steps on record()\n";
+			return -1;
+		}
+	}
+	/*
 	flush file
 	*/ 
 	status = h5::file::flush(m_data->info.h_file_id);
@@ -4702,6 +4843,9 @@ int MPCORecorder::sendSelf(int commitTag, Channel &theChannel)
 		<< m_data->output_freq.type
 		<< m_data->output_freq.dt
 		<< m_data->output_freq.nsteps
+		// output options
+		<< m_data->info.compression_level
+		<< m_data->info.buffer_steps
 		// node result requests
 		<< m_data->nodal_results_requests
 		// node result requests (sens grad indices)
@@ -4793,6 +4937,9 @@ int MPCORecorder::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
 		>> m_data->output_freq.type
 		>> m_data->output_freq.dt
 		>> m_data->output_freq.nsteps
+		// output options
+		>> m_data->info.compression_level
+		>> m_data->info.buffer_steps
 		// node result requests
 		>> m_data->nodal_results_requests
 		// node result requests (sens grad indices)
@@ -6620,10 +6767,8 @@ int MPCORecorder::recordResultsOnElements()
 							for (size_t j = 0; j < header.num_columns; j++)
 								buffer_data[offset + j] = current_data[(int)j];
 						}
-						hid_t h_dset_data = h5::dataset::createAndWrite(m_data->info.h_file_id, dset_name.c_str(), buffer_data, num_rows, header.num_columns);
-						status = h5::attribute::write(h_dset_data, "STEP", m_data->info.current_time_step_id);
-						status = h5::attribute::write(h_dset_data, "TIME", m_data->info.current_time_step);
-						status = h5::dataset::close(h_dset_data);
+						if (mpco::writeStep(m_data->info, dset_name, buffer_data, num_rows, header.num_columns) < 0)
+							retval = -1;
 					}
 				}
 			}
@@ -6697,6 +6842,8 @@ void* OPS_MPCORecorder()
 	std::set<int> node_set;
 	std::set<int> elem_set;
 	int one_item = 1;
+	int compression_level = 0;
+	int buffer_steps = 1;
 
 	while (numdata > 0) {
 		const char* data = OPS_GetString();
@@ -6742,6 +6889,25 @@ void* OPS_MPCORecorder()
 			}
 			has_region = true;
 		}
+		else if (strcmp(data, "-compress") == 0) {
+			// store step results chunked and deflate-compressed (level 1-9)
+			if (numdata < 1 || OPS_GetInt(&one_item, &compression_level) != 0) {
+				opserr << "MPCORecorder error: option -compress requires an extra parameter (int) for the compression level\n";
+				return 0;
+			}
+			numdata--;
+			if (compression_level < 0) compression_level = 0;
+			if (compression_level > 9) compression_level = 9;
+		}
+		else if (strcmp(data, "-buffer") == 0) {
+			// keep the results of N recorded steps in memory and write them (and flush the file) together
+			if (numdata < 1 || OPS_GetInt(&one_item, &buffer_steps) != 0) {
+				opserr << "MPCORecorder error: option -buffer requires an extra parameter (int) for the number of steps\n";
+				return 0;
+			}
+			numdata--;
+			if (buffer_steps < 1) buffer_steps = 1;
+		}
 		else {
 			switch (curr_opt)
 			{
@@ -6881,6 +7047,8 @@ void* OPS_MPCORecorder()
 	MPCORecorder *new_recorder = new MPCORecorder();
 	new_recorder->m_data->filename = filename;
 	new_recorder->m_data->output_freq = output_freq;
+	new_recorder->m_data->info.compression_level = compression_level;
+	new_recorder->m_data->info.buffer_steps = buffer_steps;
 	new_recorder->m_data->nodal_results_requests.swap(nodal_results_requests);
 	new_recorder->m_data->sens_grad_indices.swap(sens_grad_indices);
 	new_recorder->m_data->elemental_results_requests.swap(elemental_results_requests);
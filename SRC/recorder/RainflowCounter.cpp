@@ -0,0 +1,259 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of RainflowCounter.
+
+#include <RainflowCounter.h>
+#include <Vector.h>
+#include <math.h>
+
+RainflowCounter::RainflowCounter()
+  :curveType(SN), curveA(0.0), curveB(0.0),
+   numBins(0), binWidth(0.0), bins(0),
+   stack(0), stackSize(0), stackCapacity(0), candidate(0.0), direction(0),
+   started(false), gate(0.0),
+   damage(0.0), numCycles(0.0), maxRange(0.0)
+{
+
+}
+
+RainflowCounter::~RainflowCounter()
+{
+  if (bins != 0)
+    delete [] bins;
+  if (stack != 0)
+    delete [] stack;
+}
+
+void
+RainflowCounter::setCurve(int type, double a, double b)
+{
+  curveType = type;
+  curveA = a;
+  curveB = b;
+}
+
+void
+RainflowCounter::setHistogram(int nBins, double range)
+{
+  if (bins != 0)
+    delete [] bins;
+  bins = 0;
+  numBins = 0;
+  binWidth = 0.0;
+
+  if (nBins > 0 && range > 0.0) {
+    numBins = nBins;
+    binWidth = range/nBins;
+    bins = new double[numBins];
+    for (int i=0; i<numBins; i++)
+      bins[i] = 0.0;
+  }
+}
+
+void
+RainflowCounter::setGate(double g)
+{
+  gate = fabs(g);
+}
+
+void
+RainflowCounter::reset(void)
+{
+  stackSize = 0;
+  candidate = 0.0;
+  direction = 0;
+  started = false;
+  damage = 0.0;
+  numCycles = 0.0;
+  maxRange = 0.0;
+  for (int i=0; i<numBins; i++)
+    bins[i] = 0.0;
+}
+
+void
+RainflowCounter::addPoint(double value)
+{
+  if (started == false) {
+    started = true;
+    this->pushReversal(value);
+    candidate = value;
+    direction = 0;
+    return;
+  }
+
+  if (direction == 0) {
+    // still looking for the first excursion out of the start point
+    if (value - candidate > gate) {
+      direction = 1;
+      candidate = value;
+    } else if (candidate - value > gate) {
+      direction = -1;
+      candidate = value;
+    }
+  } else if (direction > 0) {
+    if (value >= candidate)
+      candidate = value;
+    else if (candidate - value > gate) {
+      this->pushReversal(candidate);
+      direction = -1;
+      candidate = value;
+    }
+  } else {
+    if (value <= candidate)
+      candidate = value;
+    else if (value - candidate > gate) {
+      this->pushReversal(candidate);
+      direction = 1;
+      candidate = value;
+    }
+  }
+}
+
+void
+RainflowCounter::pushReversal(double value)
+{
+  if (stackSize == stackCapacity) {
+    int newCapacity = (stackCapacity == 0) ? 16 : 2*stackCapacity;
+    double *newStack = new double[newCapacity];
+    for (int i=0; i<stackSize; i++)
+      newStack[i] = stack[i];
+    if (stack != 0)
+      delete [] stack;
+    stack = newStack;
+    stackCapacity = newCapacity;
+  }
+  stack[stackSize++] = value;
+
+  // four-point rule: the inner range closes a cycle if it is contained
+  // in both of its neighbours; the two inner reversals are then removed
+  while (stackSize >= 4) {
+    double s1 = stack[stackSize-4];
+    double s2 = stack[stackSize-3];
+    double s3 = stack[stackSize-2];
+    double s4 = stack[stackSize-1];
+    double X = fabs(s3-s2);
+    if (X <= fabs(s2-s1) && X <= fabs(s4-s3)) {
+      this->countCycle(X, 1.0);
+      stack[stackSize-3] = s4;
+      stackSize -= 2;
+    } else
+      break;
+  }
+}
+
+void
+RainflowCounter::countCycle(double range, double count)
+{
+  numCycles += count;
+  damage += count*this->cycleDamage(range);
+  if (range > maxRange)
+    maxRange = range;
+  int bin = this->binIndex(range);
+  if (bin >= 0)
+    bins[bin] += count;
+}
+
+double
+RainflowCounter::cycleDamage(double range) const
+{
+  if (range <= 0.0)
+    return 0.0;
+
+  if (curveType == CoffinManson) {
+    if (curveA == 0.0 || curveB == 0.0)
+      return 0.0;
+    double N = fabs(pow(range/curveA, 1.0/curveB));
+    return (N > 0.0) ? 1.0/N : 0.0;
+  }
+
+  if (curveA <= 0.0)
+    return 0.0;
+  return pow(range, curveB)/curveA;
+}
+
+int
+RainflowCounter::binIndex(double range) const
+{
+  if (numBins == 0)
+    return -1;
+  int bin = (int)(range/binWidth);
+  if (bin >= numBins)
+    bin = numBins-1;
+  return bin;
+}
+
+double
+RainflowCounter::getDamage(bool withResidue) const
+{
+  double result = damage;
+  if (withResidue && started) {
+    for (int i=1; i<stackSize; i++)
+      result += 0.5*this->cycleDamage(fabs(stack[i]-stack[i-1]));
+    if (direction != 0)
+      result += 0.5*this->cycleDamage(fabs(candidate-stack[stackSize-1]));
+  }
+  return result;
+}
+
+double
+RainflowCounter::getNumCycles(bool withResidue) const
+{
+  double result = numCycles;
+  if (withResidue && started) {
+    result += 0.5*(stackSize-1);
+    if (direction != 0)
+      result += 0.5;
+  }
+  return result;
+}
+
+double
+RainflowCounter::getMaxRange(bool withResidue) const
+{
+  double result = maxRange;
+  if (withResidue && started) {
+    for (int i=1; i<stackSize; i++)
+      if (fabs(stack[i]-stack[i-1]) > result)
+	result = fabs(stack[i]-stack[i-1]);
+    if (direction != 0 && fabs(candidate-stack[stackSize-1]) > result)
+      result = fabs(candidate-stack[stackSize-1]);
+  }
+  return result;
+}
+
+int
+RainflowCounter::getHistogram(Vector &counts, bool withResidue) const
+{
+  if (counts.Size() != numBins)
+    counts.resize(numBins);
+
+  for (int i=0; i<numBins; i++)
+    counts(i) = bins[i];
+
+  if (withResidue && started && numBins > 0) {
+    for (int i=1; i<stackSize; i++)
+      counts(this->binIndex(fabs(stack[i]-stack[i-1]))) += 0.5;
+    if (direction != 0)
+      counts(this->binIndex(fabs(candidate-stack[stackSize-1]))) += 0.5;
+  }
+
+  return numBins;
+}
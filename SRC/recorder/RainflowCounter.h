@@ -0,0 +1,88 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef RainflowCounter_h
+#define RainflowCounter_h
+
+// Description: This file contains the class definition for RainflowCounter.
+// A RainflowCounter counts cycles in a signal that is fed to it one sample
+// at a time, using the four-point rainflow algorithm. Only the reversals
+// that have not yet closed a cycle are kept, so no history is stored.
+// Every closed cycle is added to a range histogram and, through a
+// Basquin (S-N) or Coffin-Manson (strain-life) curve, to Miner's damage
+// sum. The open residue is counted as half cycles when results are asked
+// for, without disturbing the counting of samples still to come.
+
+class Vector;
+
+class RainflowCounter
+{
+  public:
+    // S-N:           N = K * range^(-m)        (a = K,  b = m)
+    // Coffin-Manson: N = (range/E0)^(1/m)      (a = E0, b = m), as used
+    //                by FatigueMaterial
+    enum CurveType {SN = 0, CoffinManson = 1};
+
+    RainflowCounter();
+    ~RainflowCounter();
+
+    void setCurve(int type, double a, double b);
+    void setHistogram(int numBins, double maxRange);
+    void setGate(double gate);
+
+    void addPoint(double value);
+    void reset(void);
+
+    double getDamage(bool withResidue = true) const;
+    double getNumCycles(bool withResidue = true) const;
+    double getMaxRange(bool withResidue = true) const;
+    int getHistogram(Vector &counts, bool withResidue = true) const;
+
+  private:
+    void pushReversal(double value);
+    void countCycle(double range, double count);
+    double cycleDamage(double range) const;
+    int binIndex(double range) const;
+
+    // fatigue curve
+    int curveType;
+    double curveA, curveB;
+
+    // histogram of closed cycles
+    int numBins;
+    double binWidth;
+    double *bins;
+
+    // reversals not yet paired, the running extreme and its direction
+    double *stack;
+    int stackSize, stackCapacity;
+    double candidate;
+    int direction;
+    bool started;
+
+    // reversals smaller than gate are ignored
+    double gate;
+
+    double damage;
+    double numCycles;
+    double maxRange;
+};
+
+#endif
@@ -0,0 +1,745 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation of
+// StatisticsRecorder.
+
+#include <StatisticsRecorder.h>
+#include <SummaryRecorderArgs.h>
+#include <StreamingStatistics.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Message.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+#include <elementAPI.h>
+
+#include <string.h>
+#include <stdlib.h>
+
+//
+// recorder NodeStatistics    <output> -node $tags|-nodeRange $s $e|-region $r
+//                            -dof $dofs <reducers> $response
+// recorder ElementStatistics <output> -ele $tags|-eleRange $s $e|-region $r
+//                            <-dof $cols> <reducers> $responseArgs
+//
+//  output:   -file $f | -csv $f | -xml $f | -binary $f, -precision $p
+//  reducers: -stats max maxTime min minTime absMax absMaxTime mean rms std count
+//            -quantile $p1 $p2 ...
+//            -hist $numBins $lower $upper
+//            -exceed $threshold
+//
+// if no reducer is given: -stats max maxTime min minTime mean rms
+//
+
+namespace {
+
+  struct StatisticsReducerArgs {
+    ID stats;
+    Vector quantiles;
+    int numBins;
+    double hist[2];
+    bool useThreshold;
+    double threshold;
+
+    StatisticsReducerArgs()
+      :stats(0,10), quantiles(0), numBins(0), useThreshold(false), threshold(0.0)
+    {
+      hist[0] = hist[1] = 0.0;
+    }
+  };
+
+  const char *statisticNames[] = {"max", "maxTime", "min", "minTime", "absMax",
+				  "absMaxTime", "mean", "rms", "std", "count"};
+  const int numStatisticNames = 10;
+
+  int
+  statisticCode(const char *name)
+  {
+    for (int i=0; i<numStatisticNames; i++)
+      if (strcmp(name, statisticNames[i]) == 0)
+	return i;
+    return -1;
+  }
+
+  // returns 1 if option was a reducer option, 0 if not and -1 on error
+  int
+  parseReducerOption(const char *option, StatisticsReducerArgs &args)
+  {
+    if (strcmp(option, "-stats") == 0) {
+      int numStats = args.stats.Size();
+      while (OPS_GetNumRemainingInputArgs() > 0) {
+	int code = statisticCode(OPS_GetString());
+	if (code < 0) {
+	  OPS_ResetCurrentInputArg(-1);
+	  break;
+	}
+	args.stats[numStats++] = code;
+      }
+    }
+    else if (strcmp(option, "-quantile") == 0) {
+      while (OPS_GetNumRemainingInputArgs() > 0) {
+	int num = 1;
+	double p;
+	if (OPS_GetDoubleInput(&num, &p) < 0) {
+	  OPS_ResetCurrentInputArg(-1);
+	  break;
+	}
+	if (p <= 0.0 || p >= 1.0) {
+	  opserr << "WARNING: recorder Statistics - quantile " << p << " not in (0,1)\n";
+	  return -1;
+	}
+	// Vector::resize() does not keep the old values
+	int numQ = args.quantiles.Size();
+	Vector old(args.quantiles);
+	args.quantiles.resize(numQ+1);
+	for (int i=0; i<numQ; i++)
+	  args.quantiles(i) = old(i);
+	args.quantiles(numQ) = p;
+      }
+    }
+    else if (strcmp(option, "-hist") == 0) {
+      int num = 1;
+      if (OPS_GetNumRemainingInputArgs() < 3 || OPS_GetIntInput(&num, &args.numBins) < 0) {
+	opserr << "WARNING: recorder Statistics - -hist numBins lower upper\n";
+	return -1;
+      }
+      num = 2;
+      if (OPS_GetDoubleInput(&num, args.hist) < 0 || args.numBins <= 0 ||
+	  args.hist[1] <= args.hist[0]) {
+	opserr << "WARNING: recorder Statistics - -hist numBins lower upper\n";
+	return -1;
+      }
+    }
+    else if (strcmp(option, "-exceed") == 0) {
+      int num = 1;
+      if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDoubleInput(&num, &args.threshold) < 0) {
+	opserr << "WARNING: recorder Statistics - failed to read threshold\n";
+	return -1;
+      }
+      args.useThreshold = true;
+    }
+    else
+      return 0;
+
+    return 1;
+  }
+
+  void
+  setDefaultStatistics(StatisticsReducerArgs &args)
+  {
+    if (args.stats.Size() != 0 || args.quantiles.Size() != 0 ||
+	args.numBins != 0 || args.useThreshold)
+      return;
+
+    args.stats[0] = StatisticsRecorder::Max;
+    args.stats[1] = StatisticsRecorder::MaxTime;
+    args.stats[2] = StatisticsRecorder::Min;
+    args.stats[3] = StatisticsRecorder::MinTime;
+    args.stats[4] = StatisticsRecorder::Mean;
+    args.stats[5] = StatisticsRecorder::RMS;
+  }
+}
+
+void*
+OPS_NodeStatisticsRecorder()
+{
+  SummaryRecorderArgs args("NodeStatistics", true);
+  StatisticsReducerArgs reducers;
+  const char *response = 0;
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *option = OPS_GetString();
+    int res = args.parse(option);
+    if (res == 0)
+      res = parseReducerOption(option, reducers);
+    if (res < 0)
+      return 0;
+    if (res == 0)
+      response = option;
+  }
+
+  NodeResponseType responseType = Disp;
+  if (response == 0 || strcmp(response, "disp") == 0)
+    responseType = Disp;
+  else if (strcmp(response, "vel") == 0)
+    responseType = Vel;
+  else if (strcmp(response, "accel") == 0)
+    responseType = Accel;
+  else if (strcmp(response, "incrDisp") == 0)
+    responseType = IncrDisp;
+  else if (strcmp(response, "incrDeltaDisp") == 0)
+    responseType = IncrDeltaDisp;
+  else if (strcmp(response, "reaction") == 0)
+    responseType = Reaction;
+  else if (strcmp(response, "unbalance") == 0)
+    responseType = Unbalance;
+  else if (strcmp(response, "rayleighForces") == 0)
+    responseType = RayleighForces;
+  else {
+    opserr << "WARNING: recorder NodeStatistics - unknown response " << response << endln;
+    return 0;
+  }
+
+  if (args.tags.Size() == 0 || args.dofs.Size() == 0) {
+    opserr << "WARNING: recorder NodeStatistics - nodes and dofs must be specified\n";
+    return 0;
+  }
+
+  setDefaultStatistics(reducers);
+
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return 0;
+
+  return new StatisticsRecorder(args.tags, args.dofs, responseType, *theDomain,
+				*args.createStream(), reducers.stats, reducers.quantiles,
+				reducers.numBins, reducers.hist[0], reducers.hist[1],
+				reducers.useThreshold, reducers.threshold);
+}
+
+void*
+OPS_ElementStatisticsRecorder()
+{
+  SummaryRecorderArgs args("ElementStatistics", false);
+  StatisticsReducerArgs reducers;
+  const char **data = 0;
+  int numData = 0;
+
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *option = OPS_GetString();
+    int res = args.parse(option);
+    if (res == 0)
+      res = parseReducerOption(option, reducers);
+    if (res < 0) {
+      if (data != 0)
+	delete [] data;
+      return 0;
+    }
+    if (res == 0) {
+      // first unknown string starts the element response request
+      numData = 1 + OPS_GetNumRemainingInputArgs();
+      data = new const char *[numData];
+      data[0] = option;
+      for (int i=1; i<numData; i++)
+	data[i] = OPS_GetString();
+    }
+  }
+
+  if (numData == 0) {
+    opserr << "WARNING: recorder ElementStatistics - no response requested\n";
+    return 0;
+  }
+
+  setDefaultStatistics(reducers);
+
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0) {
+    delete [] data;
+    return 0;
+  }
+
+  StatisticsRecorder *theRecorder =
+    new StatisticsRecorder(&args.tags, args.dofs, data, numData, *theDomain,
+			   *args.createStream(), reducers.stats, reducers.quantiles,
+			   reducers.numBins, reducers.hist[0], reducers.hist[1],
+			   reducers.useThreshold, reducers.threshold);
+  delete [] data;
+
+  return theRecorder;
+}
+
+
+StatisticsRecorder::StatisticsRecorder()
+  :Recorder(RECORDER_TAGS_StatisticsRecorder),
+   forNodes(true), theIDs(0), theDofs(0), nodeResponse(Disp),
+   responseArgs(0), numArgs(0), theNodes(0), numNodes(0), theResponses(),
+   theDomain(0), theHandler(0),
+   theStats(0), theQuantiles(0), numBins(0),
+   histLower(0.0), histUpper(0.0), useThreshold(false), threshold(0.0),
+   numChannels(0), theChannels(0), initializationDone(false)
+{
+
+}
+
+
+StatisticsRecorder::StatisticsRecorder(const ID &nodes, const ID &dofs,
+				       NodeResponseType responseType,
+				       Domain &theDom, OPS_Stream &theOutputHandler,
+				       const ID &stats, const Vector &quantiles,
+				       int nBins, double lower, double upper,
+				       bool useT, double t)
+  :Recorder(RECORDER_TAGS_StatisticsRecorder),
+   forNodes(true), theIDs(nodes), theDofs(dofs), nodeResponse(responseType),
+   responseArgs(0), numArgs(0), theNodes(0), numNodes(0), theResponses(),
+   theDomain(&theDom), theHandler(&theOutputHandler),
+   theStats(stats), theQuantiles(quantiles), numBins(nBins),
+   histLower(lower), histUpper(upper), useThreshold(useT), threshold(t),
+   numChannels(0), theChannels(0), initializationDone(false)
+{
+
+}
+
+
+StatisticsRecorder::StatisticsRecorder(const ID *eleID, const ID &dofs,
+				       const char **argv, int argc,
+				       Domain &theDom, OPS_Stream &theOutputHandler,
+				       const ID &stats, const Vector &quantiles,
+				       int nBins, double lower, double upper,
+				       bool useT, double t)
+  :Recorder(RECORDER_TAGS_StatisticsRecorder),
+   forNodes(false), theIDs(0), theDofs(dofs), nodeResponse(Disp),
+   responseArgs(0), numArgs(argc), theNodes(0), numNodes(0), theResponses(),
+   theDomain(&theDom), theHandler(&theOutputHandler),
+   theStats(stats), theQuantiles(quantiles), numBins(nBins),
+   histLower(lower), histUpper(upper), useThreshold(useT), threshold(t),
+   numChannels(0), theChannels(0), initializationDone(false)
+{
+  if (eleID != 0)
+    theIDs = *eleID;
+
+  responseArgs = new char *[argc];
+  for (int i=0; i<argc; i++) {
+    responseArgs[i] = new char[strlen(argv[i])+1];
+    strcpy(responseArgs[i], argv[i]);
+  }
+}
+
+
+StatisticsRecorder::~StatisticsRecorder()
+{
+  //
+  // write the statistics
+  //
+
+  if (theHandler != 0 && initializationDone == true) {
+    theHandler->tag("Data");
+    Vector row(numChannels);
+    int numRows = this->getNumRows();
+    for (int r=0; r<numRows; r++) {
+      for (int c=0; c<numChannels; c++)
+	row(c) = this->getValue(r, c);
+      theHandler->write(row);
+    }
+    theHandler->endTag(); // Data
+  }
+
+  if (theHandler != 0)
+    delete theHandler;
+
+  if (theChannels != 0)
+    delete [] theChannels;
+
+  if (theNodes != 0)
+    delete [] theNodes;
+
+  for (int i=0; i<numArgs; i++)
+    delete [] responseArgs[i];
+  if (responseArgs != 0)
+    delete [] responseArgs;
+}
+
+
+int
+StatisticsRecorder::record(int commitTag, double timeStamp)
+{
+  if (initializationDone == false) {
+    if (this->initialize() != 0) {
+      opserr << "StatisticsRecorder::record() - failed to initialize\n";
+      return -1;
+    }
+  }
+
+  if (forNodes == false) {
+    int result = theResponses.getResponses();
+    for (int i=0; i<numChannels; i++)
+      if (theResponses.isValid(i))
+	theChannels[i].addValue(theResponses.getValue(i), timeStamp);
+    return result;
+  }
+
+  if (nodeResponse == Reaction)
+    theDomain->calculateNodalReactions(0);
+
+  int loc = 0;
+  int numDOF = theDofs.Size();
+  for (int i=0; i<numNodes; i++) {
+    const Vector *data = theNodes[i]->getResponse(nodeResponse);
+    for (int j=0; j<numDOF; j++) {
+      int dof = theDofs(j);
+      if (data != 0 && dof >= 0 && dof < data->Size())
+	theChannels[loc].addValue((*data)(dof), timeStamp);
+      loc++;
+    }
+  }
+
+  return 0;
+}
+
+
+int
+StatisticsRecorder::restart(void)
+{
+  for (int i=0; i<numChannels; i++)
+    theChannels[i].reset();
+  return 0;
+}
+
+
+int
+StatisticsRecorder::flush(void)
+{
+  if (theHandler != 0)
+    return theHandler->flush();
+  return 0;
+}
+
+
+int
+StatisticsRecorder::setDomain(Domain &theDom)
+{
+  theDomain = &theDom;
+  return 0;
+}
+
+
+double
+StatisticsRecorder::getRecordedValue(int clmnId, int rowOffset, bool reset)
+{
+  if (initializationDone == false || clmnId < 0 || clmnId >= numChannels)
+    return 0.0;
+  if (rowOffset < 0 || rowOffset >= this->getNumRows())
+    return 0.0;
+
+  double res = this->getValue(rowOffset, clmnId);
+  if (reset)
+    theChannels[clmnId].reset();
+
+  return res;
+}
+
+
+int
+StatisticsRecorder::sendSelf(int commitTag, Channel &theChannel)
+{
+  if (theChannel.isDatastore() == 1) {
+    opserr << "StatisticsRecorder::sendSelf() - does not send data to a datastore\n";
+    return -1;
+  }
+
+  initializationDone = false;
+
+  int msgLength = 0;
+  for (int i=0; i<numArgs; i++)
+    msgLength += strlen(responseArgs[i])+1;
+
+  static ID idData(11);
+  idData(0) = forNodes ? 1 : 0;
+  idData(1) = nodeResponse;
+  idData(2) = theIDs.Size();
+  idData(3) = theDofs.Size();
+  idData(4) = numArgs;
+  idData(5) = msgLength;
+  idData(6) = (theHandler != 0) ? theHandler->getClassTag() : 0;
+  idData(7) = theStats.Size();
+  idData(8) = theQuantiles.Size();
+  idData(9) = numBins;
+  idData(10) = useThreshold ? 1 : 0;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "StatisticsRecorder::sendSelf() - failed to send idData\n";
+    return -1;
+  }
+
+  static Vector dData(3);
+  dData(0) = histLower;
+  dData(1) = histUpper;
+  dData(2) = threshold;
+  if (theChannel.sendVector(0, commitTag, dData) < 0) {
+    opserr << "StatisticsRecorder::sendSelf() - failed to send dData\n";
+    return -1;
+  }
+
+  if (theIDs.Size() != 0 && theChannel.sendID(0, commitTag, theIDs) < 0) {
+    opserr << "StatisticsRecorder::sendSelf() - failed to send tags\n";
+    return -1;
+  }
+
+  if (theDofs.Size() != 0 && theChannel.sendID(0, commitTag, theDofs) < 0) {
+    opserr << "StatisticsRecorder::sendSelf() - failed to send dofs\n";
+    return -1;
+  }
+
+  if (theStats.Size() != 0 && theChannel.sendID(0, commitTag, theStats) < 0) {
+    opserr << "StatisticsRecorder::sendSelf() - failed to send statistics\n";
+    return -1;
+  }
+
+  if (theQuantiles.Size() != 0 && theChannel.sendVector(0, commitTag, theQuantiles) < 0) {
+    opserr << "StatisticsRecorder::sendSelf() - failed to send quantiles\n";
+    return -1;
+  }
+
+  //
+  // send all the response args as a single char array
+  //
+
+  if (numArgs != 0) {
+    char *allResponseArgs = new char[msgLength];
+    char *currentLoc = allResponseArgs;
+    for (int j=0; j<numArgs; j++) {
+      strcpy(currentLoc, responseArgs[j]);
+      currentLoc += strlen(responseArgs[j])+1;
+    }
+
+    Message theMessage(allResponseArgs, msgLength);
+    if (theChannel.sendMsg(0, commitTag, theMessage) < 0) {
+      opserr << "StatisticsRecorder::sendSelf() - failed to send message\n";
+      delete [] allResponseArgs;
+      return -1;
+    }
+    delete [] allResponseArgs;
+  }
+
+  if (theHandler == 0 || theHandler->sendSelf(commitTag, theChannel) < 0) {
+    opserr << "StatisticsRecorder::sendSelf() - failed to send the DataOutputHandler\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+StatisticsRecorder::recvSelf(int commitTag, Channel &theChannel,
+			     FEM_ObjectBroker &theBroker)
+{
+  if (theChannel.isDatastore() == 1) {
+    opserr << "StatisticsRecorder::recvSelf() - does not recv data from a datastore\n";
+    return -1;
+  }
+
+  if (responseArgs != 0) {
+    for (int i=0; i<numArgs; i++)
+      delete [] responseArgs[i];
+    delete [] responseArgs;
+    responseArgs = 0;
+  }
+
+  static ID idData(11);
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to recv idData\n";
+    return -1;
+  }
+
+  forNodes = (idData(0) == 1);
+  nodeResponse = (NodeResponseType)idData(1);
+  numArgs = idData(4);
+  int msgLength = idData(5);
+  numBins = idData(9);
+  useThreshold = (idData(10) == 1);
+
+  static Vector dData(3);
+  if (theChannel.recvVector(0, commitTag, dData) < 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to recv dData\n";
+    return -1;
+  }
+  histLower = dData(0);
+  histUpper = dData(1);
+  threshold = dData(2);
+
+  theIDs.resize(idData(2));
+  if (idData(2) != 0 && theChannel.recvID(0, commitTag, theIDs) < 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to recv tags\n";
+    return -1;
+  }
+
+  theDofs.resize(idData(3));
+  if (idData(3) != 0 && theChannel.recvID(0, commitTag, theDofs) < 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to recv dofs\n";
+    return -1;
+  }
+
+  theStats.resize(idData(7));
+  if (idData(7) != 0 && theChannel.recvID(0, commitTag, theStats) < 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to recv statistics\n";
+    return -1;
+  }
+
+  theQuantiles.resize(idData(8));
+  if (idData(8) != 0 && theChannel.recvVector(0, commitTag, theQuantiles) < 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to recv quantiles\n";
+    return -1;
+  }
+
+  if (numArgs != 0) {
+    char *allResponseArgs = new char[msgLength];
+    Message theMessage(allResponseArgs, msgLength);
+    if (theChannel.recvMsg(0, commitTag, theMessage) < 0) {
+      opserr << "StatisticsRecorder::recvSelf() - failed to recv message\n";
+      delete [] allResponseArgs;
+      return -1;
+    }
+
+    responseArgs = new char *[numArgs];
+    char *currentLoc = allResponseArgs;
+    for (int j=0; j<numArgs; j++) {
+      int argLength = strlen(currentLoc)+1;
+      responseArgs[j] = new char[argLength];
+      strcpy(responseArgs[j], currentLoc);
+      currentLoc += argLength;
+    }
+    delete [] allResponseArgs;
+  }
+
+  if (theHandler != 0)
+    delete theHandler;
+
+  theHandler = theBroker.getPtrNewStream(idData(6));
+  if (theHandler == 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to get a data output handler\n";
+    return -1;
+  }
+
+  if (theHandler->recvSelf(commitTag, theChannel, theBroker) < 0) {
+    opserr << "StatisticsRecorder::recvSelf() - failed to recv the DataOutputHandler\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+StatisticsRecorder::getNumRows(void) const
+{
+  int numRows = theStats.Size() + theQuantiles.Size() + numBins;
+  if (useThreshold)
+    numRows += 2;
+  return numRows;
+}
+
+
+double
+StatisticsRecorder::getValue(int row, int channel) const
+{
+  const StreamingStatistics &theStat = theChannels[channel];
+
+  if (row < theStats.Size()) {
+    switch (theStats(row)) {
+    case Max:        return theStat.getMax();
+    case MaxTime:    return theStat.getMaxTime();
+    case Min:        return theStat.getMin();
+    case MinTime:    return theStat.getMinTime();
+    case AbsMax:     return theStat.getAbsMax();
+    case AbsMaxTime: return theStat.getAbsMaxTime();
+    case Mean:       return theStat.getMean();
+    case RMS:        return theStat.getRMS();
+    case StdDev:     return theStat.getStdDev();
+    case Count:      return theStat.getCount();
+    default:         return 0.0;
+    }
+  }
+  row -= theStats.Size();
+
+  if (row < theQuantiles.Size())
+    return theStat.getQuantile(row);
+  row -= theQuantiles.Size();
+
+  if (useThreshold) {
+    if (row == 0)
+      return theStat.getExceedanceTime();
+    if (row == 1)
+      return theStat.getNumExceedances();
+    row -= 2;
+  }
+
+  if (row < numBins) {
+    static Vector counts(0);
+    theStat.getHistogram(counts);
+    return counts(row);
+  }
+
+  return 0.0;
+}
+
+
+int
+StatisticsRecorder::initialize(void)
+{
+  if (theDomain == 0) {
+    opserr << "StatisticsRecorder::initialize() - no domain has been set\n";
+    return -1;
+  }
+
+  if (forNodes) {
+
+    // only the nodes in this domain get channels, as NodeRecorder does
+    if (theNodes != 0)
+      delete [] theNodes;
+    theNodes = new Node *[theIDs.Size()];
+    numNodes = 0;
+
+    ID xmlOrder(0,64);
+    ID columnOrder(0,64);
+    numChannels = 0;
+    for (int i=0; i<theIDs.Size(); i++) {
+      Node *theNode = theDomain->getNode(theIDs(i));
+      if (theNode == 0)
+	continue;
+      theNodes[numNodes++] = theNode;
+      xmlOrder[numNodes-1] = i+1;
+      for (int j=0; j<theDofs.Size(); j++)
+	columnOrder[numChannels++] = i+1;
+    }
+    theHandler->setOrder(xmlOrder);
+    theHandler->setOrder(columnOrder);
+
+  } else {
+
+    theResponses.setResponses(*theDomain, theIDs, theDofs,
+			      (const char **)responseArgs, numArgs, *theHandler);
+    numChannels = theResponses.getNumChannels();
+  }
+
+  if (theChannels != 0)
+    delete [] theChannels;
+  theChannels = 0;
+
+  if (numChannels > 0) {
+    theChannels = new StreamingStatistics[numChannels];
+    int numQ = theQuantiles.Size();
+    double *p = (numQ > 0) ? new double[numQ] : 0;
+    for (int i=0; i<numQ; i++)
+      p[i] = theQuantiles(i);
+    for (int i=0; i<numChannels; i++) {
+      theChannels[i].setQuantiles(numQ, p);
+      theChannels[i].setHistogram(numBins, histLower, histUpper);
+      if (useThreshold)
+	theChannels[i].setThreshold(threshold);
+    }
+    if (p != 0)
+      delete [] p;
+  }
+
+  initializationDone = true;
+  return 0;
+}
@@ -0,0 +1,117 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef StatisticsRecorder_h
+#define StatisticsRecorder_h
+
+// Description: This file contains the class definition for
+// StatisticsRecorder. The recorder passes every component (channel) of a
+// node response or of an element response through a StreamingStatistics
+// reducer at each commit and writes only the requested statistics, one
+// row per statistic and one column per channel, when it is destroyed:
+//   - the -stats entries, in the order given
+//   - one row per -quantile
+//   - time above and number of exceedances of the -exceed threshold
+//   - one row per -hist bin
+// Memory is constant per channel, whatever the length of the analysis.
+
+#include <Recorder.h>
+#include <ElementResponseSet.h>
+#include <OPS_Globals.h>
+#include <ID.h>
+#include <Vector.h>
+
+class Domain;
+class Node;
+class StreamingStatistics;
+
+class StatisticsRecorder: public Recorder
+{
+  public:
+    enum Statistic {Max = 0, MaxTime, Min, MinTime, AbsMax, AbsMaxTime,
+		    Mean, RMS, StdDev, Count};
+
+    StatisticsRecorder();
+
+    // node response
+    StatisticsRecorder(const ID &nodes, const ID &dofs,
+		       NodeResponseType responseType,
+		       Domain &theDomain, OPS_Stream &theOutputHandler,
+		       const ID &stats, const Vector &quantiles,
+		       int numBins, double histLower, double histUpper,
+		       bool useThreshold, double threshold);
+
+    // element response
+    StatisticsRecorder(const ID *eleID, const ID &dofs,
+		       const char **argv, int argc,
+		       Domain &theDomain, OPS_Stream &theOutputHandler,
+		       const ID &stats, const Vector &quantiles,
+		       int numBins, double histLower, double histUpper,
+		       bool useThreshold, double threshold);
+
+    ~StatisticsRecorder();
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+    int flush(void);
+    int setDomain(Domain &theDomain);
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+    double getRecordedValue(int clmnId, int rowOffset, bool reset);
+
+  protected:
+
+  private:
+    int initialize(void);
+    int getNumRows(void) const;
+    double getValue(int row, int channel) const;
+
+    bool forNodes;
+
+    ID theIDs;
+    ID theDofs;
+    NodeResponseType nodeResponse;
+    char **responseArgs;
+    int numArgs;
+
+    Node **theNodes;   // the nodes found in the domain
+    int numNodes;
+    ElementResponseSet theResponses;
+
+    Domain *theDomain;
+    OPS_Stream *theHandler;
+
+    ID theStats;
+    Vector theQuantiles;
+    int numBins;
+    double histLower, histUpper;
+    bool useThreshold;
+    double threshold;
+
+    int numChannels;
+    StreamingStatistics *theChannels;
+
+    bool initializationDone;
+};
+
+
+#endif
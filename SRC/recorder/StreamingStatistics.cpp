@@ -0,0 +1,264 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the implementation of StreamingStatistics.
+
+#include <StreamingStatistics.h>
+#include <Vector.h>
+#include <math.h>
+
+StreamingStatistics::StreamingStatistics()
+  :count(0), minValue(0.0), minTime(0.0), maxValue(0.0), maxTime(0.0),
+   mean(0.0), m2(0.0), sumSquares(0.0),
+   numQuantiles(0), quantiles(0),
+   numBins(0), lower(0.0), binWidth(0.0), bins(0),
+   useThreshold(false), threshold(0.0), timeAbove(0.0), numExceed(0),
+   above(false), lastTime(0.0)
+{
+
+}
+
+StreamingStatistics::~StreamingStatistics()
+{
+  if (quantiles != 0)
+    delete [] quantiles;
+  if (bins != 0)
+    delete [] bins;
+}
+
+void
+StreamingStatistics::setQuantiles(int num, const double *p)
+{
+  if (quantiles != 0)
+    delete [] quantiles;
+  quantiles = 0;
+  numQuantiles = 0;
+
+  if (num > 0) {
+    numQuantiles = num;
+    quantiles = new P2Quantile[num];
+    for (int i=0; i<num; i++)
+      quantiles[i].p = p[i];
+  }
+}
+
+void
+StreamingStatistics::setHistogram(int nBins, double lo, double hi)
+{
+  if (bins != 0)
+    delete [] bins;
+  bins = 0;
+  numBins = 0;
+
+  if (nBins > 0 && hi > lo) {
+    numBins = nBins;
+    lower = lo;
+    binWidth = (hi-lo)/nBins;
+    bins = new double[numBins];
+    for (int i=0; i<numBins; i++)
+      bins[i] = 0.0;
+  }
+}
+
+void
+StreamingStatistics::setThreshold(double t)
+{
+  useThreshold = true;
+  threshold = fabs(t);
+}
+
+void
+StreamingStatistics::reset(void)
+{
+  count = 0;
+  minValue = minTime = maxValue = maxTime = 0.0;
+  mean = m2 = sumSquares = 0.0;
+  for (int i=0; i<numBins; i++)
+    bins[i] = 0.0;
+  timeAbove = 0.0;
+  numExceed = 0;
+  above = false;
+  lastTime = 0.0;
+}
+
+void
+StreamingStatistics::addValue(double x, double time)
+{
+  count++;
+
+  if (count == 1 || x < minValue) {
+    minValue = x;
+    minTime = time;
+  }
+  if (count == 1 || x > maxValue) {
+    maxValue = x;
+    maxTime = time;
+  }
+
+  double delta = x - mean;
+  mean += delta/count;
+  m2 += delta*(x - mean);
+  sumSquares += x*x;
+
+  for (int i=0; i<numQuantiles; i++)
+    this->updateQuantile(quantiles[i], x);
+
+  if (numBins > 0) {
+    int bin = (int)floor((x-lower)/binWidth);
+    if (bin < 0)
+      bin = 0;
+    else if (bin >= numBins)
+      bin = numBins-1;
+    bins[bin] += 1.0;
+  }
+
+  if (useThreshold) {
+    bool nowAbove = fabs(x) > threshold;
+    if (above && count > 1)
+      timeAbove += time - lastTime;
+    if (nowAbove && !above)
+      numExceed++;
+    above = nowAbove;
+  }
+
+  lastTime = time;
+}
+
+void
+StreamingStatistics::updateQuantile(P2Quantile &Q, double x)
+{
+  double *q = Q.q;
+  double *n = Q.n;
+  double *np = Q.np;
+  double p = Q.p;
+
+  // the first five samples are kept, sorted, as the marker heights
+  if (count <= 5) {
+    int i = count-1;
+    while (i > 0 && q[i-1] > x) {
+      q[i] = q[i-1];
+      i--;
+    }
+    q[i] = x;
+    if (count == 5) {
+      for (int j=0; j<5; j++)
+	n[j] = j+1;
+      np[0] = 1.0;
+      np[1] = 1.0 + 2.0*p;
+      np[2] = 1.0 + 4.0*p;
+      np[3] = 3.0 + 2.0*p;
+      np[4] = 5.0;
+    }
+    return;
+  }
+
+  const double dn[5] = {0.0, 0.5*p, p, 0.5*(1.0+p), 1.0};
+
+  int k;
+  if (x < q[0]) {
+    q[0] = x;
+    k = 0;
+  } else if (x >= q[4]) {
+    q[4] = x;
+    k = 3;
+  } else {
+    k = 0;
+    while (k < 3 && x >= q[k+1])
+      k++;
+  }
+
+  for (int i=k+1; i<5; i++)
+    n[i] += 1.0;
+  for (int i=0; i<5; i++)
+    np[i] += dn[i];
+
+  // adjust the three middle markers
+  for (int i=1; i<4; i++) {
+    double d = np[i] - n[i];
+    if ((d >= 1.0 && n[i+1]-n[i] > 1.0) || (d <= -1.0 && n[i-1]-n[i] < -1.0)) {
+      int s = (d > 0.0) ? 1 : -1;
+      double qp = q[i] + s/(n[i+1]-n[i-1]) *
+	((n[i]-n[i-1]+s)*(q[i+1]-q[i])/(n[i+1]-n[i]) +
+	 (n[i+1]-n[i]-s)*(q[i]-q[i-1])/(n[i]-n[i-1]));
+      if (q[i-1] < qp && qp < q[i+1])
+	q[i] = qp;
+      else
+	q[i] += s*(q[i+s]-q[i])/(n[i+s]-n[i]);
+      n[i] += s;
+    }
+  }
+}
+
+double
+StreamingStatistics::getAbsMax(void) const
+{
+  return (fabs(minValue) > fabs(maxValue)) ? fabs(minValue) : fabs(maxValue);
+}
+
+double
+StreamingStatistics::getAbsMaxTime(void) const
+{
+  return (fabs(minValue) > fabs(maxValue)) ? minTime : maxTime;
+}
+
+double
+StreamingStatistics::getRMS(void) const
+{
+  if (count == 0)
+    return 0.0;
+  return sqrt(sumSquares/count);
+}
+
+double
+StreamingStatistics::getStdDev(void) const
+{
+  if (count < 2)
+    return 0.0;
+  return sqrt(m2/(count-1));
+}
+
+double
+StreamingStatistics::getQuantile(int i) const
+{
+  if (i < 0 || i >= numQuantiles || count == 0)
+    return 0.0;
+
+  const P2Quantile &Q = quantiles[i];
+  if (count >= 5)
+    return Q.q[2];
+
+  // fewer samples than markers: nearest rank on the sorted samples
+  int rank = (int)ceil(Q.p*count) - 1;
+  if (rank < 0)
+    rank = 0;
+  if (rank > count-1)
+    rank = count-1;
+  return Q.q[rank];
+}
+
+int
+StreamingStatistics::getHistogram(Vector &counts) const
+{
+  if (counts.Size() != numBins)
+    counts.resize(numBins);
+  for (int i=0; i<numBins; i++)
+    counts(i) = bins[i];
+  return numBins;
+}
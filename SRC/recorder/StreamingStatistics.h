@@ -0,0 +1,95 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef StreamingStatistics_h
+#define StreamingStatistics_h
+
+// Description: This file contains the class definition for
+// StreamingStatistics. A StreamingStatistics object reduces one signal,
+// fed one (value, time) sample at a time, to a set of statistics using a
+// fixed amount of memory independent of the length of the signal:
+//   - min/max/absolute max and the time at which they occurred
+//   - mean, rms and standard deviation (Welford's update)
+//   - quantiles, estimated with the P-square algorithm of Jain and
+//     Chlamtac (1985), five markers per quantile
+//   - a histogram over a fixed range (outliers go to the end bins)
+//   - time spent above a threshold in absolute value, and the number of
+//     times the threshold was exceeded
+
+class Vector;
+
+class StreamingStatistics
+{
+  public:
+    StreamingStatistics();
+    ~StreamingStatistics();
+
+    void setQuantiles(int numQuantiles, const double *p);
+    void setHistogram(int numBins, double lower, double upper);
+    void setThreshold(double threshold);
+
+    void addValue(double value, double time);
+    void reset(void);
+
+    int getCount(void) const {return count;};
+    double getMin(void) const {return minValue;};
+    double getMinTime(void) const {return minTime;};
+    double getMax(void) const {return maxValue;};
+    double getMaxTime(void) const {return maxTime;};
+    double getAbsMax(void) const;
+    double getAbsMaxTime(void) const;
+    double getMean(void) const {return mean;};
+    double getRMS(void) const;
+    double getStdDev(void) const;
+    double getQuantile(int i) const;
+    int getHistogram(Vector &counts) const;
+    double getExceedanceTime(void) const {return timeAbove;};
+    int getNumExceedances(void) const {return numExceed;};
+
+  private:
+    struct P2Quantile {
+      double p;
+      double q[5];   // marker heights
+      double n[5];   // marker positions
+      double np[5];  // desired marker positions
+    };
+    void updateQuantile(P2Quantile &theQ, double x);
+
+    int count;
+    double minValue, minTime;
+    double maxValue, maxTime;
+    double mean, m2, sumSquares;
+
+    int numQuantiles;
+    P2Quantile *quantiles;
+
+    int numBins;
+    double lower, binWidth;
+    double *bins;
+
+    bool useThreshold;
+    double threshold;
+    double timeAbove;
+    int numExceed;
+    bool above;
+    double lastTime;
+};
+
+#endif
@@ -0,0 +1,161 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation of
+// SummaryRecorderArgs.
+
+#include <SummaryRecorderArgs.h>
+#include <Domain.h>
+#include <MeshRegion.h>
+
+#include <StandardStream.h>
+#include <DataFileStream.h>
+#include <XmlFileStream.h>
+#include <BinaryFileStream.h>
+
+#include <elementAPI.h>
+
+#include <string.h>
+
+static const int STANDARD_STREAM = 0;
+static const int DATA_STREAM = 1;
+static const int XML_STREAM = 2;
+static const int BINARY_STREAM = 4;
+static const int DATA_STREAM_CSV = 5;
+
+SummaryRecorderArgs::SummaryRecorderArgs(const char *name, bool nodes)
+  :tags(0,16), dofs(0,6), recorderName(name), forNodes(nodes),
+   filename(0), eMode(STANDARD_STREAM), precision(6), doScientific(false)
+{
+
+}
+
+
+// reads the ints following an option, stops at the first non int
+static void
+readIntList(ID &list, int offset)
+{
+  int numData = 0;
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    int num = 1;
+    int value;
+    if (OPS_GetIntInput(&num, &value) < 0) {
+      OPS_ResetCurrentInputArg(-1);
+      break;
+    }
+    list[numData++] = value + offset;
+  }
+}
+
+
+int
+SummaryRecorderArgs::parse(const char *option)
+{
+  if (strcmp(option, "-file") == 0 || strcmp(option, "-csv") == 0 ||
+      strcmp(option, "-xml") == 0 || strcmp(option, "-binary") == 0) {
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+      opserr << "WARNING: recorder " << recorderName << " - no file name after " << option << endln;
+      return -1;
+    }
+    filename = OPS_GetString();
+    if (strcmp(option, "-file") == 0)
+      eMode = DATA_STREAM;
+    else if (strcmp(option, "-csv") == 0)
+      eMode = DATA_STREAM_CSV;
+    else if (strcmp(option, "-xml") == 0)
+      eMode = XML_STREAM;
+    else
+      eMode = BINARY_STREAM;
+  }
+  else if (strcmp(option, "-scientific") == 0) {
+    doScientific = true;
+  }
+  else if (strcmp(option, "-precision") == 0) {
+    int num = 1;
+    if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&num, &precision) < 0) {
+      opserr << "WARNING: recorder " << recorderName << " - failed to read precision\n";
+      return -1;
+    }
+  }
+  else if ((forNodes && strcmp(option, "-node") == 0) ||
+	   (!forNodes && strcmp(option, "-ele") == 0)) {
+    readIntList(tags, 0);
+  }
+  else if ((forNodes && strcmp(option, "-nodeRange") == 0) ||
+	   (!forNodes && strcmp(option, "-eleRange") == 0)) {
+    int range[2];
+    int num = 2;
+    if (OPS_GetNumRemainingInputArgs() < 2 || OPS_GetIntInput(&num, range) < 0) {
+      opserr << "WARNING: recorder " << recorderName << " - failed to read " << option << " start end\n";
+      return -1;
+    }
+    if (range[0] > range[1]) {
+      int swap = range[0];
+      range[0] = range[1];
+      range[1] = swap;
+    }
+    int numTags = 0;
+    for (int i=range[0]; i<=range[1]; i++)
+      tags[numTags++] = i;
+  }
+  else if (strcmp(option, "-region") == 0) {
+    int tag;
+    int num = 1;
+    if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&num, &tag) < 0) {
+      opserr << "WARNING: recorder " << recorderName << " - failed to read region tag\n";
+      return -1;
+    }
+    MeshRegion *theRegion = OPS_GetDomain()->getRegion(tag);
+    if (theRegion == 0) {
+      opserr << "WARNING: recorder " << recorderName << " - region " << tag << " does not exist\n";
+      return -1;
+    }
+    const ID &regionTags = forNodes ? theRegion->getNodes() : theRegion->getElements();
+    for (int i=0; i<regionTags.Size(); i++)
+      tags[i] = regionTags(i);
+  }
+  else if (strcmp(option, "-dof") == 0) {
+    readIntList(dofs, -1);
+  }
+  else
+    return 0;
+
+  return 1;
+}
+
+
+OPS_Stream *
+SummaryRecorderArgs::createStream(void) const
+{
+  OPS_Stream *theStream = 0;
+  if (eMode == DATA_STREAM && filename != 0)
+    theStream = new DataFileStream(filename, OVERWRITE, 2, 0, false, precision, doScientific);
+  else if (eMode == DATA_STREAM_CSV && filename != 0)
+    theStream = new DataFileStream(filename, OVERWRITE, 2, 1, false, precision, doScientific);
+  else if (eMode == XML_STREAM && filename != 0)
+    theStream = new XmlFileStream(filename);
+  else if (eMode == BINARY_STREAM && filename != 0)
+    theStream = new BinaryFileStream(filename);
+  else
+    theStream = new StandardStream();
+
+  theStream->setPrecision(precision);
+  return theStream;
+}
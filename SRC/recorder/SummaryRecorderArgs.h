@@ -0,0 +1,64 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+#ifndef SummaryRecorderArgs_h
+#define SummaryRecorderArgs_h
+
+// Description: This file contains the class definition for
+// SummaryRecorderArgs, the command line options shared by the recorders
+// that write a summary of each channel when they are destroyed
+// (ElementRecorderRainflow, StatisticsRecorder):
+//   output:    -file $f | -csv $f | -xml $f | -binary $f,
+//              -precision $p, -scientific
+//   selection: -node $tags | -nodeRange $s $e | -region $r  (node recorders)
+//              -ele $tags | -eleRange $s $e | -region $r    (element recorders)
+//              -dof $dofs
+// Each recorder parses its own options and hands the others to parse().
+
+#include <ID.h>
+
+class OPS_Stream;
+
+class SummaryRecorderArgs
+{
+  public:
+    SummaryRecorderArgs(const char *recorderName, bool forNodes);
+
+    // returns 1 if option is one of the shared options (its values are
+    // read), 0 if it is not and -1 on error
+    int parse(const char *option);
+
+    // the stream selected by the output options, a StandardStream if none
+    OPS_Stream *createStream(void) const;
+
+    ID tags;   // node or element tags, empty if none given
+    ID dofs;   // 0-based, empty if none given
+
+  private:
+    const char *recorderName;
+    bool forNodes;
+
+    const char *filename;
+    int eMode;
+    int precision;
+    bool doScientific;
+};
+
+#endif
@@ -70,6 +70,9 @@ extern void* OPS_MPCORecorder();
 extern void* OPS_VTK_Recorder();
 extern void* OPS_ElementRecorderRMS();
 extern void* OPS_NodeRecorderRMS();
+extern void* OPS_ElementRecorderRainflow();
+extern void* OPS_NodeStatisticsRecorder();
+extern void* OPS_ElementStatisticsRecorder();
 
 
  #include <NodeIter.h>
@@ -1923,6 +1926,18 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
        OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, &theDomain);
        (*theRecorder) = (Recorder*) OPS_NodeRecorderRMS();
      }
+     else if (strcmp(argv[1],"ElementRainflow") == 0) {
+       OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, &theDomain);
+       (*theRecorder) = (Recorder*) OPS_ElementRecorderRainflow();
+     }
+     else if (strcmp(argv[1],"NodeStatistics") == 0) {
+       OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, &theDomain);
+       (*theRecorder) = (Recorder*) OPS_NodeStatisticsRecorder();
+     }
+     else if (strcmp(argv[1],"ElementStatistics") == 0) {
+       OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, &theDomain);
+       (*theRecorder) = (Recorder*) OPS_ElementStatisticsRecorder();
+     }
 #ifdef _HDF5
      else if (strcmp(argv[1], "mpco") == 0) {
        OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, &theDomain);
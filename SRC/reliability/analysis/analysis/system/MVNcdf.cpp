@@ -32,14 +32,12 @@
 //
 
 #include <MVNcdf.h>
+#include <MVNintegrator.h>
 #include <SystemAnalysis.h>
 #include <Cutset.h>
 #include <CutsetIter.h>
 #include <ReliabilityDomain.h>
 #include <NormalRV.h>
-#include <MatrixOperations.h>
-#include <RandomNumberGenerator.h>
-#include <CStdLibRandGenerator.h>
 #include <stdlib.h>
 #include <time.h>
 
@@ -223,7 +221,7 @@ MVNcdf::MVNcdffunc(const Vector &allbeta, const Matrix &rhoin, double modifier)
 	static NormalRV uRV(1, 0.0, 1.0);
 	Vector beta(m);
 	Matrix rho(m,m);
-	int i,j,result;
+	int i;
 
 	rho = rhoin;
 	for (i=0; i < m; i++) {
@@ -233,65 +231,12 @@ MVNcdf::MVNcdffunc(const Vector &allbeta, const Matrix &rhoin, double modifier)
 
 	if (m == 1)
 		return uRV.getCDFvalue( beta(0) );
-	else {	
-		Vector x = beta;
-		double ci = 99.9;
 
-		// Cholesky decomposition of correlation matrix
-		MatrixOperations theMat(rho);
-		result = theMat.computeCholeskyAndItsInverse();
-		if (result < 0) {
-			opserr << "SystemAnalysis::MVNcdf() - could not compute the Cholesky decomposition and " << endln
-				<< "  its inverse for the correlation matrix." << endln;
-		}
-		Matrix C = theMat.getLowerCholesky();
-		double alph = uRV.getInverseCDFvalue(ci/100.0);
-
-		double intsum = 0, varsum = 0, q; 
-		long int N = 0;
-		
-		// d is always zero for integration from -infinity to beta
-		// so f = e in Genz
-		Vector d(m); Vector e(m); Vector f(m);
-		d(1-1) = 0.0;
-		e(1-1) = uRV.getCDFvalue(x(1-1) / C(1-1,1-1));
-		f(1-1) = e(1-1)-d(1-1);
-		
-		// initialize random number generator
-		RandomNumberGenerator *theRandomNumberGenerator = new CStdLibRandGenerator();
-		result = theRandomNumberGenerator->generate_nIndependentUniformNumbers(m-1,0,1,time(NULL));
-		if (result < 0) {
-			opserr << "SystemAnalysis::MVNcdf() - could not generate random numbers for simulation." << endln;
-		}
-		Vector w(m-1);
-
-		// simulate
-		Vector y(m);
-		double err = 2.0 * errMax;
-		while ( (err > errMax || N < 5) && (N < Nmax) ) {
-			result = theRandomNumberGenerator->generate_nIndependentUniformNumbers(m-1,0,1);
-			w = theRandomNumberGenerator->getGeneratedNumbers();
+	// Genz integration with randomized lattice points, stopping once the
+	// 99.9% confidence half-width of the estimate is below errMax
+	double ci = 99.9;
+	double alph = uRV.getInverseCDFvalue(ci/100.0);
+	MVNintegrator theIntegrator(Nmax, errMax, 0.0, alph);
 
-			for (i = 2; i <= m; i++) {
-				y(i-1-1) = uRV.getInverseCDFvalue(d(i-1-1) + w(i-1-1) * (e(i-1-1)-d(i-1-1)) );
-				q = 0.0;
-				for (j = 1; j <= i-1; j++)
-					q += C(i-1,j-1)*y(j-1);
-					
-				d(i-1) = 0.0;
-				e(i-1) = uRV.getCDFvalue( (x(i-1) - q)/C(i-1,i-1) );
-				f(i-1) = (e(i-1)-d(i-1)) * f(i-1-1);
-			}
-
-			N++;
-			intsum += f(m-1);
-			varsum += f(m-1)*f(m-1);
-			err = alph*sqrt( (varsum/N - pow(intsum/N,2))/N );
-			//opserr << "#" << N << " has err = " << err << " with alpha=" << alph << endln;
-		}
-
-		delete theRandomNumberGenerator;
-		
-		return intsum/N;
-	}
+	return theIntegrator.cdf(beta, rho);
 }
@@ -0,0 +1,368 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class implementation for
+// MVNintegrator, the randomized quasi-Monte Carlo integrator of the
+// multinormal cdf used by the MVNcdf and SCIS system analyses.
+
+#include <MVNintegrator.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <RandomNumberGenerator.h>
+#include <CStdLibRandGenerator.h>
+#include <OPS_Globals.h>
+
+#include <math.h>
+#include <float.h>
+#include <time.h>
+
+// number of random shifts (independent estimates) of the lattice
+static const int numShifts = 12;
+// number of lattice points evaluated together, one dimension at a time
+static const int blockSize = 64;
+// points per shift in the first round
+static const long int startPoints = 128;
+
+static const double tinyPivot = 1.0e-10;
+
+static inline double
+Phi(double x)
+{
+	return 0.5*erfc(-x*0.70710678118654752440);
+}
+
+static inline double
+phi(double x)
+{
+	return 0.39894228040143267794*exp(-0.5*x*x);
+}
+
+// Inverse standard normal cdf, algorithm AS241 (Wichura 1988), about
+// 1e-16 relative accuracy
+static inline double
+PhiInv(double p)
+{
+	if (p <= 0.0)
+		p = DBL_MIN;
+	else if (p >= 1.0)
+		p = 1.0-DBL_EPSILON;
+
+	double q = p - 0.5;
+	if (fabs(q) <= 0.425) {
+		double r = 0.180625 - q*q;
+		return q*(((((((2509.0809287301226727*r + 33430.575583588128105)*r + 67265.770927008700853)*r
+					+ 45921.953931549871457)*r + 13731.693765509461125)*r + 1971.5909503065514427)*r
+					+ 133.14166789178437745)*r + 3.387132872796366608)
+			/ (((((((5226.495278852545925*r + 28729.085735721942674)*r + 39307.89580009271061)*r
+				+ 21213.794301586595867)*r + 5394.1960214247511077)*r + 687.1870074920579083)*r
+				+ 42.313330701600911252)*r + 1.0);
+	}
+
+	double r = (q < 0.0) ? p : 1.0-p;
+	r = sqrt(-log(r));
+	double val;
+	if (r <= 5.0) {
+		r -= 1.6;
+		val = (((((((7.7454501427834140764e-4*r + 0.0227238449892691845833)*r + 0.24178072517745061177)*r
+				+ 1.27045825245236838258)*r + 3.64784832476320460504)*r + 5.7694972214606914055)*r
+				+ 4.6303378461565452959)*r + 1.42343711074968357734)
+			/ (((((((1.05075007164441684324e-9*r + 5.475938084995344946e-4)*r + 0.0151986665636164571966)*r
+				+ 0.14810397642748007459)*r + 0.68976733498510000455)*r + 1.6763848301838038494)*r
+				+ 2.05319162663775882187)*r + 1.0);
+	}
+	else {
+		r -= 5.0;
+		val = (((((((2.01033439929228813265e-7*r + 2.71155556874348757815e-5)*r + 0.0012426609473880784386)*r
+				+ 0.026532189526576123093)*r + 0.29656057182850489123)*r + 1.7848265399172913358)*r
+				+ 5.4637849111641143699)*r + 6.6579046435011037772)
+			/ (((((((2.04426310338993978564e-15*r + 1.4215117583164458887e-7)*r + 1.8463183175100546818e-5)*r
+				+ 7.868691311456132591e-4)*r + 0.0148753612908506148525)*r + 0.13692988092273580531)*r
+				+ 0.59983220655588793769)*r + 1.0);
+	}
+
+	return (q < 0.0) ? -val : val;
+}
+
+
+MVNintegrator::MVNintegrator(long int passedNmax, double passedAbsTol,
+							 double passedRelTol, double passedConfidence)
+:Nmax(passedNmax), absTol(passedAbsTol), relTol(passedRelTol),
+ confidence(passedConfidence), m(0), stdError(0.0), numEval(0)
+{
+	if (Nmax < numShifts)
+		Nmax = numShifts;
+}
+
+
+MVNintegrator::~MVNintegrator()
+{
+}
+
+
+int
+MVNintegrator::factorize(const Vector &b, const Matrix &R)
+{
+	// Cholesky factorization of R with the variables reordered so that
+	// the one with the smallest expected conditional probability, given
+	// the expected values of those already ordered, comes next
+	m = b.Size();
+	lim.resize(m);
+	L.assign(m*m, 0.0);
+	std::vector<double> A(m*m);
+	std::vector<double> ybar(m, 0.0);
+	int i, j, k;
+
+	for (i = 0; i < m; i++) {
+		lim[i] = b(i);
+		for (j = 0; j < m; j++)
+			A[i*m+j] = R(i,j);
+	}
+
+	int numZeroPivots = 0;
+	for (i = 0; i < m; i++) {
+
+		int piv = i;
+		double pmin = 2.0;
+		for (j = i; j < m; j++) {
+			double s = A[j*m+j];
+			double q = 0.0;
+			for (k = 0; k < i; k++) {
+				s -= L[j*m+k]*L[j*m+k];
+				q += L[j*m+k]*ybar[k];
+			}
+			double p;
+			if (s > tinyPivot)
+				p = Phi((lim[j]-q)/sqrt(s));
+			else
+				p = (lim[j]-q >= 0.0) ? 1.0 : 0.0;
+			if (p < pmin) {
+				pmin = p;
+				piv = j;
+			}
+		}
+
+		if (piv != i) {
+			double temp = lim[i]; lim[i] = lim[piv]; lim[piv] = temp;
+			for (k = 0; k < m; k++) {
+				temp = A[i*m+k]; A[i*m+k] = A[piv*m+k]; A[piv*m+k] = temp;
+			}
+			for (k = 0; k < m; k++) {
+				temp = A[k*m+i]; A[k*m+i] = A[k*m+piv]; A[k*m+piv] = temp;
+			}
+			for (k = 0; k < i; k++) {
+				temp = L[i*m+k]; L[i*m+k] = L[piv*m+k]; L[piv*m+k] = temp;
+			}
+		}
+
+		double s = A[i*m+i];
+		for (k = 0; k < i; k++)
+			s -= L[i*m+k]*L[i*m+k];
+
+		if (s > tinyPivot) {
+			double lii = sqrt(s);
+			L[i*m+i] = lii;
+			for (j = i+1; j < m; j++) {
+				double v = A[j*m+i];
+				for (k = 0; k < i; k++)
+					v -= L[j*m+k]*L[i*m+k];
+				L[j*m+i] = v/lii;
+			}
+
+			// mean of the truncated (-inf, c] standard normal
+			double q = 0.0;
+			for (k = 0; k < i; k++)
+				q += L[i*m+k]*ybar[k];
+			double c = (lim[i]-q)/lii;
+			double P = Phi(c);
+			ybar[i] = (P > DBL_MIN) ? -phi(c)/P : c;
+		}
+		else {
+			// R is (numerically) singular: the variable is fully
+			// determined by the preceding ones
+			if (s < -tinyPivot)
+				return -1;
+			numZeroPivots++;
+		}
+	}
+
+	if (numZeroPivots > 0)
+		opserr << "MVNintegrator::factorize - correlation matrix is singular, "
+			   << numZeroPivots << " dependent variable(s)" << endln;
+
+	return 0;
+}
+
+
+double
+MVNintegrator::sumPoints(const double *shift, long int kStart, long int kEnd)
+{
+	// Sum of the integrand over lattice points kStart <= k < kEnd:
+	//   f = e_1 e_2 ... e_m,  e_i = Phi((b_i - sum_j<i L_ij y_j)/L_ii),
+	//   y_i = PhiInv(w_i e_i),  w = tent(frac(k alpha + shift))
+	// A block of points is processed one dimension at a time so that the
+	// inner loops run over the points, with no dependence between them
+
+	std::vector<double> Y((m-1)*blockSize);	// y_j of the points of the block
+	double f[blockSize];	// running product of the e_i
+	double e[blockSize];	// e_(i-1) of each point
+	double q[blockSize];
+
+	double e1 = (L[0] > 0.0) ? Phi(lim[0]/L[0]) : ((lim[0] >= 0.0) ? 1.0 : 0.0);
+	if (e1 == 0.0)
+		return 0.0;
+
+	double sum = 0.0;
+	for (long int k0 = kStart; k0 < kEnd; k0 += blockSize) {
+		int nb = (int)((kEnd-k0 < blockSize) ? kEnd-k0 : blockSize);
+		int p;
+
+		for (p = 0; p < nb; p++) {
+			f[p] = e1;
+			e[p] = e1;
+		}
+
+		for (int i = 1; i < m; i++) {
+
+			// y_(i-1) from lattice coordinate i-1
+			double a = alpha[i-1];
+			double s = shift[i-1];
+			double *yprev = &Y[(i-1)*blockSize];
+			for (p = 0; p < nb; p++) {
+				double x = (double)(k0+p)*a + s;
+				x -= floor(x);
+				double w = 1.0 - fabs(2.0*x - 1.0);
+				yprev[p] = PhiInv(w*e[p]);
+			}
+
+			// conditional limit of variable i
+			for (p = 0; p < nb; p++)
+				q[p] = 0.0;
+			for (int j = 0; j < i; j++) {
+				double lij = L[i*m+j];
+				if (lij == 0.0)
+					continue;
+				const double *yj = &Y[j*blockSize];
+				for (p = 0; p < nb; p++)
+					q[p] += lij*yj[p];
+			}
+
+			double lii = L[i*m+i];
+			if (lii > 0.0) {
+				for (p = 0; p < nb; p++)
+					e[p] = Phi((lim[i]-q[p])/lii);
+			}
+			else {
+				for (p = 0; p < nb; p++)
+					e[p] = (lim[i]-q[p] >= 0.0) ? 1.0 : 0.0;
+			}
+			for (p = 0; p < nb; p++)
+				f[p] *= e[p];
+		}
+
+		for (p = 0; p < nb; p++)
+			sum += f[p];
+	}
+
+	return sum;
+}
+
+
+double
+MVNintegrator::cdf(const Vector &b, const Matrix &R)
+{
+	stdError = 0.0;
+	numEval = 0;
+
+	if (b.Size() == 1)
+		return Phi(b(0));
+
+	if (this->factorize(b, R) < 0) {
+		opserr << "MVNintegrator::cdf - correlation matrix is not positive semi-definite" << endln;
+		return 0.0;
+	}
+
+	// lattice generator: fractional parts of the square roots of the primes
+	alpha.resize(m-1);
+	int numPrimes = 0;
+	for (int candidate = 2; numPrimes < m-1; candidate++) {
+		bool isPrime = true;
+		for (int d = 2; d*d <= candidate; d++)
+			if (candidate % d == 0) {
+				isPrime = false;
+				break;
+			}
+		if (isPrime) {
+			double r = sqrt((double)candidate);
+			alpha[numPrimes++] = r - floor(r);
+		}
+	}
+
+	// random shifts
+	RandomNumberGenerator *theRandomNumberGenerator = new CStdLibRandGenerator();
+	theRandomNumberGenerator->generate_nIndependentUniformNumbers(numShifts*(m-1), 0, 1, time(NULL));
+	Vector shifts = theRandomNumberGenerator->getGeneratedNumbers();
+	delete theRandomNumberGenerator;
+	std::vector<double> shift(numShifts*(m-1));
+	for (int i = 0; i < numShifts*(m-1); i++)
+		shift[i] = shifts(i);
+
+	double sums[numShifts];
+	for (int s = 0; s < numShifts; s++)
+		sums[s] = 0.0;
+
+	long int maxPoints = Nmax/numShifts;
+	long int n = 0;
+	double P = 0.0;
+
+	while (n < maxPoints) {
+		long int nEnd = (n == 0) ? startPoints : 2*n;
+		if (nEnd > maxPoints)
+			nEnd = maxPoints;
+
+#pragma omp parallel for
+		for (int s = 0; s < numShifts; s++)
+			sums[s] += this->sumPoints(&shift[s*(m-1)], n+1, nEnd+1);
+
+		n = nEnd;
+		numEval = n*numShifts;
+
+		// mean and standard error over the independent shifts
+		P = 0.0;
+		for (int s = 0; s < numShifts; s++)
+			P += sums[s]/n;
+		P /= numShifts;
+		double var = 0.0;
+		for (int s = 0; s < numShifts; s++)
+			var += (sums[s]/n - P)*(sums[s]/n - P);
+		stdError = sqrt(var/(numShifts-1)/numShifts);
+
+		double tol = absTol;
+		if (relTol*fabs(P) > tol)
+			tol = relTol*fabs(P);
+		if (confidence*stdError <= tol)
+			break;
+	}
+
+	return P;
+}
@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// Description: This file contains the class definition for MVNintegrator.
+// MVNintegrator evaluates P[X_1 <= b_1, ..., X_m <= b_m] for X standard
+// multinormal with correlation matrix R, with the separation-of-variables
+// transformation of Genz (1992):
+//   - the variables are reordered while R is Cholesky factorized, smallest
+//     expected conditional probability first, which reduces the variance
+//   - the integrand over the unit (m-1)-cube is evaluated at randomly
+//     shifted Richtmyer lattice points (with the periodizing tent
+//     transformation) in blocks, one dimension at a time over the block
+//   - the shifts are independent estimates, evaluated in parallel; their
+//     spread gives the error estimate, and the number of points per shift
+//     is doubled until the requested tolerance or Nmax is reached
+
+#ifndef MVNintegrator_h
+#define MVNintegrator_h
+
+#include <vector>
+
+class Vector;
+class Matrix;
+
+class MVNintegrator
+{
+
+public:
+	// stops once confidence*standardError <= max(absTol, relTol*P)
+	// or after Nmax integrand evaluations
+	MVNintegrator(long int Nmax, double absTol, double relTol, double confidence);
+	~MVNintegrator();
+
+	double cdf(const Vector &b, const Matrix &R);
+
+	double getStandardError(void) const {return stdError;}
+	long int getNumEvaluations(void) const {return numEval;}
+
+private:
+	int factorize(const Vector &b, const Matrix &R);
+	double sumPoints(const double *shift, long int kStart, long int kEnd);
+
+	long int Nmax;
+	double absTol;
+	double relTol;
+	double confidence;
+
+	// reordered limits and lower Cholesky factor (row major)
+	int m;
+	std::vector<double> lim;
+	std::vector<double> L;
+	// lattice generator, fractional parts of sqrt(prime)
+	std::vector<double> alpha;
+
+	double stdError;
+	long int numEval;
+};
+
+#endif
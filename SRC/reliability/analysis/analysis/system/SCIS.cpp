@@ -32,13 +32,12 @@
 //
 
 #include <SCIS.h>
+#include <MVNintegrator.h>
 #include <SystemAnalysis.h>
 #include <Cutset.h>
 #include <CutsetIter.h>
 #include <ReliabilityDomain.h>
 #include <NormalRV.h>
-#include <RandomNumberGenerator.h>
-#include <CStdLibRandGenerator.h>
 
 #include <fstream>
 #include <iomanip>
@@ -224,7 +223,7 @@ SCIS::SCISfunc(const Vector &allbeta, const Matrix &rhoin, double modifier)
 	static NormalRV uRV(1, 0.0, 1.0);
 	Vector beta(n);
 	Matrix rho(n,n);
-	int i,ii,j,k,N;
+	int i;
 	
 	rho = rhoin;
 	for (i=0; i < n; i++) {
@@ -234,107 +233,14 @@ SCIS::SCISfunc(const Vector &allbeta, const Matrix &rhoin, double modifier)
 	
 	if (n == 1)
 		return uRV.getCDFvalue( beta(0) );
-	else {
-		// SCIS allocation, note that Nmax is limited to maximum size of Vector class (currently int)
-		srand ( time(NULL) );
-		Matrix Dk(n,n);
-		Matrix d(n,n);
-		Vector y(Nmax);
-		Vector x(n);
-		double rand01;
 
-		// Preprocessing
-		// d : Matrix containing parts of inverse of covariance matrix 
-		//     (Note) d(k,1:k) - k-th row of inverse matrix of C(1:k,1:k)
-		for (ii = 1; ii <= n; ii++) {
-			Matrix tempMat(ii,ii);
-			for (i = 0; i < ii; i++) {
-				for (j = 0; j < ii; j++)
-					tempMat(i,j) = rho(i,j);
-			}
-
-			Matrix Cinv(ii,ii);
-			tempMat.Invert(Cinv);
-
-			for (i = 0; i < ii; i++) {
-				for (j = 0; j < ii; j++)
-					Dk(i,j) = Cinv(i,j);
-			}
-			
-			for (j = 1; j <= ii; j++)
-				d(ii-1,j-1) = Dk(ii-1,j-1); 
-		}
-
-		// SCIS algorithm (Ambartzumian and Der Kiureghian)
-		// y    : Product of probabilities
-		// sumy : Sum of products y
-		// P    : Estimate of probability (sumy/N)
-		// em   : Mean of conditional multinormal distribution
-		// dd   : Standard deviation of conditional multinormal distribution
-		// x    : Sampled value for each random variable
-		double sumy = 0;
-		double cov = DBL_MAX;
-		double P = 0;
-		double em, sm, dd, za, zb, zz;
-
-		for (ii = 1; ii <= Nmax; ii++) {
-			y(ii-1) = 1;
-
-			// calculate probability of k-th variable
-			for (k = 1; k <= n; k++) {
-				// mean and std for k-th variable
-				dd = 1/sqrt(d(k-1,k-1));
-				em = 0;
-
-				// mean of conditional distribution
-				if (k != 1) {
-					for (j = 1; j <= k-1; j++) {
-						sm = d(k-1,j-1)*x(j-1)/d(k-1,k-1);
-						em = em - sm;
-					}
-				}
+	// SCIS (Ambartzumian and Der Kiureghian) samples each variable from
+	// its distribution conditioned on the preceding ones and averages the
+	// product of the conditional probabilities; this is the Genz
+	// integrand, evaluated here with randomized lattice points in place of
+	// pseudo-random numbers. Stops once the c.o.v. of the estimate is
+	// below errMax
+	MVNintegrator theIntegrator(Nmax, 0.0, errMax, 1.0);
 
-				// conditional cumulative probability za, our interval goes from -inf to beta so za = 0
-				//za = (-DBL_MAX-em)/dd;
-				//za = uRV.getCDFvalue(za);
-				za = 0;
-				
-				// conditional cumulative probability zb
-				zb = (beta(k-1)-em)/dd;
-	#ifdef _LINUX
-				if ( isfinite(zb) )
-					zb = uRV.getCDFvalue(zb);
-				else
-					zb = 0;
-	#endif
-				y(ii-1) = y(ii-1)*(zb-za);
-
-				// sample a random value x_k
-				rand01 = (double)rand()/RAND_MAX;
-				zz = uRV.getInverseCDFvalue( (zb-za)*(rand01)+za );
-				x(k-1) = dd*zz + em;
-			}
-
-			// sum of y up to i-trials
-			sumy = sumy + y(ii-1);
-			N = ii;
-			P = sumy / N;
-
-			// calculation of c.o.v. of estimate P
-			if (ii >= 5 && P > 0.0) {
-				Vector *vectemp = new Vector(N);
-				for (j = 0; j < N; j++)
-					(*vectemp)(j) = y(j) - P;
-					
-				cov = vectemp->Norm()/N/P;
-				delete vectemp;
-			}
-				
-			// early exit
-			if (cov < errMax)
-				break;
-		}
-
-		return P;
-	}
+	return theIntegrator.cdf(beta, rho);
 }
@@ -44,6 +44,12 @@
 #include <math.h>
 #include <string.h>
 
+// Quadrature grid for the integral equation of the Nataf correlation:
+// composite Simpson rule with numNatafIntervals intervals on [-natafZmax, natafZmax]
+// in each standard normal direction
+static const int numNatafIntervals = 200;
+static const double natafZmax = 5.0;
+
 
 NatafProbabilityTransformation::NatafProbabilityTransformation(ReliabilityDomain *passedReliabilityDomain,
 											 int passedPrintFlag)
@@ -208,6 +214,42 @@ NatafProbabilityTransformation::transform_u_to_x(const Vector &u, Vector &x)
 }
 
 
+int
+NatafProbabilityTransformation::transform_u_to_x(const Matrix &U, Matrix &X)
+{
+  // Same as the single realization version, with the random variable
+  // lookups done once for all samples (columns of U)
+  int numSamples = U.noCols();
+  if (U.noRows() != nrv) {
+    opserr << "NatafProbabilityTransformation::transform_u_to_x -- U has "
+	   << U.noRows() << " rows, expected " << nrv << endln;
+    return -1;
+  }
+  if (X.noRows() != nrv || X.noCols() != numSamples)
+    X.resize(nrv, numSamples);
+
+  std::vector<RandomVariable *> theRVs(nrv, (RandomVariable *)0);
+  RandomVariable *theRV;
+  RandomVariableIter &rvIter = theReliabilityDomain->getRandomVariables();
+  while ((theRV = rvIter()) != 0) {
+    int i = theReliabilityDomain->getRandomVariableIndex(theRV->getTag());
+    theRVs[i] = theRV;
+  }
+
+  for (int s = 0; s < numSamples; s++) {
+    // z = L*u, unrolled for lower triangular matrix
+    for (int i = 0; i < nrv; i++) {
+      double sum = 0.0;
+      for (int j = 0; j <= i; j++)
+	sum += lapackA[i+j*nrv]*U(j,s);
+      X(i,s) = theRVs[i]->transform_u_to_x(sum);
+    }
+  }
+
+  return 0;
+}
+
+
 int 
 NatafProbabilityTransformation::getJacobian_x_to_u(Matrix &Jxu)
 {
@@ -530,6 +572,11 @@ NatafProbabilityTransformation::setCorrelationMatrix(int pertMeanOfThisRV, int p
 	int numberOfCorrelationCoefficients = 
 		theReliabilityDomain->getNumberOfCorrelationCoefficients();
 
+	// Pairs that need the numerical solution of the integral equation
+	std::vector<int> pendingRv1;
+	std::vector<int> pendingRv2;
+	std::vector<double> pendingCorrelation;
+
 	CorrelationCoefficient *theCorrelationCoefficient;
 	CorrelationCoefficientIter ccIter =
 	  theReliabilityDomain->getCorrelationCoefficients();
@@ -607,9 +654,12 @@ NatafProbabilityTransformation::setCorrelationMatrix(int pertMeanOfThisRV, int p
 
 		/////////////////////////////////////////////////////////////////////////////////
 		if ( strcmp(typeRv1,"USERDEFINED") == 0  ||  strcmp(typeRv2,"USERDEFINED") == 0  ) {
-			opserr << " ... modifying correlation rho("<<rv1<<","<<rv2<<") for user-defined random variable..." << endln;
-			newCorrelation = solveForCorrelation(rv1, rv2, correlation);
-			opserr << " ... computed correlation for Nataf standard normal variates: " << newCorrelation << endln;
+			// No closed form; the integral equation is solved below,
+			// for all such pairs at once
+			pendingRv1.push_back(rv1);
+			pendingRv2.push_back(rv2);
+			pendingCorrelation.push_back(correlation);
+			continue;
 		}
 		else if ( strcmp(typeRv1,"NORMAL") == 0  &&  strcmp(typeRv2,"NORMAL") == 0  ) {
 			newCorrelation = correlation;
@@ -1338,6 +1388,83 @@ NatafProbabilityTransformation::setCorrelationMatrix(int pertMeanOfThisRV, int p
 		(*correlationMatrix)(i2, i1) = newCorrelation;
 	}
 
+	// Solve the integral equation for the pairs without closed form,
+	// reusing the solutions of pairs that have not changed
+	int numPending = (int)pendingRv1.size();
+	std::vector<double> pendingSolution(numPending, 0.0);
+	std::vector< std::vector<double> > pendingKey(numPending);
+	std::vector<int> toSolve;
+	for (int p = 0; p < numPending; p++) {
+		this->correlationKey(pendingRv1[p], pendingRv2[p], pendingCorrelation[p], pendingKey[p]);
+		std::map<std::vector<double>, double>::iterator it = correlationCache.find(pendingKey[p]);
+		if (it != correlationCache.end())
+			pendingSolution[p] = it->second;
+		else
+			toSolve.push_back(p);
+	}
+
+	int numToSolve = (int)toSolve.size();
+	if (numToSolve > 0) {
+
+		// The marginal transformations do not depend on the correlation;
+		// evaluate them once per random variable, and here rather than in
+		// the parallel loop as the inverse CDFs need not be thread safe
+		std::map<int, std::vector<double> > marginals;
+		for (int s = 0; s < numToSolve; s++) {
+			int p = toSolve[s];
+			if (marginals.find(pendingRv1[p]) == marginals.end())
+				this->standardizedMarginal(pendingRv1[p], marginals[pendingRv1[p]]);
+			if (marginals.find(pendingRv2[p]) == marginals.end())
+				this->standardizedMarginal(pendingRv2[p], marginals[pendingRv2[p]]);
+		}
+		std::vector<const double *> g1(numToSolve);
+		std::vector<const double *> g2(numToSolve);
+		for (int s = 0; s < numToSolve; s++) {
+			int p = toSolve[s];
+			g1[s] = &(marginals[pendingRv1[p]][0]);
+			g2[s] = &(marginals[pendingRv2[p]][0]);
+		}
+
+		// The pairs are independent root finding problems
+		std::vector<int> solveResult(numToSolve, 0);
+#pragma omp parallel for schedule(dynamic)
+		for (int s = 0; s < numToSolve; s++) {
+			int p = toSolve[s];
+			solveResult[s] = this->solveForCorrelation(g1[s], g2[s], pendingCorrelation[p], pendingSolution[p]);
+		}
+
+		for (int s = 0; s < numToSolve; s++) {
+			int p = toSolve[s];
+			opserr << " ... modifying correlation rho("<<pendingRv1[p]<<","<<pendingRv2[p]<<") for user-defined random variable..." << endln;
+			if (solveResult[s] < 0) {
+				opserr << "WARNING: NatafProbabilityTransformation::solveForCorrelation() -- " << endln;
+				if (solveResult[s] == -1)
+					opserr << " zero derivative in Newton algorithm. " << endln;
+				else
+					opserr << " Newton scheme did not converge. " << endln;
+				pendingSolution[p] = 0.0;
+			}
+			else {
+				opserr << " ... computed correlation for Nataf standard normal variates: " << pendingSolution[p] << endln;
+				correlationCache[pendingKey[p]] = pendingSolution[p];
+			}
+		}
+	}
+
+	for (int p = 0; p < numPending; p++) {
+		newCorrelation = pendingSolution[p];
+		if(newCorrelation > 1.0) {
+			newCorrelation = 0.999999999;
+		}
+		if(newCorrelation < -1.0) {
+			newCorrelation = -0.999999999;
+		}
+		int i1 = theReliabilityDomain->getRandomVariableIndex(pendingRv1[p]);
+		int i2 = theReliabilityDomain->getRandomVariableIndex(pendingRv2[p]);
+		(*correlationMatrix)(i1, i2) = newCorrelation;
+		(*correlationMatrix)(i2, i1) = newCorrelation;
+	}
+
 	// Here the correlation matrix should be checked for validity
 	// (Whether it is close to singular or not)
 	
@@ -1364,202 +1491,78 @@ NatafProbabilityTransformation::phi2(double z_i,
 
 
 
-double
-NatafProbabilityTransformation::integrand(int rv_i,
-										  double z_i, 
-										  double mean_i,
-										  double stdv_i, 
-										  int rv_j,
-										  double z_j,
-										  double mean_j, 
-										  double stdv_j,
-										  double rho)
+int
+NatafProbabilityTransformation::standardizedMarginal(int rvTag, std::vector<double> &g)
 {
-	RandomVariable *theRv_i = theReliabilityDomain->getRandomVariablePtr(rv_i);
-	RandomVariable *theRv_j = theReliabilityDomain->getRandomVariablePtr(rv_j);
+	RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtr(rvTag);
+	if (theRV == 0) {
+		opserr << "NatafProbabilityTransformation::standardizedMarginal -- rv with tag " << rvTag << " not found in reliability domain" << endln;
+		g.assign(numNatafIntervals+1, 0.0);
+		return -1;
+	}
 	static NormalRV aStandardNormalRV(1,0.0,1.0); 
 
-	double x_i = theRv_i->getInverseCDFvalue(aStandardNormalRV.getCDFvalue(z_i));
-	double x_j = theRv_j->getInverseCDFvalue(aStandardNormalRV.getCDFvalue(z_j));
-
-	double thePhi2 = phi2(z_i, z_j, rho);
-
-	return ( (x_i-mean_i)/stdv_i 
-		   * (x_j-mean_j)/stdv_j 
-		   * thePhi2 );
-}
-
+	double mean = theRV->getMean();
+	double stdv = theRV->getStdv();
+	double h = 2.0*natafZmax/numNatafIntervals;
 
-double
-NatafProbabilityTransformation::doubleIntegral(int rv_i,
-										  double mean_i,
-										  double stdv_i, 
-										  int rv_j,
-										  double mean_j, 
-										  double stdv_j,
-										  double rho)
-{
-	// The grid of integration points:
-	// 1, 2, ..., i, ..., 2*n  in x-direction with intervals h
-	// 1, 2, ..., j, ..., 2*m  in y-direction with intervals k
-	int i, j;
-	
+	g.resize(numNatafIntervals+1);
+	for (int k = 0; k <= numNatafIntervals; k++) {
+		double z = -natafZmax + k*h;
+		double x = theRV->getInverseCDFvalue(aStandardNormalRV.getCDFvalue(z));
 
-	// Selected integration boundaries
-	double z_i0 = -5.0;
-	double z_in =  5.0;
-	double z_j0 = -5.0;
-	double z_jm =  5.0;
+		// Simpson weights 1, 4, 2, 4, ..., 2, 4, 1
+		double w = 2.0;
+		if (k == 0 || k == numNatafIntervals)
+			w = 1.0;
+		else if (k % 2 == 1)
+			w = 4.0;
 
-	// Half the number of integration points
-	int n = 100;
-	int m = 100;
-	
-	// Integration point intervals
-	double h = (z_in-z_i0)/(2.0*n);
-	double k = (z_jm-z_j0)/(2.0*m);
-
-	// Grid of integration points
-	Vector z_i(2*n);
-	Vector z_j(2*m);
-	for (i=1; i<=2*n; i++) {
-		z_i(i-1) = z_i0 + (i-1)*h;
-	}
-	for (j=1; j<=2*m; j++) {
-		z_j(j-1) = z_j0 + (j-1)*k;
+		g[k] = w*(x-mean)/stdv;
 	}
 
-	// Computing sums (naming terms according to p. 126 in "Numerical Methods" by Faires & Burden)
-	double term1 = 0.0;
-	double term2 = 0.0;
-	double term3 = 0.0;
-	double term4 = 0.0;
-	double term5 = 0.0;
-	double term6 = 0.0;
-	double term7 = 0.0;
-	double term8 = 0.0;
-	double term9 = 0.0;
-	double term10 = 0.0;
-	double term11 = 0.0;
-	double term12 = 0.0;
-	double term13 = 0.0;
-	double term14 = 0.0;
-	double term15 = 0.0;
-	double term16 = 0.0;
-
-	// No sum terms
-	term1 = integrand( rv_i, z_i( 0        ) , mean_i, stdv_i, 
-			           rv_j, z_j( 0        ) , mean_j, stdv_j, rho);
-	term4 = integrand( rv_i, z_i( 2*n    -1) , mean_i, stdv_i, 
-			           rv_j, z_j( 0        ) , mean_j, stdv_j, rho);
-	term13 = integrand(rv_i, z_i( 0        ) , mean_i, stdv_i, 
-			           rv_j, z_j( 2*m    -1) , mean_j, stdv_j, rho);
-	term16 = integrand(rv_i, z_i( 2*n    -1) , mean_i, stdv_i, 
-			           rv_j, z_j( 2*m    -1) , mean_j, stdv_j, rho);
-
-	// Single sum over n terms
-	for (i=1; i<=n; i++) {
-		term2 += integrand(rv_i, z_i( 2*i    -1) , mean_i, stdv_i, 
-			               rv_j, z_j( 0        ) , mean_j, stdv_j, rho);
-		term3 += integrand(rv_i, z_i( 2*i-1  -1) , mean_i, stdv_i, 
-			               rv_j, z_j( 0        ) , mean_j, stdv_j, rho);
-		term14 += integrand(rv_i, z_i( 2*i    -1) , mean_i, stdv_i, 
-			                rv_j, z_j( 2*m    -1) , mean_j, stdv_j, rho);
-		term15 += integrand(rv_i, z_i( 2*i-1    -1) , mean_i, stdv_i, 
-			                rv_j, z_j( 2*m      -1) , mean_j, stdv_j, rho);
-	}
-	term2 -= integrand(rv_i, z_i( 2*n  -1) , mean_i, stdv_i, 
-			           rv_j, z_j( 0      ) , mean_j, stdv_j, rho);
-	term14 -= integrand(rv_i, z_i( 2*n    -1) , mean_i, stdv_i, 
-		                rv_j, z_j( 2*m    -1) , mean_j, stdv_j, rho);
-
-	// Single sum over m terms
-	for (j=1; j<=m; j++) {
-		term5 += integrand(rv_i, z_i( 0        ) , mean_i, stdv_i, 
-			               rv_j, z_j( 2*j    -1) , mean_j, stdv_j, rho);
-		term8 += integrand(rv_i, z_i( 2*n    -1) , mean_i, stdv_i, 
-			               rv_j, z_j( 2*j    -1) , mean_j, stdv_j, rho);
-		term9 += integrand(rv_i, z_i( 0          ) , mean_i, stdv_i, 
-			               rv_j, z_j( 2*j-1    -1) , mean_j, stdv_j, rho);
-		term12 += integrand(rv_i, z_i( 2*n     -1) , mean_i, stdv_i, 
-			                rv_j, z_j( 2*j-1   -1) , mean_j, stdv_j, rho);
-	}
-	term8 -= integrand(rv_i, z_i( 2*n    -1) , mean_i, stdv_i, 
-		               rv_j, z_j( 2*m    -1) , mean_j, stdv_j, rho);
-	
-	// Double sum terms
-	for (j=1; j<=(m-1); j++) {
-		for (i=1; i<=(n-1); i++) {
-			term6 += integrand(rv_i, z_i( 2*i    -1) , mean_i, stdv_i, 
-							   rv_j, z_j( 2*j    -1) , mean_j, stdv_j, rho);
-		}
-	}
-	for (j=1; j<=(m-1); j++) {
-		for (i=1; i<=(n); i++) {
-			term7 += integrand(rv_i, z_i( 2*i-1    -1) , mean_i, stdv_i, 
-							   rv_j, z_j( 2*j      -1) , mean_j, stdv_j, rho);
-		}
-	}
-	for (j=1; j<=(m); j++) {
-		for (i=1; i<=(n-1); i++) {
-			term10 += integrand(rv_i, z_i( 2*i       -1) , mean_i, stdv_i, 
-							    rv_j, z_j( 2*j-1     -1) , mean_j, stdv_j, rho);
-		}
-	}
-	for (j=1; j<=(m); j++) {
-		for (i=1; i<=(n); i++) {
-			term11 += integrand(rv_i, z_i( 2*i-1     -1) , mean_i, stdv_i, 
-							    rv_j, z_j( 2*j-1     -1) , mean_j, stdv_j, rho);
-		}
-	}
-
-
-	double par1 = term1 + 2.0*term2 + 4.0*term3 + term4;
-	
-	double par2 = term5 + 2.0*term6 + 4.0*term7 + term8;
-
-	double par3 = term9 + 2.0*term10 + 4.0*term11 + term12;
-
-	double par4 = term13 + 2.0*term14 + 4.0*term15 + term16;
-
-	double result = h*k/9.0 * (par1 + 2.0*par2 + 4.0*par3 + par4);
-
-	return result;
+	return 0;
 }
 
 
-
 double
-NatafProbabilityTransformation::residualFunction(double rho_original, 
-												 double rho,
-												 int rv_i, 
-												 double mean_i, 
-												 double stdv_i, 
-												 int rv_j, 
-												 double mean_j, 
-												 double stdv_j)
+NatafProbabilityTransformation::doubleIntegral(const double *g_i,
+											   const double *g_j,
+											   double rho)
 {
-	double result = rho_original - doubleIntegral(rv_i, mean_i, stdv_i, rv_j, mean_j, stdv_j, rho);
+	// Tensor product Simpson rule; with the marginals and weights
+	// precomputed only the bivariate normal density is left to evaluate
+	double h = 2.0*natafZmax/numNatafIntervals;
+	double c = 1.0/(2.0*(1.0-rho*rho));
 
-	return result;
-}
+	double result = 0.0;
+	for (int a = 0; a <= numNatafIntervals; a++) {
+		if (g_i[a] == 0.0)
+			continue;
+		double z_a = -natafZmax + a*h;
+		double sum = 0.0;
+		for (int b = 0; b <= numNatafIntervals; b++) {
+			double z_b = -natafZmax + b*h;
+			sum += g_j[b]*exp(-(z_a*z_a + z_b*z_b - 2.0*rho*z_a*z_b)*c);
+		}
+		result += g_i[a]*sum;
+	}
 
+	double pi = 3.14159265358979;
 
+	return result * h*h/9.0 / (2.0*pi*sqrt(1.0-rho*rho));
+}
 
 
-double
-NatafProbabilityTransformation::solveForCorrelation(int rv_i, int rv_j, double rho_original)
+int
+NatafProbabilityTransformation::solveForCorrelation(const double *g_i,
+													const double *g_j,
+													double rho_original,
+													double &rho)
 {
-	RandomVariable *theRv_i = theReliabilityDomain->getRandomVariablePtr(rv_i);
-	RandomVariable *theRv_j = theReliabilityDomain->getRandomVariablePtr(rv_j);
-
-	double mean_i = theRv_i->getMean();
-	double mean_j = theRv_j->getMean();
-
-	double stdv_i = theRv_i->getStdv();
-	double stdv_j = theRv_j->getStdv();
-
-	double result = 0.0;
+	// Newton iterations on rho_original - doubleIntegral(rho) = 0 with a
+	// forward difference derivative. Called from a parallel loop, so no
+	// output here: returns -1 for a zero derivative, -2 if not converged
 
 	double tol = 1.0e-6;
 	double pert = 1.0e-4;
@@ -1573,49 +1576,54 @@ NatafProbabilityTransformation::solveForCorrelation(int rv_i, int rv_j, double r
 	for (int i=1;  i<=100;  i++ )  {
 
 		// Evaluate function
-		f = residualFunction(rho_original,
-			                 rho_old,
-							 rv_i, mean_i, stdv_i, 
-							 rv_j, mean_j, stdv_j);
+		f = rho_original - doubleIntegral(g_i, g_j, rho_old);
 
 		// Evaluate perturbed function
-		perturbed_f = residualFunction(rho_original,
-									   (rho_old+pert),
-									   rv_i, mean_i, stdv_i, 
-									   rv_j, mean_j, stdv_j);
+		perturbed_f = rho_original - doubleIntegral(g_i, g_j, rho_old+pert);
 
 		// Evaluate derivative of function
 		df = ( perturbed_f - f ) / pert;
 
 		if ( fabs(df) < 1.0e-15) {
-			opserr << "WARNING: NatafProbabilityTransformation::solveForCorrelation() -- " << endln
-				<< " zero derivative in Newton algorithm. " << endln;
+			rho = 0.0;
+			return -1;
 		}
-		else {
 
-			// Take a Newton step
-			rho_new = rho_old - f/df;
-			
-			// Check convergence; quit or continue
-			if (fabs(1.0-fabs(rho_old/rho_new)) < tol) {
-				result = rho_new;
-				return result;
-			}
-			else {
-				if (i==100) {
-					opserr << "WARNING: NatafProbabilityTransformation::solveForCorrelation() -- " << endln
-						<< " Newton scheme did not converge. " << endln;
-					result = 0.0;
-					return result;
-				}
-				else {
-					rho_old = rho_new;
-				}
+		// Take a Newton step
+		rho_new = rho_old - f/df;
 			
-			}
+		// Check convergence; quit or continue
+		if (fabs(1.0-fabs(rho_old/rho_new)) < tol) {
+			rho = rho_new;
+			return 0;
 		}
+		rho_old = rho_new;
 	}
 
-	return result;
+	rho = 0.0;
+	return -2;
+}
+
 
+void
+NatafProbabilityTransformation::correlationKey(int rv_i, int rv_j, double rho_original,
+											   std::vector<double> &key)
+{
+	key.clear();
+	key.push_back(rv_i);
+	key.push_back(rv_j);
+	key.push_back(rho_original);
+
+	int rvs[2] = {rv_i, rv_j};
+	for (int r = 0; r < 2; r++) {
+		RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtr(rvs[r]);
+		if (theRV == 0)
+			continue;
+		key.push_back(theRV->getMean());
+		key.push_back(theRV->getStdv());
+		const Vector &param = theRV->getParameters();
+		key.push_back(param.Size());
+		for (int k = 0; k < param.Size(); k++)
+			key.push_back(param(k));
+	}
 }
@@ -39,6 +39,9 @@
 #include <ReliabilityDomain.h>
 #include <MatrixOperations.h>
 
+#include <map>
+#include <vector>
+
 class NatafProbabilityTransformation : public ProbabilityTransformation
 {
 
@@ -49,6 +52,7 @@ public:
 
 	int transform_x_to_u(Vector &u);
 	int transform_u_to_x(const Vector &u, Vector &x);
+	int transform_u_to_x(const Matrix &U, Matrix &X);
 	int getJacobian_x_to_u(Matrix &Jxu);
 	int getJacobian_u_to_x(const Vector &u, Matrix &Jux);
 
@@ -85,31 +89,23 @@ private:
 	double phi2(double z_i, 
 				double z_j, 
 				double rho);
-	double integrand(int rv_i,
-				     double z_i, 
-				     double mean_i,
-				     double stdv_i, 
-				     int rv_j,
-				     double z_j,
-				     double mean_j, 
-				     double stdv_j,
-				     double rho);
-	double doubleIntegral(int rv_i,
-						  double mean_i,
-						  double stdv_i, 
-						  int rv_j,
-						  double mean_j, 
-						  double stdv_j,
+	// (x-mean)/stdv of a random variable at the quadrature points,
+	// premultiplied by the quadrature weights
+	int standardizedMarginal(int rvTag, std::vector<double> &g);
+	double doubleIntegral(const double *g_i,
+						  const double *g_j,
 						  double rho);
-	double residualFunction(double rho_original, 
-						    double rho,
-						    int rv_i, 
-						    double mean_i, 
-						    double stdv_i, 
-						    int rv_j, 
-						    double mean_j, 
-						    double stdv_j);
-	double solveForCorrelation(int rv_i, int rv_j, double rho_original);
+	int solveForCorrelation(const double *g_i,
+							const double *g_j,
+							double rho_original,
+							double &rho);
+	void correlationKey(int rv_i, int rv_j, double rho_original,
+						std::vector<double> &key);
+
+	// Nataf correlations obtained from the integral equation, keyed by
+	// the two random variables, their parameters and the original
+	// correlation, so that unchanged pairs are not solved again
+	std::map<std::vector<double>, double> correlationCache;
 };
 
 #endif
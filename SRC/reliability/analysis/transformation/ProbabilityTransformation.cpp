@@ -41,4 +41,25 @@ ProbabilityTransformation::~ProbabilityTransformation()
 {
 }
 
+int
+ProbabilityTransformation::transform_u_to_x(const Matrix &U, Matrix &X)
+{
+	int n = U.noRows();
+	int numSamples = U.noCols();
+	if (X.noRows() != n || X.noCols() != numSamples)
+		X.resize(n, numSamples);
+
+	Vector u(n);
+	Vector x(n);
+	for (int s = 0; s < numSamples; s++) {
+		for (int i = 0; i < n; i++)
+			u(i) = U(i,s);
+		int result = this->transform_u_to_x(u, x);
+		if (result < 0)
+			return result;
+		for (int i = 0; i < n; i++)
+			X(i,s) = x(i);
+	}
 
+	return 0;
+}
@@ -46,6 +46,9 @@ public:
 
 	virtual int transform_x_to_u(Vector &u) = 0;
 	virtual int transform_u_to_x(const Vector &u, Vector &x) = 0;
+	// Batched version: each column of U is one realization in standard
+	// normal space, the corresponding column of X is filled in
+	virtual int transform_u_to_x(const Matrix &U, Matrix &X);
 	virtual int getJacobian_x_to_u(Matrix &Jxu) = 0;
 	virtual int getJacobian_u_to_x(const Vector &u, Matrix &Jux) = 0;
 
@@ -32,6 +32,7 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include<PhaseTimer.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -55,6 +56,8 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  // the first solve after a new tangent includes its factorization
+  PhaseTimer theTimer(PhaseTimer::solvePhase());
   if (theSolver != 0)
     return (theSolver->solve());
   else 
@@ -60,11 +60,20 @@ extern void OPS_clearAllHystereticBackbone(void);
 extern void OPS_clearAllStiffnessDegradation(void);
 extern void OPS_clearAllStrengthDegradation(void);
 extern void OPS_clearAllUnloadingRule(void);
+extern void OPS_clearAllContactDetector(void);
 
 int OPS_sectionLocation();
 int OPS_sectionWeight();
 int OPS_sectionTag();
 int OPS_sectionDisplacement();
+int OPS_materialDriver();
+int OPS_setQuiescentTolerance();
+int OPS_Profile();
+int OPS_NumbererCache();
+int OPS_SolutionStrategy();
+int OPS_HarmonicAnalysis();
+int OPS_ContactSearch();
+int OPS_shapeFunctionCache();
 
 // the following is a little kludgy but it works!
 #ifdef _USING_STL_STREAMS
@@ -1116,6 +1125,30 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     Tcl_CreateCommand(interp, "setMaxOpenFiles", &maxOpenFiles, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
 
+    Tcl_CreateCommand(interp, "materialDriver", &materialDriver, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+    Tcl_CreateCommand(interp, "setQuiescentTolerance", &setQuiescentTolerance, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+    Tcl_CreateCommand(interp, "profile", &profile, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+    Tcl_CreateCommand(interp, "numbererCache", &numbererCache, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+    Tcl_CreateCommand(interp, "solutionStrategy", &solutionStrategy, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+    Tcl_CreateCommand(interp, "harmonicAnalysis", &harmonicAnalysis, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+    Tcl_CreateCommand(interp, "contactSearch", &contactSearch, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+    Tcl_CreateCommand(interp, "shapeFunctionCache", &shapeFunctionCache, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
 #ifdef _RELIABILITY
     Tcl_CreateCommand(interp, "wipeReliability", wipeReliability, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL); 
@@ -1450,6 +1483,7 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     delete theDatabase;
 
   theDomain.clearAll();
+  OPS_clearAllContactDetector();
   OPS_clearAllUniaxialMaterial();
   OPS_clearAllNDMaterial();
   OPS_clearAllSectionForceDeformation();
@@ -4502,6 +4536,17 @@ int
 specifyIntegrator(ClientData clientData, Tcl_Interp *interp, int argc, 
 		  TCL_Char **argv)
 {
+  // a trailing "-predictor type" applies to any StaticIntegrator
+  int predictor = -1;
+  StaticIntegrator *theOldStaticIntegrator = theStaticIntegrator;
+  if (argc > 3 && strcmp(argv[argc-2],"-predictor") == 0) {
+    predictor = StaticIntegrator::getPredictorType(argv[argc-1]);
+    if (predictor < 0) {
+      opserr << "WARNING integrator -predictor tangent, secant or quadratic\n";
+      return TCL_ERROR;
+    }
+    argc -= 2;
+  }
 
     OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, &theDomain);
 
@@ -4577,15 +4622,40 @@ specifyIntegrator(ClientData clientData, Tcl_Interp *interp, int argc,
   else if (strcmp(argv[1],"ArcLength") == 0) {
       double arcLength;
       double alpha;
-      if (argc != 4) {
-	opserr << "WARNING integrator ArcLength arcLength alpha \n";
+      if (argc < 4 || argc%2 != 0) {
+	opserr << "WARNING integrator ArcLength arcLength alpha <-numIter Jd> <-minArc min> <-maxArc max> <-exponent e>\n";
 	return TCL_ERROR;
       }    
       if (Tcl_GetDouble(interp, argv[2], &arcLength) != TCL_OK)	
 	return TCL_ERROR;	
       if (Tcl_GetDouble(interp, argv[3], &alpha) != TCL_OK)	
 	return TCL_ERROR;	
-      theStaticIntegrator = new ArcLength(arcLength,alpha);       
+
+      int numIter = 0;
+      double minArc = 0.0, maxArc = 0.0, exponent = 0.5;
+      for (int i = 4; i < argc; i += 2) {
+	if (strcmp(argv[i],"-numIter") == 0) {
+	  if (Tcl_GetInt(interp, argv[i+1], &numIter) != TCL_OK)
+	    return TCL_ERROR;
+	} else if (strcmp(argv[i],"-minArc") == 0) {
+	  if (Tcl_GetDouble(interp, argv[i+1], &minArc) != TCL_OK)
+	    return TCL_ERROR;
+	} else if (strcmp(argv[i],"-maxArc") == 0) {
+	  if (Tcl_GetDouble(interp, argv[i+1], &maxArc) != TCL_OK)
+	    return TCL_ERROR;
+	} else if (strcmp(argv[i],"-exponent") == 0) {
+	  if (Tcl_GetDouble(interp, argv[i+1], &exponent) != TCL_OK)
+	    return TCL_ERROR;
+	} else {
+	  opserr << "WARNING integrator ArcLength unknown option " << argv[i] << endln;
+	  return TCL_ERROR;
+	}
+      }
+
+      ArcLength *theArcLength = new ArcLength(arcLength,alpha);
+      if (numIter > 0)
+	theArcLength->setStepAdaptation(numIter, minArc, maxArc, exponent);
+      theStaticIntegrator = theArcLength;
 
   // if the analysis exists - we want to change the Integrator
   if (theStaticAnalysis != 0)
@@ -5530,6 +5600,9 @@ specifyIntegrator(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_ERROR;
   }    
 
+  if (predictor >= 0 && theStaticIntegrator != 0 && theStaticIntegrator != theOldStaticIntegrator)
+    theStaticIntegrator->setPredictor(predictor);
+
 #ifdef _PARALLEL_PROCESSING
 
   if (theStaticAnalysis != 0 && theStaticIntegrator != 0) {
@@ -10788,3 +10861,91 @@ printModelGID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **ar
 	return res;
 }
 // Talledo End
+
+int
+shapeFunctionCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_shapeFunctionCache() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+contactSearch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_ContactSearch() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+harmonicAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_HarmonicAnalysis() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+solutionStrategy(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_SolutionStrategy() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+numbererCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_NumbererCache() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+profile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_Profile() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+setQuiescentTolerance(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_setQuiescentTolerance() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
+int
+materialDriver(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, &theDomain);
+
+  if (OPS_materialDriver() < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
@@ -387,3 +387,26 @@ elementActivate(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
 int
 elementDeactivate(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+shapeFunctionCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+contactSearch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+harmonicAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+solutionStrategy(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+numbererCache(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+profile(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+setQuiescentTolerance(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+materialDriver(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
@@ -0,0 +1,262 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/utility/PhaseTimer.cpp
+//
+// Description: This file contains the implementation for PhaseTimer.
+//
+// What: "@(#) PhaseTimer.cpp, revA"
+
+#include <PhaseTimer.h>
+#include <elementAPI.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+static const char *phaseNames[PhaseTimer::NumPhases] = {
+  "setup", "numbering", "assembly", "factorization", "solve",
+  "stateDetermination", "recording"
+};
+
+bool PhaseTimer::enabled = false;
+bool PhaseTimer::newTangent = true;
+PhaseTimer *PhaseTimer::current = 0;
+double PhaseTimer::resetTime = 0.0;
+double PhaseTimer::times[PhaseTimer::NumPhases];
+int PhaseTimer::calls[PhaseTimer::NumPhases];
+int PhaseTimer::numSteps = 0;
+
+int OPS_Profile()
+{
+    // profile on|off|reset
+    // profile report <-file fileName> <-label label>
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING profile on|off|reset|report <-file fileName> <-label label>\n";
+	return -1;
+    }
+
+    const char *action = OPS_GetString();
+    if (action == 0) {
+	opserr << "WARNING profile on|off|reset|report <-file fileName> <-label label>\n";
+	return -1;
+    }
+
+    if (strcmp(action, "on") == 0) {
+	PhaseTimer::reset();
+	PhaseTimer::setEnabled(true);
+	return 0;
+    } else if (strcmp(action, "off") == 0) {
+	PhaseTimer::setEnabled(false);
+	return 0;
+    } else if (strcmp(action, "reset") == 0) {
+	PhaseTimer::reset();
+	return 0;
+    } else if (strcmp(action, "report") != 0) {
+	opserr << "WARNING profile - unknown option " << action << endln;
+	return -1;
+    }
+
+    const char *fileName = 0;
+    const char *label = 0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *opt = OPS_GetString();
+	if (opt == 0)
+	    break;
+	if (strcmp(opt, "-file") != 0 && strcmp(opt, "-label") != 0) {
+	    opserr << "WARNING profile report - unknown option " << opt << endln;
+	    return -1;
+	}
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING profile report - missing value after " << opt << endln;
+	    return -1;
+	}
+	if (strcmp(opt, "-file") == 0)
+	    fileName = OPS_GetString();
+	else
+	    label = OPS_GetString();
+    }
+
+    std::string report;
+    PhaseTimer::getReport(report, label);
+
+    if (fileName != 0) {
+	FILE *theFile = fopen(fileName, "a");
+	if (theFile == 0) {
+	    opserr << "WARNING profile report - could not open file " << fileName << endln;
+	    return -1;
+	}
+	fprintf(theFile, "%s\n", report.c_str());
+	fclose(theFile);
+    }
+
+    if (OPS_SetString(report.c_str()) < 0) {
+	opserr << "WARNING profile report - failed to set the result\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+PhaseTimer::PhaseTimer(Phase thePhase)
+  :phase(thePhase), active(enabled), start(0.0), childTime(0.0), parent(0)
+{
+  if (active) {
+    parent = current;
+    current = this;
+    start = now();
+  }
+}
+
+PhaseTimer::~PhaseTimer()
+{
+  if (!active)
+    return;
+
+  double elapsed = now() - start;
+  times[phase] += elapsed - childTime;
+  calls[phase]++;
+
+  if (parent != 0)
+    parent->childTime += elapsed;
+  current = parent;
+}
+
+double
+PhaseTimer::now(void)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void
+PhaseTimer::setEnabled(bool onOff)
+{
+  enabled = onOff;
+}
+
+void
+PhaseTimer::reset(void)
+{
+  for (int i = 0; i < NumPhases; i++) {
+    times[i] = 0.0;
+    calls[i] = 0;
+  }
+  numSteps = 0;
+  newTangent = true;
+  resetTime = now();
+}
+
+void
+PhaseTimer::countStep(void)
+{
+  if (enabled)
+    numSteps++;
+}
+
+void
+PhaseTimer::tangentFormed(void)
+{
+  newTangent = true;
+}
+
+PhaseTimer::Phase
+PhaseTimer::solvePhase(void)
+{
+  if (newTangent) {
+    newTangent = false;
+    return Factorization;
+  }
+  return Solve;
+}
+
+long
+PhaseTimer::getPeakRSS(void)
+{
+#ifdef _WIN32
+  return -1;
+#else
+  struct rusage theUsage;
+  if (getrusage(RUSAGE_SELF, &theUsage) != 0)
+    return -1;
+#ifdef __APPLE__
+  return theUsage.ru_maxrss / 1024;
+#else
+  return theUsage.ru_maxrss;
+#endif
+#endif
+}
+
+// appends text to a JSON string, escaping quotes, backslashes and
+// control characters
+static void
+appendJSONString(std::string &json, const char *text)
+{
+  json += '"';
+  for (const char *c = text; *c != 0; c++) {
+    switch (*c) {
+    case '"': json += "\\\""; break;
+    case '\\': json += "\\\\"; break;
+    case '\n': json += "\\n"; break;
+    case '\r': json += "\\r"; break;
+    case '\t': json += "\\t"; break;
+    default:
+      if ((unsigned char)*c < 0x20) {
+	char code[8];
+	snprintf(code, 8, "\\u%04x", (unsigned int)(unsigned char)*c);
+	json += code;
+      } else
+	json += *c;
+    }
+  }
+  json += '"';
+}
+
+void
+PhaseTimer::getReport(std::string &report, const char *label)
+{
+  // a solve is done once per iteration of the solution algorithm
+  int numIter = calls[Factorization] + calls[Solve];
+  double total = now() - resetTime;
+
+  char buffer[256];
+  report = "{";
+  if (label != 0) {
+    report += "\"label\": ";
+    appendJSONString(report, label);
+    report += ", ";
+  }
+
+  snprintf(buffer, 256,
+	   "\"total\": %.6f, \"steps\": %d, \"iterations\": %d, \"peakRSS_kB\": %ld, \"phases\": {",
+	   total, numSteps, numIter, getPeakRSS());
+  report += buffer;
+
+  for (int i = 0; i < NumPhases; i++) {
+    snprintf(buffer, 256, "%s\"%s\": {\"time\": %.6f, \"calls\": %d}",
+	     i == 0 ? "" : ", ", phaseNames[i], times[i], calls[i]);
+    report += buffer;
+  }
+
+  report += "}}";
+}
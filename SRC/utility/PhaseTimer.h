@@ -0,0 +1,81 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// File: ~/utility/PhaseTimer.h
+//
+// Description: This file contains the class definition for PhaseTimer.
+// PhaseTimer accumulates the wall clock time spent in the phases of an
+// analysis (setup, numbering, assembly, factorization, solve, state
+// determination and recording). A PhaseTimer object is a scoped timer: it
+// charges the time between its construction and destruction to its phase,
+// less the time charged to any PhaseTimer created inside that scope, so the
+// phases never count the same time twice. Nothing is timed unless the
+// timers have been enabled with the profile command.
+//
+// What: "@(#) PhaseTimer.h, revA"
+
+#ifndef PhaseTimer_h
+#define PhaseTimer_h
+
+#include <string>
+
+class PhaseTimer
+{
+  public:
+    enum Phase {Setup = 0, Numbering, Assembly, Factorization, Solve,
+		StateDetermination, Recording, NumPhases};
+
+    PhaseTimer(Phase thePhase);
+    ~PhaseTimer();
+
+    static void setEnabled(bool onOff);
+    static bool isEnabled(void) {return enabled;};
+    static void reset(void);
+
+    // a committed step
+    static void countStep(void);
+    // a new tangent was assembled, the next solve factors it
+    static void tangentFormed(void);
+    // Factorization for the first solve after tangentFormed(), else Solve
+    static Phase solvePhase(void);
+
+    // one line JSON record of the accumulated times and counters
+    static void getReport(std::string &report, const char *label = 0);
+    static long getPeakRSS(void);
+
+  private:
+    static double now(void);
+
+    Phase phase;
+    bool active;
+    double start;
+    double childTime;
+    PhaseTimer *parent;
+
+    static bool enabled;
+    static bool newTangent;
+    static PhaseTimer *current;
+    static double resetTime;
+    static double times[NumPhases];
+    static int calls[NumPhases];
+    static int numSteps;
+};
+
+#endif